@@ -30,7 +30,6 @@
 PKG_REQ='''mingw-w64-x86_64-giflib
 mingw-w64-x86_64-gnutls
 mingw-w64-x86_64-harfbuzz
-mingw-w64-x86_64-jansson
 mingw-w64-x86_64-lcms2
 mingw-w64-x86_64-libjpeg-turbo
 mingw-w64-x86_64-libpng
@@ -42,7 +41,6 @@
 DLL_REQ='''libgif
 libgnutls
 libharfbuzz
-libjansson
 liblcms2
 libturbojpeg
 libpng
@@ -3260,8 +3260,10 @@ cl--macroexp-fboundp
                  (cons		. consp)
                  (fixnum	. integerp)
                  (float		. floatp)
+                 (f64vector	. f64vectorp)
                  (function	. functionp)
                  (integer	. integerp)
+                 (i64vector	. i64vectorp)
                  (keyword	. keywordp)
                  (list		. listp)
                  (number	. numberp)
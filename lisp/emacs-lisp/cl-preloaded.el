@@ -63,8 +63,9 @@ cl--typeof-types
     (module-function function atom)
     (buffer atom) (char-table array sequence atom)
     (bool-vector array sequence atom)
+    (f64vector array sequence atom) (i64vector array sequence atom)
     (frame atom) (hash-table atom) (terminal atom)
-    (thread atom) (mutex atom) (condvar atom)
+    (thread atom) (mutex atom) (condvar atom) (json-parser atom)
     (font-spec atom) (font-entity atom) (font-object atom)
     (vector array sequence atom)
     (user-ptr atom)
@@ -2378,8 +2378,7 @@ find-file-noselect-1
       (kill-local-variable 'cursor-type)
       (let ((inhibit-read-only t))
 	(erase-buffer))
-      (and (not rawfile)
-	   (set-buffer-multibyte t))
+      (set-buffer-multibyte (not rawfile))
       (if rawfile
 	  (condition-case ()
 	      (let ((inhibit-read-only t))
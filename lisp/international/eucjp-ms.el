@@ -0,0 +1,2091 @@
+;;; eucjp-ms.el -- translation table for eucJP-ms  -*- lexical-binding:t -*-
+;;; Automatically generated from /usr/share/i18n/charmaps/EUC-JP-MS.gz
+(let ((map
+       '(;JISEXT<->UNICODE
+
+	 (#xada1 . #x2460)
+	 (#xada2 . #x2461)
+	 (#xada3 . #x2462)
+	 (#xada4 . #x2463)
+	 (#xada5 . #x2464)
+	 (#xada6 . #x2465)
+	 (#xada7 . #x2466)
+	 (#xada8 . #x2467)
+	 (#xada9 . #x2468)
+	 (#xadaa . #x2469)
+	 (#xadab . #x246A)
+	 (#xadac . #x246B)
+	 (#xadad . #x246C)
+	 (#xadae . #x246D)
+	 (#xadaf . #x246E)
+	 (#xadb0 . #x246F)
+	 (#xadb1 . #x2470)
+	 (#xadb2 . #x2471)
+	 (#xadb3 . #x2472)
+	 (#xadb4 . #x2473)
+	 (#xadb5 . #x2160)
+	 (#xadb6 . #x2161)
+	 (#xadb7 . #x2162)
+	 (#xadb8 . #x2163)
+	 (#xadb9 . #x2164)
+	 (#xadba . #x2165)
+	 (#xadbb . #x2166)
+	 (#xadbc . #x2167)
+	 (#xadbd . #x2168)
+	 (#xadbe . #x2169)
+	 (#xadc0 . #x3349)
+	 (#xadc1 . #x3314)
+	 (#xadc2 . #x3322)
+	 (#xadc3 . #x334D)
+	 (#xadc4 . #x3318)
+	 (#xadc5 . #x3327)
+	 (#xadc6 . #x3303)
+	 (#xadc7 . #x3336)
+	 (#xadc8 . #x3351)
+	 (#xadc9 . #x3357)
+	 (#xadca . #x330D)
+	 (#xadcb . #x3326)
+	 (#xadcc . #x3323)
+	 (#xadcd . #x332B)
+	 (#xadce . #x334A)
+	 (#xadcf . #x333B)
+	 (#xadd0 . #x339C)
+	 (#xadd1 . #x339D)
+	 (#xadd2 . #x339E)
+	 (#xadd3 . #x338E)
+	 (#xadd4 . #x338F)
+	 (#xadd5 . #x33C4)
+	 (#xadd6 . #x33A1)
+	 (#xaddf . #x337B)
+	 (#xade0 . #x301D)
+	 (#xade1 . #x301F)
+	 (#xade2 . #x2116)
+	 (#xade3 . #x33CD)
+	 (#xade4 . #x2121)
+	 (#xade5 . #x32A4)
+	 (#xade6 . #x32A5)
+	 (#xade7 . #x32A6)
+	 (#xade8 . #x32A7)
+	 (#xade9 . #x32A8)
+	 (#xadea . #x3231)
+	 (#xadeb . #x3232)
+	 (#xadec . #x3239)
+	 (#xaded . #x337E)
+	 (#xadee . #x337D)
+	 (#xadef . #x337C)
+	 (#xadf0 . #x2252)
+	 (#xadf1 . #x2261)
+	 (#xadf2 . #x222B)
+	 (#xadf3 . #x222E)
+	 (#xadf4 . #x2211)
+	 (#xadf5 . #x221A)
+	 (#xadf6 . #x22A5)
+	 (#xadf7 . #x2220)
+	 (#xadf8 . #x221F)
+	 (#xadf9 . #x22BF)
+	 (#xadfa . #x2235)
+	 (#xadfb . #x2229)
+	 (#xadfc . #x222A)
+	 (#xf5a1 . #xE000)
+	 (#xf5a2 . #xE001)
+	 (#xf5a3 . #xE002)
+	 (#xf5a4 . #xE003)
+	 (#xf5a5 . #xE004)
+	 (#xf5a6 . #xE005)
+	 (#xf5a7 . #xE006)
+	 (#xf5a8 . #xE007)
+	 (#xf5a9 . #xE008)
+	 (#xf5aa . #xE009)
+	 (#xf5ab . #xE00A)
+	 (#xf5ac . #xE00B)
+	 (#xf5ad . #xE00C)
+	 (#xf5ae . #xE00D)
+	 (#xf5af . #xE00E)
+	 (#xf5b0 . #xE00F)
+	 (#xf5b1 . #xE010)
+	 (#xf5b2 . #xE011)
+	 (#xf5b3 . #xE012)
+	 (#xf5b4 . #xE013)
+	 (#xf5b5 . #xE014)
+	 (#xf5b6 . #xE015)
+	 (#xf5b7 . #xE016)
+	 (#xf5b8 . #xE017)
+	 (#xf5b9 . #xE018)
+	 (#xf5ba . #xE019)
+	 (#xf5bb . #xE01A)
+	 (#xf5bc . #xE01B)
+	 (#xf5bd . #xE01C)
+	 (#xf5be . #xE01D)
+	 (#xf5bf . #xE01E)
+	 (#xf5c0 . #xE01F)
+	 (#xf5c1 . #xE020)
+	 (#xf5c2 . #xE021)
+	 (#xf5c3 . #xE022)
+	 (#xf5c4 . #xE023)
+	 (#xf5c5 . #xE024)
+	 (#xf5c6 . #xE025)
+	 (#xf5c7 . #xE026)
+	 (#xf5c8 . #xE027)
+	 (#xf5c9 . #xE028)
+	 (#xf5ca . #xE029)
+	 (#xf5cb . #xE02A)
+	 (#xf5cc . #xE02B)
+	 (#xf5cd . #xE02C)
+	 (#xf5ce . #xE02D)
+	 (#xf5cf . #xE02E)
+	 (#xf5d0 . #xE02F)
+	 (#xf5d1 . #xE030)
+	 (#xf5d2 . #xE031)
+	 (#xf5d3 . #xE032)
+	 (#xf5d4 . #xE033)
+	 (#xf5d5 . #xE034)
+	 (#xf5d6 . #xE035)
+	 (#xf5d7 . #xE036)
+	 (#xf5d8 . #xE037)
+	 (#xf5d9 . #xE038)
+	 (#xf5da . #xE039)
+	 (#xf5db . #xE03A)
+	 (#xf5dc . #xE03B)
+	 (#xf5dd . #xE03C)
+	 (#xf5de . #xE03D)
+	 (#xf5df . #xE03E)
+	 (#xf5e0 . #xE03F)
+	 (#xf5e1 . #xE040)
+	 (#xf5e2 . #xE041)
+	 (#xf5e3 . #xE042)
+	 (#xf5e4 . #xE043)
+	 (#xf5e5 . #xE044)
+	 (#xf5e6 . #xE045)
+	 (#xf5e7 . #xE046)
+	 (#xf5e8 . #xE047)
+	 (#xf5e9 . #xE048)
+	 (#xf5ea . #xE049)
+	 (#xf5eb . #xE04A)
+	 (#xf5ec . #xE04B)
+	 (#xf5ed . #xE04C)
+	 (#xf5ee . #xE04D)
+	 (#xf5ef . #xE04E)
+	 (#xf5f0 . #xE04F)
+	 (#xf5f1 . #xE050)
+	 (#xf5f2 . #xE051)
+	 (#xf5f3 . #xE052)
+	 (#xf5f4 . #xE053)
+	 (#xf5f5 . #xE054)
+	 (#xf5f6 . #xE055)
+	 (#xf5f7 . #xE056)
+	 (#xf5f8 . #xE057)
+	 (#xf5f9 . #xE058)
+	 (#xf5fa . #xE059)
+	 (#xf5fb . #xE05A)
+	 (#xf5fc . #xE05B)
+	 (#xf5fd . #xE05C)
+	 (#xf5fe . #xE05D)
+	 (#xf6a1 . #xE05E)
+	 (#xf6a2 . #xE05F)
+	 (#xf6a3 . #xE060)
+	 (#xf6a4 . #xE061)
+	 (#xf6a5 . #xE062)
+	 (#xf6a6 . #xE063)
+	 (#xf6a7 . #xE064)
+	 (#xf6a8 . #xE065)
+	 (#xf6a9 . #xE066)
+	 (#xf6aa . #xE067)
+	 (#xf6ab . #xE068)
+	 (#xf6ac . #xE069)
+	 (#xf6ad . #xE06A)
+	 (#xf6ae . #xE06B)
+	 (#xf6af . #xE06C)
+	 (#xf6b0 . #xE06D)
+	 (#xf6b1 . #xE06E)
+	 (#xf6b2 . #xE06F)
+	 (#xf6b3 . #xE070)
+	 (#xf6b4 . #xE071)
+	 (#xf6b5 . #xE072)
+	 (#xf6b6 . #xE073)
+	 (#xf6b7 . #xE074)
+	 (#xf6b8 . #xE075)
+	 (#xf6b9 . #xE076)
+	 (#xf6ba . #xE077)
+	 (#xf6bb . #xE078)
+	 (#xf6bc . #xE079)
+	 (#xf6bd . #xE07A)
+	 (#xf6be . #xE07B)
+	 (#xf6bf . #xE07C)
+	 (#xf6c0 . #xE07D)
+	 (#xf6c1 . #xE07E)
+	 (#xf6c2 . #xE07F)
+	 (#xf6c3 . #xE080)
+	 (#xf6c4 . #xE081)
+	 (#xf6c5 . #xE082)
+	 (#xf6c6 . #xE083)
+	 (#xf6c7 . #xE084)
+	 (#xf6c8 . #xE085)
+	 (#xf6c9 . #xE086)
+	 (#xf6ca . #xE087)
+	 (#xf6cb . #xE088)
+	 (#xf6cc . #xE089)
+	 (#xf6cd . #xE08A)
+	 (#xf6ce . #xE08B)
+	 (#xf6cf . #xE08C)
+	 (#xf6d0 . #xE08D)
+	 (#xf6d1 . #xE08E)
+	 (#xf6d2 . #xE08F)
+	 (#xf6d3 . #xE090)
+	 (#xf6d4 . #xE091)
+	 (#xf6d5 . #xE092)
+	 (#xf6d6 . #xE093)
+	 (#xf6d7 . #xE094)
+	 (#xf6d8 . #xE095)
+	 (#xf6d9 . #xE096)
+	 (#xf6da . #xE097)
+	 (#xf6db . #xE098)
+	 (#xf6dc . #xE099)
+	 (#xf6dd . #xE09A)
+	 (#xf6de . #xE09B)
+	 (#xf6df . #xE09C)
+	 (#xf6e0 . #xE09D)
+	 (#xf6e1 . #xE09E)
+	 (#xf6e2 . #xE09F)
+	 (#xf6e3 . #xE0A0)
+	 (#xf6e4 . #xE0A1)
+	 (#xf6e5 . #xE0A2)
+	 (#xf6e6 . #xE0A3)
+	 (#xf6e7 . #xE0A4)
+	 (#xf6e8 . #xE0A5)
+	 (#xf6e9 . #xE0A6)
+	 (#xf6ea . #xE0A7)
+	 (#xf6eb . #xE0A8)
+	 (#xf6ec . #xE0A9)
+	 (#xf6ed . #xE0AA)
+	 (#xf6ee . #xE0AB)
+	 (#xf6ef . #xE0AC)
+	 (#xf6f0 . #xE0AD)
+	 (#xf6f1 . #xE0AE)
+	 (#xf6f2 . #xE0AF)
+	 (#xf6f3 . #xE0B0)
+	 (#xf6f4 . #xE0B1)
+	 (#xf6f5 . #xE0B2)
+	 (#xf6f6 . #xE0B3)
+	 (#xf6f7 . #xE0B4)
+	 (#xf6f8 . #xE0B5)
+	 (#xf6f9 . #xE0B6)
+	 (#xf6fa . #xE0B7)
+	 (#xf6fb . #xE0B8)
+	 (#xf6fc . #xE0B9)
+	 (#xf6fd . #xE0BA)
+	 (#xf6fe . #xE0BB)
+	 (#xf7a1 . #xE0BC)
+	 (#xf7a2 . #xE0BD)
+	 (#xf7a3 . #xE0BE)
+	 (#xf7a4 . #xE0BF)
+	 (#xf7a5 . #xE0C0)
+	 (#xf7a6 . #xE0C1)
+	 (#xf7a7 . #xE0C2)
+	 (#xf7a8 . #xE0C3)
+	 (#xf7a9 . #xE0C4)
+	 (#xf7aa . #xE0C5)
+	 (#xf7ab . #xE0C6)
+	 (#xf7ac . #xE0C7)
+	 (#xf7ad . #xE0C8)
+	 (#xf7ae . #xE0C9)
+	 (#xf7af . #xE0CA)
+	 (#xf7b0 . #xE0CB)
+	 (#xf7b1 . #xE0CC)
+	 (#xf7b2 . #xE0CD)
+	 (#xf7b3 . #xE0CE)
+	 (#xf7b4 . #xE0CF)
+	 (#xf7b5 . #xE0D0)
+	 (#xf7b6 . #xE0D1)
+	 (#xf7b7 . #xE0D2)
+	 (#xf7b8 . #xE0D3)
+	 (#xf7b9 . #xE0D4)
+	 (#xf7ba . #xE0D5)
+	 (#xf7bb . #xE0D6)
+	 (#xf7bc . #xE0D7)
+	 (#xf7bd . #xE0D8)
+	 (#xf7be . #xE0D9)
+	 (#xf7bf . #xE0DA)
+	 (#xf7c0 . #xE0DB)
+	 (#xf7c1 . #xE0DC)
+	 (#xf7c2 . #xE0DD)
+	 (#xf7c3 . #xE0DE)
+	 (#xf7c4 . #xE0DF)
+	 (#xf7c5 . #xE0E0)
+	 (#xf7c6 . #xE0E1)
+	 (#xf7c7 . #xE0E2)
+	 (#xf7c8 . #xE0E3)
+	 (#xf7c9 . #xE0E4)
+	 (#xf7ca . #xE0E5)
+	 (#xf7cb . #xE0E6)
+	 (#xf7cc . #xE0E7)
+	 (#xf7cd . #xE0E8)
+	 (#xf7ce . #xE0E9)
+	 (#xf7cf . #xE0EA)
+	 (#xf7d0 . #xE0EB)
+	 (#xf7d1 . #xE0EC)
+	 (#xf7d2 . #xE0ED)
+	 (#xf7d3 . #xE0EE)
+	 (#xf7d4 . #xE0EF)
+	 (#xf7d5 . #xE0F0)
+	 (#xf7d6 . #xE0F1)
+	 (#xf7d7 . #xE0F2)
+	 (#xf7d8 . #xE0F3)
+	 (#xf7d9 . #xE0F4)
+	 (#xf7da . #xE0F5)
+	 (#xf7db . #xE0F6)
+	 (#xf7dc . #xE0F7)
+	 (#xf7dd . #xE0F8)
+	 (#xf7de . #xE0F9)
+	 (#xf7df . #xE0FA)
+	 (#xf7e0 . #xE0FB)
+	 (#xf7e1 . #xE0FC)
+	 (#xf7e2 . #xE0FD)
+	 (#xf7e3 . #xE0FE)
+	 (#xf7e4 . #xE0FF)
+	 (#xf7e5 . #xE100)
+	 (#xf7e6 . #xE101)
+	 (#xf7e7 . #xE102)
+	 (#xf7e8 . #xE103)
+	 (#xf7e9 . #xE104)
+	 (#xf7ea . #xE105)
+	 (#xf7eb . #xE106)
+	 (#xf7ec . #xE107)
+	 (#xf7ed . #xE108)
+	 (#xf7ee . #xE109)
+	 (#xf7ef . #xE10A)
+	 (#xf7f0 . #xE10B)
+	 (#xf7f1 . #xE10C)
+	 (#xf7f2 . #xE10D)
+	 (#xf7f3 . #xE10E)
+	 (#xf7f4 . #xE10F)
+	 (#xf7f5 . #xE110)
+	 (#xf7f6 . #xE111)
+	 (#xf7f7 . #xE112)
+	 (#xf7f8 . #xE113)
+	 (#xf7f9 . #xE114)
+	 (#xf7fa . #xE115)
+	 (#xf7fb . #xE116)
+	 (#xf7fc . #xE117)
+	 (#xf7fd . #xE118)
+	 (#xf7fe . #xE119)
+	 (#xf8a1 . #xE11A)
+	 (#xf8a2 . #xE11B)
+	 (#xf8a3 . #xE11C)
+	 (#xf8a4 . #xE11D)
+	 (#xf8a5 . #xE11E)
+	 (#xf8a6 . #xE11F)
+	 (#xf8a7 . #xE120)
+	 (#xf8a8 . #xE121)
+	 (#xf8a9 . #xE122)
+	 (#xf8aa . #xE123)
+	 (#xf8ab . #xE124)
+	 (#xf8ac . #xE125)
+	 (#xf8ad . #xE126)
+	 (#xf8ae . #xE127)
+	 (#xf8af . #xE128)
+	 (#xf8b0 . #xE129)
+	 (#xf8b1 . #xE12A)
+	 (#xf8b2 . #xE12B)
+	 (#xf8b3 . #xE12C)
+	 (#xf8b4 . #xE12D)
+	 (#xf8b5 . #xE12E)
+	 (#xf8b6 . #xE12F)
+	 (#xf8b7 . #xE130)
+	 (#xf8b8 . #xE131)
+	 (#xf8b9 . #xE132)
+	 (#xf8ba . #xE133)
+	 (#xf8bb . #xE134)
+	 (#xf8bc . #xE135)
+	 (#xf8bd . #xE136)
+	 (#xf8be . #xE137)
+	 (#xf8bf . #xE138)
+	 (#xf8c0 . #xE139)
+	 (#xf8c1 . #xE13A)
+	 (#xf8c2 . #xE13B)
+	 (#xf8c3 . #xE13C)
+	 (#xf8c4 . #xE13D)
+	 (#xf8c5 . #xE13E)
+	 (#xf8c6 . #xE13F)
+	 (#xf8c7 . #xE140)
+	 (#xf8c8 . #xE141)
+	 (#xf8c9 . #xE142)
+	 (#xf8ca . #xE143)
+	 (#xf8cb . #xE144)
+	 (#xf8cc . #xE145)
+	 (#xf8cd . #xE146)
+	 (#xf8ce . #xE147)
+	 (#xf8cf . #xE148)
+	 (#xf8d0 . #xE149)
+	 (#xf8d1 . #xE14A)
+	 (#xf8d2 . #xE14B)
+	 (#xf8d3 . #xE14C)
+	 (#xf8d4 . #xE14D)
+	 (#xf8d5 . #xE14E)
+	 (#xf8d6 . #xE14F)
+	 (#xf8d7 . #xE150)
+	 (#xf8d8 . #xE151)
+	 (#xf8d9 . #xE152)
+	 (#xf8da . #xE153)
+	 (#xf8db . #xE154)
+	 (#xf8dc . #xE155)
+	 (#xf8dd . #xE156)
+	 (#xf8de . #xE157)
+	 (#xf8df . #xE158)
+	 (#xf8e0 . #xE159)
+	 (#xf8e1 . #xE15A)
+	 (#xf8e2 . #xE15B)
+	 (#xf8e3 . #xE15C)
+	 (#xf8e4 . #xE15D)
+	 (#xf8e5 . #xE15E)
+	 (#xf8e6 . #xE15F)
+	 (#xf8e7 . #xE160)
+	 (#xf8e8 . #xE161)
+	 (#xf8e9 . #xE162)
+	 (#xf8ea . #xE163)
+	 (#xf8eb . #xE164)
+	 (#xf8ec . #xE165)
+	 (#xf8ed . #xE166)
+	 (#xf8ee . #xE167)
+	 (#xf8ef . #xE168)
+	 (#xf8f0 . #xE169)
+	 (#xf8f1 . #xE16A)
+	 (#xf8f2 . #xE16B)
+	 (#xf8f3 . #xE16C)
+	 (#xf8f4 . #xE16D)
+	 (#xf8f5 . #xE16E)
+	 (#xf8f6 . #xE16F)
+	 (#xf8f7 . #xE170)
+	 (#xf8f8 . #xE171)
+	 (#xf8f9 . #xE172)
+	 (#xf8fa . #xE173)
+	 (#xf8fb . #xE174)
+	 (#xf8fc . #xE175)
+	 (#xf8fd . #xE176)
+	 (#xf8fe . #xE177)
+	 (#xf9a1 . #xE178)
+	 (#xf9a2 . #xE179)
+	 (#xf9a3 . #xE17A)
+	 (#xf9a4 . #xE17B)
+	 (#xf9a5 . #xE17C)
+	 (#xf9a6 . #xE17D)
+	 (#xf9a7 . #xE17E)
+	 (#xf9a8 . #xE17F)
+	 (#xf9a9 . #xE180)
+	 (#xf9aa . #xE181)
+	 (#xf9ab . #xE182)
+	 (#xf9ac . #xE183)
+	 (#xf9ad . #xE184)
+	 (#xf9ae . #xE185)
+	 (#xf9af . #xE186)
+	 (#xf9b0 . #xE187)
+	 (#xf9b1 . #xE188)
+	 (#xf9b2 . #xE189)
+	 (#xf9b3 . #xE18A)
+	 (#xf9b4 . #xE18B)
+	 (#xf9b5 . #xE18C)
+	 (#xf9b6 . #xE18D)
+	 (#xf9b7 . #xE18E)
+	 (#xf9b8 . #xE18F)
+	 (#xf9b9 . #xE190)
+	 (#xf9ba . #xE191)
+	 (#xf9bb . #xE192)
+	 (#xf9bc . #xE193)
+	 (#xf9bd . #xE194)
+	 (#xf9be . #xE195)
+	 (#xf9bf . #xE196)
+	 (#xf9c0 . #xE197)
+	 (#xf9c1 . #xE198)
+	 (#xf9c2 . #xE199)
+	 (#xf9c3 . #xE19A)
+	 (#xf9c4 . #xE19B)
+	 (#xf9c5 . #xE19C)
+	 (#xf9c6 . #xE19D)
+	 (#xf9c7 . #xE19E)
+	 (#xf9c8 . #xE19F)
+	 (#xf9c9 . #xE1A0)
+	 (#xf9ca . #xE1A1)
+	 (#xf9cb . #xE1A2)
+	 (#xf9cc . #xE1A3)
+	 (#xf9cd . #xE1A4)
+	 (#xf9ce . #xE1A5)
+	 (#xf9cf . #xE1A6)
+	 (#xf9d0 . #xE1A7)
+	 (#xf9d1 . #xE1A8)
+	 (#xf9d2 . #xE1A9)
+	 (#xf9d3 . #xE1AA)
+	 (#xf9d4 . #xE1AB)
+	 (#xf9d5 . #xE1AC)
+	 (#xf9d6 . #xE1AD)
+	 (#xf9d7 . #xE1AE)
+	 (#xf9d8 . #xE1AF)
+	 (#xf9d9 . #xE1B0)
+	 (#xf9da . #xE1B1)
+	 (#xf9db . #xE1B2)
+	 (#xf9dc . #xE1B3)
+	 (#xf9dd . #xE1B4)
+	 (#xf9de . #xE1B5)
+	 (#xf9df . #xE1B6)
+	 (#xf9e0 . #xE1B7)
+	 (#xf9e1 . #xE1B8)
+	 (#xf9e2 . #xE1B9)
+	 (#xf9e3 . #xE1BA)
+	 (#xf9e4 . #xE1BB)
+	 (#xf9e5 . #xE1BC)
+	 (#xf9e6 . #xE1BD)
+	 (#xf9e7 . #xE1BE)
+	 (#xf9e8 . #xE1BF)
+	 (#xf9e9 . #xE1C0)
+	 (#xf9ea . #xE1C1)
+	 (#xf9eb . #xE1C2)
+	 (#xf9ec . #xE1C3)
+	 (#xf9ed . #xE1C4)
+	 (#xf9ee . #xE1C5)
+	 (#xf9ef . #xE1C6)
+	 (#xf9f0 . #xE1C7)
+	 (#xf9f1 . #xE1C8)
+	 (#xf9f2 . #xE1C9)
+	 (#xf9f3 . #xE1CA)
+	 (#xf9f4 . #xE1CB)
+	 (#xf9f5 . #xE1CC)
+	 (#xf9f6 . #xE1CD)
+	 (#xf9f7 . #xE1CE)
+	 (#xf9f8 . #xE1CF)
+	 (#xf9f9 . #xE1D0)
+	 (#xf9fa . #xE1D1)
+	 (#xf9fb . #xE1D2)
+	 (#xf9fc . #xE1D3)
+	 (#xf9fd . #xE1D4)
+	 (#xf9fe . #xE1D5)
+	 (#xfaa1 . #xE1D6)
+	 (#xfaa2 . #xE1D7)
+	 (#xfaa3 . #xE1D8)
+	 (#xfaa4 . #xE1D9)
+	 (#xfaa5 . #xE1DA)
+	 (#xfaa6 . #xE1DB)
+	 (#xfaa7 . #xE1DC)
+	 (#xfaa8 . #xE1DD)
+	 (#xfaa9 . #xE1DE)
+	 (#xfaaa . #xE1DF)
+	 (#xfaab . #xE1E0)
+	 (#xfaac . #xE1E1)
+	 (#xfaad . #xE1E2)
+	 (#xfaae . #xE1E3)
+	 (#xfaaf . #xE1E4)
+	 (#xfab0 . #xE1E5)
+	 (#xfab1 . #xE1E6)
+	 (#xfab2 . #xE1E7)
+	 (#xfab3 . #xE1E8)
+	 (#xfab4 . #xE1E9)
+	 (#xfab5 . #xE1EA)
+	 (#xfab6 . #xE1EB)
+	 (#xfab7 . #xE1EC)
+	 (#xfab8 . #xE1ED)
+	 (#xfab9 . #xE1EE)
+	 (#xfaba . #xE1EF)
+	 (#xfabb . #xE1F0)
+	 (#xfabc . #xE1F1)
+	 (#xfabd . #xE1F2)
+	 (#xfabe . #xE1F3)
+	 (#xfabf . #xE1F4)
+	 (#xfac0 . #xE1F5)
+	 (#xfac1 . #xE1F6)
+	 (#xfac2 . #xE1F7)
+	 (#xfac3 . #xE1F8)
+	 (#xfac4 . #xE1F9)
+	 (#xfac5 . #xE1FA)
+	 (#xfac6 . #xE1FB)
+	 (#xfac7 . #xE1FC)
+	 (#xfac8 . #xE1FD)
+	 (#xfac9 . #xE1FE)
+	 (#xfaca . #xE1FF)
+	 (#xfacb . #xE200)
+	 (#xfacc . #xE201)
+	 (#xfacd . #xE202)
+	 (#xface . #xE203)
+	 (#xfacf . #xE204)
+	 (#xfad0 . #xE205)
+	 (#xfad1 . #xE206)
+	 (#xfad2 . #xE207)
+	 (#xfad3 . #xE208)
+	 (#xfad4 . #xE209)
+	 (#xfad5 . #xE20A)
+	 (#xfad6 . #xE20B)
+	 (#xfad7 . #xE20C)
+	 (#xfad8 . #xE20D)
+	 (#xfad9 . #xE20E)
+	 (#xfada . #xE20F)
+	 (#xfadb . #xE210)
+	 (#xfadc . #xE211)
+	 (#xfadd . #xE212)
+	 (#xfade . #xE213)
+	 (#xfadf . #xE214)
+	 (#xfae0 . #xE215)
+	 (#xfae1 . #xE216)
+	 (#xfae2 . #xE217)
+	 (#xfae3 . #xE218)
+	 (#xfae4 . #xE219)
+	 (#xfae5 . #xE21A)
+	 (#xfae6 . #xE21B)
+	 (#xfae7 . #xE21C)
+	 (#xfae8 . #xE21D)
+	 (#xfae9 . #xE21E)
+	 (#xfaea . #xE21F)
+	 (#xfaeb . #xE220)
+	 (#xfaec . #xE221)
+	 (#xfaed . #xE222)
+	 (#xfaee . #xE223)
+	 (#xfaef . #xE224)
+	 (#xfaf0 . #xE225)
+	 (#xfaf1 . #xE226)
+	 (#xfaf2 . #xE227)
+	 (#xfaf3 . #xE228)
+	 (#xfaf4 . #xE229)
+	 (#xfaf5 . #xE22A)
+	 (#xfaf6 . #xE22B)
+	 (#xfaf7 . #xE22C)
+	 (#xfaf8 . #xE22D)
+	 (#xfaf9 . #xE22E)
+	 (#xfafa . #xE22F)
+	 (#xfafb . #xE230)
+	 (#xfafc . #xE231)
+	 (#xfafd . #xE232)
+	 (#xfafe . #xE233)
+	 (#xfba1 . #xE234)
+	 (#xfba2 . #xE235)
+	 (#xfba3 . #xE236)
+	 (#xfba4 . #xE237)
+	 (#xfba5 . #xE238)
+	 (#xfba6 . #xE239)
+	 (#xfba7 . #xE23A)
+	 (#xfba8 . #xE23B)
+	 (#xfba9 . #xE23C)
+	 (#xfbaa . #xE23D)
+	 (#xfbab . #xE23E)
+	 (#xfbac . #xE23F)
+	 (#xfbad . #xE240)
+	 (#xfbae . #xE241)
+	 (#xfbaf . #xE242)
+	 (#xfbb0 . #xE243)
+	 (#xfbb1 . #xE244)
+	 (#xfbb2 . #xE245)
+	 (#xfbb3 . #xE246)
+	 (#xfbb4 . #xE247)
+	 (#xfbb5 . #xE248)
+	 (#xfbb6 . #xE249)
+	 (#xfbb7 . #xE24A)
+	 (#xfbb8 . #xE24B)
+	 (#xfbb9 . #xE24C)
+	 (#xfbba . #xE24D)
+	 (#xfbbb . #xE24E)
+	 (#xfbbc . #xE24F)
+	 (#xfbbd . #xE250)
+	 (#xfbbe . #xE251)
+	 (#xfbbf . #xE252)
+	 (#xfbc0 . #xE253)
+	 (#xfbc1 . #xE254)
+	 (#xfbc2 . #xE255)
+	 (#xfbc3 . #xE256)
+	 (#xfbc4 . #xE257)
+	 (#xfbc5 . #xE258)
+	 (#xfbc6 . #xE259)
+	 (#xfbc7 . #xE25A)
+	 (#xfbc8 . #xE25B)
+	 (#xfbc9 . #xE25C)
+	 (#xfbca . #xE25D)
+	 (#xfbcb . #xE25E)
+	 (#xfbcc . #xE25F)
+	 (#xfbcd . #xE260)
+	 (#xfbce . #xE261)
+	 (#xfbcf . #xE262)
+	 (#xfbd0 . #xE263)
+	 (#xfbd1 . #xE264)
+	 (#xfbd2 . #xE265)
+	 (#xfbd3 . #xE266)
+	 (#xfbd4 . #xE267)
+	 (#xfbd5 . #xE268)
+	 (#xfbd6 . #xE269)
+	 (#xfbd7 . #xE26A)
+	 (#xfbd8 . #xE26B)
+	 (#xfbd9 . #xE26C)
+	 (#xfbda . #xE26D)
+	 (#xfbdb . #xE26E)
+	 (#xfbdc . #xE26F)
+	 (#xfbdd . #xE270)
+	 (#xfbde . #xE271)
+	 (#xfbdf . #xE272)
+	 (#xfbe0 . #xE273)
+	 (#xfbe1 . #xE274)
+	 (#xfbe2 . #xE275)
+	 (#xfbe3 . #xE276)
+	 (#xfbe4 . #xE277)
+	 (#xfbe5 . #xE278)
+	 (#xfbe6 . #xE279)
+	 (#xfbe7 . #xE27A)
+	 (#xfbe8 . #xE27B)
+	 (#xfbe9 . #xE27C)
+	 (#xfbea . #xE27D)
+	 (#xfbeb . #xE27E)
+	 (#xfbec . #xE27F)
+	 (#xfbed . #xE280)
+	 (#xfbee . #xE281)
+	 (#xfbef . #xE282)
+	 (#xfbf0 . #xE283)
+	 (#xfbf1 . #xE284)
+	 (#xfbf2 . #xE285)
+	 (#xfbf3 . #xE286)
+	 (#xfbf4 . #xE287)
+	 (#xfbf5 . #xE288)
+	 (#xfbf6 . #xE289)
+	 (#xfbf7 . #xE28A)
+	 (#xfbf8 . #xE28B)
+	 (#xfbf9 . #xE28C)
+	 (#xfbfa . #xE28D)
+	 (#xfbfb . #xE28E)
+	 (#xfbfc . #xE28F)
+	 (#xfbfd . #xE290)
+	 (#xfbfe . #xE291)
+	 (#xfca1 . #xE292)
+	 (#xfca2 . #xE293)
+	 (#xfca3 . #xE294)
+	 (#xfca4 . #xE295)
+	 (#xfca5 . #xE296)
+	 (#xfca6 . #xE297)
+	 (#xfca7 . #xE298)
+	 (#xfca8 . #xE299)
+	 (#xfca9 . #xE29A)
+	 (#xfcaa . #xE29B)
+	 (#xfcab . #xE29C)
+	 (#xfcac . #xE29D)
+	 (#xfcad . #xE29E)
+	 (#xfcae . #xE29F)
+	 (#xfcaf . #xE2A0)
+	 (#xfcb0 . #xE2A1)
+	 (#xfcb1 . #xE2A2)
+	 (#xfcb2 . #xE2A3)
+	 (#xfcb3 . #xE2A4)
+	 (#xfcb4 . #xE2A5)
+	 (#xfcb5 . #xE2A6)
+	 (#xfcb6 . #xE2A7)
+	 (#xfcb7 . #xE2A8)
+	 (#xfcb8 . #xE2A9)
+	 (#xfcb9 . #xE2AA)
+	 (#xfcba . #xE2AB)
+	 (#xfcbb . #xE2AC)
+	 (#xfcbc . #xE2AD)
+	 (#xfcbd . #xE2AE)
+	 (#xfcbe . #xE2AF)
+	 (#xfcbf . #xE2B0)
+	 (#xfcc0 . #xE2B1)
+	 (#xfcc1 . #xE2B2)
+	 (#xfcc2 . #xE2B3)
+	 (#xfcc3 . #xE2B4)
+	 (#xfcc4 . #xE2B5)
+	 (#xfcc5 . #xE2B6)
+	 (#xfcc6 . #xE2B7)
+	 (#xfcc7 . #xE2B8)
+	 (#xfcc8 . #xE2B9)
+	 (#xfcc9 . #xE2BA)
+	 (#xfcca . #xE2BB)
+	 (#xfccb . #xE2BC)
+	 (#xfccc . #xE2BD)
+	 (#xfccd . #xE2BE)
+	 (#xfcce . #xE2BF)
+	 (#xfccf . #xE2C0)
+	 (#xfcd0 . #xE2C1)
+	 (#xfcd1 . #xE2C2)
+	 (#xfcd2 . #xE2C3)
+	 (#xfcd3 . #xE2C4)
+	 (#xfcd4 . #xE2C5)
+	 (#xfcd5 . #xE2C6)
+	 (#xfcd6 . #xE2C7)
+	 (#xfcd7 . #xE2C8)
+	 (#xfcd8 . #xE2C9)
+	 (#xfcd9 . #xE2CA)
+	 (#xfcda . #xE2CB)
+	 (#xfcdb . #xE2CC)
+	 (#xfcdc . #xE2CD)
+	 (#xfcdd . #xE2CE)
+	 (#xfcde . #xE2CF)
+	 (#xfcdf . #xE2D0)
+	 (#xfce0 . #xE2D1)
+	 (#xfce1 . #xE2D2)
+	 (#xfce2 . #xE2D3)
+	 (#xfce3 . #xE2D4)
+	 (#xfce4 . #xE2D5)
+	 (#xfce5 . #xE2D6)
+	 (#xfce6 . #xE2D7)
+	 (#xfce7 . #xE2D8)
+	 (#xfce8 . #xE2D9)
+	 (#xfce9 . #xE2DA)
+	 (#xfcea . #xE2DB)
+	 (#xfceb . #xE2DC)
+	 (#xfcec . #xE2DD)
+	 (#xfced . #xE2DE)
+	 (#xfcee . #xE2DF)
+	 (#xfcef . #xE2E0)
+	 (#xfcf0 . #xE2E1)
+	 (#xfcf1 . #xE2E2)
+	 (#xfcf2 . #xE2E3)
+	 (#xfcf3 . #xE2E4)
+	 (#xfcf4 . #xE2E5)
+	 (#xfcf5 . #xE2E6)
+	 (#xfcf6 . #xE2E7)
+	 (#xfcf7 . #xE2E8)
+	 (#xfcf8 . #xE2E9)
+	 (#xfcf9 . #xE2EA)
+	 (#xfcfa . #xE2EB)
+	 (#xfcfb . #xE2EC)
+	 (#xfcfc . #xE2ED)
+	 (#xfcfd . #xE2EE)
+	 (#xfcfe . #xE2EF)
+	 (#xfda1 . #xE2F0)
+	 (#xfda2 . #xE2F1)
+	 (#xfda3 . #xE2F2)
+	 (#xfda4 . #xE2F3)
+	 (#xfda5 . #xE2F4)
+	 (#xfda6 . #xE2F5)
+	 (#xfda7 . #xE2F6)
+	 (#xfda8 . #xE2F7)
+	 (#xfda9 . #xE2F8)
+	 (#xfdaa . #xE2F9)
+	 (#xfdab . #xE2FA)
+	 (#xfdac . #xE2FB)
+	 (#xfdad . #xE2FC)
+	 (#xfdae . #xE2FD)
+	 (#xfdaf . #xE2FE)
+	 (#xfdb0 . #xE2FF)
+	 (#xfdb1 . #xE300)
+	 (#xfdb2 . #xE301)
+	 (#xfdb3 . #xE302)
+	 (#xfdb4 . #xE303)
+	 (#xfdb5 . #xE304)
+	 (#xfdb6 . #xE305)
+	 (#xfdb7 . #xE306)
+	 (#xfdb8 . #xE307)
+	 (#xfdb9 . #xE308)
+	 (#xfdba . #xE309)
+	 (#xfdbb . #xE30A)
+	 (#xfdbc . #xE30B)
+	 (#xfdbd . #xE30C)
+	 (#xfdbe . #xE30D)
+	 (#xfdbf . #xE30E)
+	 (#xfdc0 . #xE30F)
+	 (#xfdc1 . #xE310)
+	 (#xfdc2 . #xE311)
+	 (#xfdc3 . #xE312)
+	 (#xfdc4 . #xE313)
+	 (#xfdc5 . #xE314)
+	 (#xfdc6 . #xE315)
+	 (#xfdc7 . #xE316)
+	 (#xfdc8 . #xE317)
+	 (#xfdc9 . #xE318)
+	 (#xfdca . #xE319)
+	 (#xfdcb . #xE31A)
+	 (#xfdcc . #xE31B)
+	 (#xfdcd . #xE31C)
+	 (#xfdce . #xE31D)
+	 (#xfdcf . #xE31E)
+	 (#xfdd0 . #xE31F)
+	 (#xfdd1 . #xE320)
+	 (#xfdd2 . #xE321)
+	 (#xfdd3 . #xE322)
+	 (#xfdd4 . #xE323)
+	 (#xfdd5 . #xE324)
+	 (#xfdd6 . #xE325)
+	 (#xfdd7 . #xE326)
+	 (#xfdd8 . #xE327)
+	 (#xfdd9 . #xE328)
+	 (#xfdda . #xE329)
+	 (#xfddb . #xE32A)
+	 (#xfddc . #xE32B)
+	 (#xfddd . #xE32C)
+	 (#xfdde . #xE32D)
+	 (#xfddf . #xE32E)
+	 (#xfde0 . #xE32F)
+	 (#xfde1 . #xE330)
+	 (#xfde2 . #xE331)
+	 (#xfde3 . #xE332)
+	 (#xfde4 . #xE333)
+	 (#xfde5 . #xE334)
+	 (#xfde6 . #xE335)
+	 (#xfde7 . #xE336)
+	 (#xfde8 . #xE337)
+	 (#xfde9 . #xE338)
+	 (#xfdea . #xE339)
+	 (#xfdeb . #xE33A)
+	 (#xfdec . #xE33B)
+	 (#xfded . #xE33C)
+	 (#xfdee . #xE33D)
+	 (#xfdef . #xE33E)
+	 (#xfdf0 . #xE33F)
+	 (#xfdf1 . #xE340)
+	 (#xfdf2 . #xE341)
+	 (#xfdf3 . #xE342)
+	 (#xfdf4 . #xE343)
+	 (#xfdf5 . #xE344)
+	 (#xfdf6 . #xE345)
+	 (#xfdf7 . #xE346)
+	 (#xfdf8 . #xE347)
+	 (#xfdf9 . #xE348)
+	 (#xfdfa . #xE349)
+	 (#xfdfb . #xE34A)
+	 (#xfdfc . #xE34B)
+	 (#xfdfd . #xE34C)
+	 (#xfdfe . #xE34D)
+	 (#xfea1 . #xE34E)
+	 (#xfea2 . #xE34F)
+	 (#xfea3 . #xE350)
+	 (#xfea4 . #xE351)
+	 (#xfea5 . #xE352)
+	 (#xfea6 . #xE353)
+	 (#xfea7 . #xE354)
+	 (#xfea8 . #xE355)
+	 (#xfea9 . #xE356)
+	 (#xfeaa . #xE357)
+	 (#xfeab . #xE358)
+	 (#xfeac . #xE359)
+	 (#xfead . #xE35A)
+	 (#xfeae . #xE35B)
+	 (#xfeaf . #xE35C)
+	 (#xfeb0 . #xE35D)
+	 (#xfeb1 . #xE35E)
+	 (#xfeb2 . #xE35F)
+	 (#xfeb3 . #xE360)
+	 (#xfeb4 . #xE361)
+	 (#xfeb5 . #xE362)
+	 (#xfeb6 . #xE363)
+	 (#xfeb7 . #xE364)
+	 (#xfeb8 . #xE365)
+	 (#xfeb9 . #xE366)
+	 (#xfeba . #xE367)
+	 (#xfebb . #xE368)
+	 (#xfebc . #xE369)
+	 (#xfebd . #xE36A)
+	 (#xfebe . #xE36B)
+	 (#xfebf . #xE36C)
+	 (#xfec0 . #xE36D)
+	 (#xfec1 . #xE36E)
+	 (#xfec2 . #xE36F)
+	 (#xfec3 . #xE370)
+	 (#xfec4 . #xE371)
+	 (#xfec5 . #xE372)
+	 (#xfec6 . #xE373)
+	 (#xfec7 . #xE374)
+	 (#xfec8 . #xE375)
+	 (#xfec9 . #xE376)
+	 (#xfeca . #xE377)
+	 (#xfecb . #xE378)
+	 (#xfecc . #xE379)
+	 (#xfecd . #xE37A)
+	 (#xfece . #xE37B)
+	 (#xfecf . #xE37C)
+	 (#xfed0 . #xE37D)
+	 (#xfed1 . #xE37E)
+	 (#xfed2 . #xE37F)
+	 (#xfed3 . #xE380)
+	 (#xfed4 . #xE381)
+	 (#xfed5 . #xE382)
+	 (#xfed6 . #xE383)
+	 (#xfed7 . #xE384)
+	 (#xfed8 . #xE385)
+	 (#xfed9 . #xE386)
+	 (#xfeda . #xE387)
+	 (#xfedb . #xE388)
+	 (#xfedc . #xE389)
+	 (#xfedd . #xE38A)
+	 (#xfede . #xE38B)
+	 (#xfedf . #xE38C)
+	 (#xfee0 . #xE38D)
+	 (#xfee1 . #xE38E)
+	 (#xfee2 . #xE38F)
+	 (#xfee3 . #xE390)
+	 (#xfee4 . #xE391)
+	 (#xfee5 . #xE392)
+	 (#xfee6 . #xE393)
+	 (#xfee7 . #xE394)
+	 (#xfee8 . #xE395)
+	 (#xfee9 . #xE396)
+	 (#xfeea . #xE397)
+	 (#xfeeb . #xE398)
+	 (#xfeec . #xE399)
+	 (#xfeed . #xE39A)
+	 (#xfeee . #xE39B)
+	 (#xfeef . #xE39C)
+	 (#xfef0 . #xE39D)
+	 (#xfef1 . #xE39E)
+	 (#xfef2 . #xE39F)
+	 (#xfef3 . #xE3A0)
+	 (#xfef4 . #xE3A1)
+	 (#xfef5 . #xE3A2)
+	 (#xfef6 . #xE3A3)
+	 (#xfef7 . #xE3A4)
+	 (#xfef8 . #xE3A5)
+	 (#xfef9 . #xE3A6)
+	 (#xfefa . #xE3A7)
+	 (#xfefb . #xE3A8)
+	 (#xfefc . #xE3A9)
+	 (#xfefd . #xE3AA)
+	 (#xfefe . #xE3AB)
+	 (#xf3f3 #x2170)
+	 (#xf3f4 #x2171)
+	 (#xf3f5 #x2172)
+	 (#xf3f6 #x2173)
+	 (#xf3f7 #x2174)
+	 (#xf3f8 #x2175)
+	 (#xf3f9 #x2176)
+	 (#xf3fa #x2177)
+	 (#xf3fb #x2178)
+	 (#xf3fc #x2179)
+	 (#xf3fd #x2160)
+	 (#xf3fe #x2161)
+	 (#xf4a1 #x2162)
+	 (#xf4a2 #x2163)
+	 (#xf4a3 #x2164)
+	 (#xf4a4 #x2165)
+	 (#xf4a5 #x2166)
+	 (#xf4a6 #x2167)
+	 (#xf4a7 #x2168)
+	 (#xf4a8 #x2169)
+	 (#xf4a9 #xFF07)
+	 (#xf4aa #xFF02)
+	 (#xf4ab #x3231)
+	 (#xf4ac #x2116)
+	 (#xf4ad #x2121)
+	 (#xf4ae #x70BB)
+	 (#xf4af #x4EFC)
+	 (#xf4b0 #x50F4)
+	 (#xf4b1 #x51EC)
+	 (#xf4b2 #x5307)
+	 (#xf4b3 #x5324)
+	 (#xf4b4 #xFA0E)
+	 (#xf4b5 #x548A)
+	 (#xf4b6 #x5759)
+	 (#xf4b7 #xFA0F)
+	 (#xf4b8 #xFA10)
+	 (#xf4b9 #x589E)
+	 (#xf4ba #x5BEC)
+	 (#xf4bb #x5CF5)
+	 (#xf4bc #x5D53)
+	 (#xf4bd #xFA11)
+	 (#xf4be #x5FB7)
+	 (#xf4bf #x6085)
+	 (#xf4c0 #x6120)
+	 (#xf4c1 #x654E)
+	 (#xf4c2 #x663B)
+	 (#xf4c3 #x6665)
+	 (#xf4c4 #xFA12)
+	 (#xf4c5 #xF929)
+	 (#xf4c6 #x6801)
+	 (#xf4c7 #xFA13)
+	 (#xf4c8 #xFA14)
+	 (#xf4c9 #x6A6B)
+	 (#xf4ca #x6AE2)
+	 (#xf4cb #x6DF8)
+	 (#xf4cc #x6DF2)
+	 (#xf4cd #x7028)
+	 (#xf4ce #xFA15)
+	 (#xf4cf #xFA16)
+	 (#xf4d0 #x7501)
+	 (#xf4d1 #x7682)
+	 (#xf4d2 #x769E)
+	 (#xf4d3 #xFA17)
+	 (#xf4d4 #x7930)
+	 (#xf4d5 #xFA18)
+	 (#xf4d6 #xFA19)
+	 (#xf4d7 #xFA1A)
+	 (#xf4d8 #xFA1B)
+	 (#xf4d9 #x7AE7)
+	 (#xf4da #xFA1C)
+	 (#xf4db #xFA1D)
+	 (#xf4dc #x7DA0)
+	 (#xf4dd #x7DD6)
+	 (#xf4de #xFA1E)
+	 (#xf4df #x8362)
+	 (#xf4e0 #xFA1F)
+	 (#xf4e1 #x85B0)
+	 (#xf4e2 #xFA20)
+	 (#xf4e3 #xFA21)
+	 (#xf4e4 #x8807)
+	 (#xf4e5 #xFA22)
+	 (#xf4e6 #x8B7F)
+	 (#xf4e7 #x8CF4)
+	 (#xf4e8 #x8D76)
+	 (#xf4e9 #xFA23)
+	 (#xf4ea #xFA24)
+	 (#xf4eb #xFA25)
+	 (#xf4ec #x90DE)
+	 (#xf4ed #xFA26)
+	 (#xf4ee #x9115)
+	 (#xf4ef #xFA27)
+	 (#xf4f0 #xFA28)
+	 (#xf4f1 #x9592)
+	 (#xf4f2 #xF9DC)
+	 (#xf4f3 #xFA29)
+	 (#xf4f4 #x973B)
+	 (#xf4f5 #x974D)
+	 (#xf4f6 #x9751)
+	 (#xf4f7 #xFA2A)
+	 (#xf4f8 #xFA2B)
+	 (#xf4f9 #xFA2C)
+	 (#xf4fa #x999E)
+	 (#xf4fb #x9AD9)
+	 (#xf4fc #x9B72)
+	 (#xf4fd #xFA2D)
+	 (#xf4fe #x9ED1)
+	 (#xf5a1 #xE3AC)
+	 (#xf5a2 #xE3AD)
+	 (#xf5a3 #xE3AE)
+	 (#xf5a4 #xE3AF)
+	 (#xf5a5 #xE3B0)
+	 (#xf5a6 #xE3B1)
+	 (#xf5a7 #xE3B2)
+	 (#xf5a8 #xE3B3)
+	 (#xf5a9 #xE3B4)
+	 (#xf5aa #xE3B5)
+	 (#xf5ab #xE3B6)
+	 (#xf5ac #xE3B7)
+	 (#xf5ad #xE3B8)
+	 (#xf5ae #xE3B9)
+	 (#xf5af #xE3BA)
+	 (#xf5b0 #xE3BB)
+	 (#xf5b1 #xE3BC)
+	 (#xf5b2 #xE3BD)
+	 (#xf5b3 #xE3BE)
+	 (#xf5b4 #xE3BF)
+	 (#xf5b5 #xE3C0)
+	 (#xf5b6 #xE3C1)
+	 (#xf5b7 #xE3C2)
+	 (#xf5b8 #xE3C3)
+	 (#xf5b9 #xE3C4)
+	 (#xf5ba #xE3C5)
+	 (#xf5bb #xE3C6)
+	 (#xf5bc #xE3C7)
+	 (#xf5bd #xE3C8)
+	 (#xf5be #xE3C9)
+	 (#xf5bf #xE3CA)
+	 (#xf5c0 #xE3CB)
+	 (#xf5c1 #xE3CC)
+	 (#xf5c2 #xE3CD)
+	 (#xf5c3 #xE3CE)
+	 (#xf5c4 #xE3CF)
+	 (#xf5c5 #xE3D0)
+	 (#xf5c6 #xE3D1)
+	 (#xf5c7 #xE3D2)
+	 (#xf5c8 #xE3D3)
+	 (#xf5c9 #xE3D4)
+	 (#xf5ca #xE3D5)
+	 (#xf5cb #xE3D6)
+	 (#xf5cc #xE3D7)
+	 (#xf5cd #xE3D8)
+	 (#xf5ce #xE3D9)
+	 (#xf5cf #xE3DA)
+	 (#xf5d0 #xE3DB)
+	 (#xf5d1 #xE3DC)
+	 (#xf5d2 #xE3DD)
+	 (#xf5d3 #xE3DE)
+	 (#xf5d4 #xE3DF)
+	 (#xf5d5 #xE3E0)
+	 (#xf5d6 #xE3E1)
+	 (#xf5d7 #xE3E2)
+	 (#xf5d8 #xE3E3)
+	 (#xf5d9 #xE3E4)
+	 (#xf5da #xE3E5)
+	 (#xf5db #xE3E6)
+	 (#xf5dc #xE3E7)
+	 (#xf5dd #xE3E8)
+	 (#xf5de #xE3E9)
+	 (#xf5df #xE3EA)
+	 (#xf5e0 #xE3EB)
+	 (#xf5e1 #xE3EC)
+	 (#xf5e2 #xE3ED)
+	 (#xf5e3 #xE3EE)
+	 (#xf5e4 #xE3EF)
+	 (#xf5e5 #xE3F0)
+	 (#xf5e6 #xE3F1)
+	 (#xf5e7 #xE3F2)
+	 (#xf5e8 #xE3F3)
+	 (#xf5e9 #xE3F4)
+	 (#xf5ea #xE3F5)
+	 (#xf5eb #xE3F6)
+	 (#xf5ec #xE3F7)
+	 (#xf5ed #xE3F8)
+	 (#xf5ee #xE3F9)
+	 (#xf5ef #xE3FA)
+	 (#xf5f0 #xE3FB)
+	 (#xf5f1 #xE3FC)
+	 (#xf5f2 #xE3FD)
+	 (#xf5f3 #xE3FE)
+	 (#xf5f4 #xE3FF)
+	 (#xf5f5 #xE400)
+	 (#xf5f6 #xE401)
+	 (#xf5f7 #xE402)
+	 (#xf5f8 #xE403)
+	 (#xf5f9 #xE404)
+	 (#xf5fa #xE405)
+	 (#xf5fb #xE406)
+	 (#xf5fc #xE407)
+	 (#xf5fd #xE408)
+	 (#xf5fe #xE409)
+	 (#xf6a1 #xE40A)
+	 (#xf6a2 #xE40B)
+	 (#xf6a3 #xE40C)
+	 (#xf6a4 #xE40D)
+	 (#xf6a5 #xE40E)
+	 (#xf6a6 #xE40F)
+	 (#xf6a7 #xE410)
+	 (#xf6a8 #xE411)
+	 (#xf6a9 #xE412)
+	 (#xf6aa #xE413)
+	 (#xf6ab #xE414)
+	 (#xf6ac #xE415)
+	 (#xf6ad #xE416)
+	 (#xf6ae #xE417)
+	 (#xf6af #xE418)
+	 (#xf6b0 #xE419)
+	 (#xf6b1 #xE41A)
+	 (#xf6b2 #xE41B)
+	 (#xf6b3 #xE41C)
+	 (#xf6b4 #xE41D)
+	 (#xf6b5 #xE41E)
+	 (#xf6b6 #xE41F)
+	 (#xf6b7 #xE420)
+	 (#xf6b8 #xE421)
+	 (#xf6b9 #xE422)
+	 (#xf6ba #xE423)
+	 (#xf6bb #xE424)
+	 (#xf6bc #xE425)
+	 (#xf6bd #xE426)
+	 (#xf6be #xE427)
+	 (#xf6bf #xE428)
+	 (#xf6c0 #xE429)
+	 (#xf6c1 #xE42A)
+	 (#xf6c2 #xE42B)
+	 (#xf6c3 #xE42C)
+	 (#xf6c4 #xE42D)
+	 (#xf6c5 #xE42E)
+	 (#xf6c6 #xE42F)
+	 (#xf6c7 #xE430)
+	 (#xf6c8 #xE431)
+	 (#xf6c9 #xE432)
+	 (#xf6ca #xE433)
+	 (#xf6cb #xE434)
+	 (#xf6cc #xE435)
+	 (#xf6cd #xE436)
+	 (#xf6ce #xE437)
+	 (#xf6cf #xE438)
+	 (#xf6d0 #xE439)
+	 (#xf6d1 #xE43A)
+	 (#xf6d2 #xE43B)
+	 (#xf6d3 #xE43C)
+	 (#xf6d4 #xE43D)
+	 (#xf6d5 #xE43E)
+	 (#xf6d6 #xE43F)
+	 (#xf6d7 #xE440)
+	 (#xf6d8 #xE441)
+	 (#xf6d9 #xE442)
+	 (#xf6da #xE443)
+	 (#xf6db #xE444)
+	 (#xf6dc #xE445)
+	 (#xf6dd #xE446)
+	 (#xf6de #xE447)
+	 (#xf6df #xE448)
+	 (#xf6e0 #xE449)
+	 (#xf6e1 #xE44A)
+	 (#xf6e2 #xE44B)
+	 (#xf6e3 #xE44C)
+	 (#xf6e4 #xE44D)
+	 (#xf6e5 #xE44E)
+	 (#xf6e6 #xE44F)
+	 (#xf6e7 #xE450)
+	 (#xf6e8 #xE451)
+	 (#xf6e9 #xE452)
+	 (#xf6ea #xE453)
+	 (#xf6eb #xE454)
+	 (#xf6ec #xE455)
+	 (#xf6ed #xE456)
+	 (#xf6ee #xE457)
+	 (#xf6ef #xE458)
+	 (#xf6f0 #xE459)
+	 (#xf6f1 #xE45A)
+	 (#xf6f2 #xE45B)
+	 (#xf6f3 #xE45C)
+	 (#xf6f4 #xE45D)
+	 (#xf6f5 #xE45E)
+	 (#xf6f6 #xE45F)
+	 (#xf6f7 #xE460)
+	 (#xf6f8 #xE461)
+	 (#xf6f9 #xE462)
+	 (#xf6fa #xE463)
+	 (#xf6fb #xE464)
+	 (#xf6fc #xE465)
+	 (#xf6fd #xE466)
+	 (#xf6fe #xE467)
+	 (#xf7a1 #xE468)
+	 (#xf7a2 #xE469)
+	 (#xf7a3 #xE46A)
+	 (#xf7a4 #xE46B)
+	 (#xf7a5 #xE46C)
+	 (#xf7a6 #xE46D)
+	 (#xf7a7 #xE46E)
+	 (#xf7a8 #xE46F)
+	 (#xf7a9 #xE470)
+	 (#xf7aa #xE471)
+	 (#xf7ab #xE472)
+	 (#xf7ac #xE473)
+	 (#xf7ad #xE474)
+	 (#xf7ae #xE475)
+	 (#xf7af #xE476)
+	 (#xf7b0 #xE477)
+	 (#xf7b1 #xE478)
+	 (#xf7b2 #xE479)
+	 (#xf7b3 #xE47A)
+	 (#xf7b4 #xE47B)
+	 (#xf7b5 #xE47C)
+	 (#xf7b6 #xE47D)
+	 (#xf7b7 #xE47E)
+	 (#xf7b8 #xE47F)
+	 (#xf7b9 #xE480)
+	 (#xf7ba #xE481)
+	 (#xf7bb #xE482)
+	 (#xf7bc #xE483)
+	 (#xf7bd #xE484)
+	 (#xf7be #xE485)
+	 (#xf7bf #xE486)
+	 (#xf7c0 #xE487)
+	 (#xf7c1 #xE488)
+	 (#xf7c2 #xE489)
+	 (#xf7c3 #xE48A)
+	 (#xf7c4 #xE48B)
+	 (#xf7c5 #xE48C)
+	 (#xf7c6 #xE48D)
+	 (#xf7c7 #xE48E)
+	 (#xf7c8 #xE48F)
+	 (#xf7c9 #xE490)
+	 (#xf7ca #xE491)
+	 (#xf7cb #xE492)
+	 (#xf7cc #xE493)
+	 (#xf7cd #xE494)
+	 (#xf7ce #xE495)
+	 (#xf7cf #xE496)
+	 (#xf7d0 #xE497)
+	 (#xf7d1 #xE498)
+	 (#xf7d2 #xE499)
+	 (#xf7d3 #xE49A)
+	 (#xf7d4 #xE49B)
+	 (#xf7d5 #xE49C)
+	 (#xf7d6 #xE49D)
+	 (#xf7d7 #xE49E)
+	 (#xf7d8 #xE49F)
+	 (#xf7d9 #xE4A0)
+	 (#xf7da #xE4A1)
+	 (#xf7db #xE4A2)
+	 (#xf7dc #xE4A3)
+	 (#xf7dd #xE4A4)
+	 (#xf7de #xE4A5)
+	 (#xf7df #xE4A6)
+	 (#xf7e0 #xE4A7)
+	 (#xf7e1 #xE4A8)
+	 (#xf7e2 #xE4A9)
+	 (#xf7e3 #xE4AA)
+	 (#xf7e4 #xE4AB)
+	 (#xf7e5 #xE4AC)
+	 (#xf7e6 #xE4AD)
+	 (#xf7e7 #xE4AE)
+	 (#xf7e8 #xE4AF)
+	 (#xf7e9 #xE4B0)
+	 (#xf7ea #xE4B1)
+	 (#xf7eb #xE4B2)
+	 (#xf7ec #xE4B3)
+	 (#xf7ed #xE4B4)
+	 (#xf7ee #xE4B5)
+	 (#xf7ef #xE4B6)
+	 (#xf7f0 #xE4B7)
+	 (#xf7f1 #xE4B8)
+	 (#xf7f2 #xE4B9)
+	 (#xf7f3 #xE4BA)
+	 (#xf7f4 #xE4BB)
+	 (#xf7f5 #xE4BC)
+	 (#xf7f6 #xE4BD)
+	 (#xf7f7 #xE4BE)
+	 (#xf7f8 #xE4BF)
+	 (#xf7f9 #xE4C0)
+	 (#xf7fa #xE4C1)
+	 (#xf7fb #xE4C2)
+	 (#xf7fc #xE4C3)
+	 (#xf7fd #xE4C4)
+	 (#xf7fe #xE4C5)
+	 (#xf8a1 #xE4C6)
+	 (#xf8a2 #xE4C7)
+	 (#xf8a3 #xE4C8)
+	 (#xf8a4 #xE4C9)
+	 (#xf8a5 #xE4CA)
+	 (#xf8a6 #xE4CB)
+	 (#xf8a7 #xE4CC)
+	 (#xf8a8 #xE4CD)
+	 (#xf8a9 #xE4CE)
+	 (#xf8aa #xE4CF)
+	 (#xf8ab #xE4D0)
+	 (#xf8ac #xE4D1)
+	 (#xf8ad #xE4D2)
+	 (#xf8ae #xE4D3)
+	 (#xf8af #xE4D4)
+	 (#xf8b0 #xE4D5)
+	 (#xf8b1 #xE4D6)
+	 (#xf8b2 #xE4D7)
+	 (#xf8b3 #xE4D8)
+	 (#xf8b4 #xE4D9)
+	 (#xf8b5 #xE4DA)
+	 (#xf8b6 #xE4DB)
+	 (#xf8b7 #xE4DC)
+	 (#xf8b8 #xE4DD)
+	 (#xf8b9 #xE4DE)
+	 (#xf8ba #xE4DF)
+	 (#xf8bb #xE4E0)
+	 (#xf8bc #xE4E1)
+	 (#xf8bd #xE4E2)
+	 (#xf8be #xE4E3)
+	 (#xf8bf #xE4E4)
+	 (#xf8c0 #xE4E5)
+	 (#xf8c1 #xE4E6)
+	 (#xf8c2 #xE4E7)
+	 (#xf8c3 #xE4E8)
+	 (#xf8c4 #xE4E9)
+	 (#xf8c5 #xE4EA)
+	 (#xf8c6 #xE4EB)
+	 (#xf8c7 #xE4EC)
+	 (#xf8c8 #xE4ED)
+	 (#xf8c9 #xE4EE)
+	 (#xf8ca #xE4EF)
+	 (#xf8cb #xE4F0)
+	 (#xf8cc #xE4F1)
+	 (#xf8cd #xE4F2)
+	 (#xf8ce #xE4F3)
+	 (#xf8cf #xE4F4)
+	 (#xf8d0 #xE4F5)
+	 (#xf8d1 #xE4F6)
+	 (#xf8d2 #xE4F7)
+	 (#xf8d3 #xE4F8)
+	 (#xf8d4 #xE4F9)
+	 (#xf8d5 #xE4FA)
+	 (#xf8d6 #xE4FB)
+	 (#xf8d7 #xE4FC)
+	 (#xf8d8 #xE4FD)
+	 (#xf8d9 #xE4FE)
+	 (#xf8da #xE4FF)
+	 (#xf8db #xE500)
+	 (#xf8dc #xE501)
+	 (#xf8dd #xE502)
+	 (#xf8de #xE503)
+	 (#xf8df #xE504)
+	 (#xf8e0 #xE505)
+	 (#xf8e1 #xE506)
+	 (#xf8e2 #xE507)
+	 (#xf8e3 #xE508)
+	 (#xf8e4 #xE509)
+	 (#xf8e5 #xE50A)
+	 (#xf8e6 #xE50B)
+	 (#xf8e7 #xE50C)
+	 (#xf8e8 #xE50D)
+	 (#xf8e9 #xE50E)
+	 (#xf8ea #xE50F)
+	 (#xf8eb #xE510)
+	 (#xf8ec #xE511)
+	 (#xf8ed #xE512)
+	 (#xf8ee #xE513)
+	 (#xf8ef #xE514)
+	 (#xf8f0 #xE515)
+	 (#xf8f1 #xE516)
+	 (#xf8f2 #xE517)
+	 (#xf8f3 #xE518)
+	 (#xf8f4 #xE519)
+	 (#xf8f5 #xE51A)
+	 (#xf8f6 #xE51B)
+	 (#xf8f7 #xE51C)
+	 (#xf8f8 #xE51D)
+	 (#xf8f9 #xE51E)
+	 (#xf8fa #xE51F)
+	 (#xf8fb #xE520)
+	 (#xf8fc #xE521)
+	 (#xf8fd #xE522)
+	 (#xf8fe #xE523)
+	 (#xf9a1 #xE524)
+	 (#xf9a2 #xE525)
+	 (#xf9a3 #xE526)
+	 (#xf9a4 #xE527)
+	 (#xf9a5 #xE528)
+	 (#xf9a6 #xE529)
+	 (#xf9a7 #xE52A)
+	 (#xf9a8 #xE52B)
+	 (#xf9a9 #xE52C)
+	 (#xf9aa #xE52D)
+	 (#xf9ab #xE52E)
+	 (#xf9ac #xE52F)
+	 (#xf9ad #xE530)
+	 (#xf9ae #xE531)
+	 (#xf9af #xE532)
+	 (#xf9b0 #xE533)
+	 (#xf9b1 #xE534)
+	 (#xf9b2 #xE535)
+	 (#xf9b3 #xE536)
+	 (#xf9b4 #xE537)
+	 (#xf9b5 #xE538)
+	 (#xf9b6 #xE539)
+	 (#xf9b7 #xE53A)
+	 (#xf9b8 #xE53B)
+	 (#xf9b9 #xE53C)
+	 (#xf9ba #xE53D)
+	 (#xf9bb #xE53E)
+	 (#xf9bc #xE53F)
+	 (#xf9bd #xE540)
+	 (#xf9be #xE541)
+	 (#xf9bf #xE542)
+	 (#xf9c0 #xE543)
+	 (#xf9c1 #xE544)
+	 (#xf9c2 #xE545)
+	 (#xf9c3 #xE546)
+	 (#xf9c4 #xE547)
+	 (#xf9c5 #xE548)
+	 (#xf9c6 #xE549)
+	 (#xf9c7 #xE54A)
+	 (#xf9c8 #xE54B)
+	 (#xf9c9 #xE54C)
+	 (#xf9ca #xE54D)
+	 (#xf9cb #xE54E)
+	 (#xf9cc #xE54F)
+	 (#xf9cd #xE550)
+	 (#xf9ce #xE551)
+	 (#xf9cf #xE552)
+	 (#xf9d0 #xE553)
+	 (#xf9d1 #xE554)
+	 (#xf9d2 #xE555)
+	 (#xf9d3 #xE556)
+	 (#xf9d4 #xE557)
+	 (#xf9d5 #xE558)
+	 (#xf9d6 #xE559)
+	 (#xf9d7 #xE55A)
+	 (#xf9d8 #xE55B)
+	 (#xf9d9 #xE55C)
+	 (#xf9da #xE55D)
+	 (#xf9db #xE55E)
+	 (#xf9dc #xE55F)
+	 (#xf9dd #xE560)
+	 (#xf9de #xE561)
+	 (#xf9df #xE562)
+	 (#xf9e0 #xE563)
+	 (#xf9e1 #xE564)
+	 (#xf9e2 #xE565)
+	 (#xf9e3 #xE566)
+	 (#xf9e4 #xE567)
+	 (#xf9e5 #xE568)
+	 (#xf9e6 #xE569)
+	 (#xf9e7 #xE56A)
+	 (#xf9e8 #xE56B)
+	 (#xf9e9 #xE56C)
+	 (#xf9ea #xE56D)
+	 (#xf9eb #xE56E)
+	 (#xf9ec #xE56F)
+	 (#xf9ed #xE570)
+	 (#xf9ee #xE571)
+	 (#xf9ef #xE572)
+	 (#xf9f0 #xE573)
+	 (#xf9f1 #xE574)
+	 (#xf9f2 #xE575)
+	 (#xf9f3 #xE576)
+	 (#xf9f4 #xE577)
+	 (#xf9f5 #xE578)
+	 (#xf9f6 #xE579)
+	 (#xf9f7 #xE57A)
+	 (#xf9f8 #xE57B)
+	 (#xf9f9 #xE57C)
+	 (#xf9fa #xE57D)
+	 (#xf9fb #xE57E)
+	 (#xf9fc #xE57F)
+	 (#xf9fd #xE580)
+	 (#xf9fe #xE581)
+	 (#xfaa1 #xE582)
+	 (#xfaa2 #xE583)
+	 (#xfaa3 #xE584)
+	 (#xfaa4 #xE585)
+	 (#xfaa5 #xE586)
+	 (#xfaa6 #xE587)
+	 (#xfaa7 #xE588)
+	 (#xfaa8 #xE589)
+	 (#xfaa9 #xE58A)
+	 (#xfaaa #xE58B)
+	 (#xfaab #xE58C)
+	 (#xfaac #xE58D)
+	 (#xfaad #xE58E)
+	 (#xfaae #xE58F)
+	 (#xfaaf #xE590)
+	 (#xfab0 #xE591)
+	 (#xfab1 #xE592)
+	 (#xfab2 #xE593)
+	 (#xfab3 #xE594)
+	 (#xfab4 #xE595)
+	 (#xfab5 #xE596)
+	 (#xfab6 #xE597)
+	 (#xfab7 #xE598)
+	 (#xfab8 #xE599)
+	 (#xfab9 #xE59A)
+	 (#xfaba #xE59B)
+	 (#xfabb #xE59C)
+	 (#xfabc #xE59D)
+	 (#xfabd #xE59E)
+	 (#xfabe #xE59F)
+	 (#xfabf #xE5A0)
+	 (#xfac0 #xE5A1)
+	 (#xfac1 #xE5A2)
+	 (#xfac2 #xE5A3)
+	 (#xfac3 #xE5A4)
+	 (#xfac4 #xE5A5)
+	 (#xfac5 #xE5A6)
+	 (#xfac6 #xE5A7)
+	 (#xfac7 #xE5A8)
+	 (#xfac8 #xE5A9)
+	 (#xfac9 #xE5AA)
+	 (#xfaca #xE5AB)
+	 (#xfacb #xE5AC)
+	 (#xfacc #xE5AD)
+	 (#xfacd #xE5AE)
+	 (#xface #xE5AF)
+	 (#xfacf #xE5B0)
+	 (#xfad0 #xE5B1)
+	 (#xfad1 #xE5B2)
+	 (#xfad2 #xE5B3)
+	 (#xfad3 #xE5B4)
+	 (#xfad4 #xE5B5)
+	 (#xfad5 #xE5B6)
+	 (#xfad6 #xE5B7)
+	 (#xfad7 #xE5B8)
+	 (#xfad8 #xE5B9)
+	 (#xfad9 #xE5BA)
+	 (#xfada #xE5BB)
+	 (#xfadb #xE5BC)
+	 (#xfadc #xE5BD)
+	 (#xfadd #xE5BE)
+	 (#xfade #xE5BF)
+	 (#xfadf #xE5C0)
+	 (#xfae0 #xE5C1)
+	 (#xfae1 #xE5C2)
+	 (#xfae2 #xE5C3)
+	 (#xfae3 #xE5C4)
+	 (#xfae4 #xE5C5)
+	 (#xfae5 #xE5C6)
+	 (#xfae6 #xE5C7)
+	 (#xfae7 #xE5C8)
+	 (#xfae8 #xE5C9)
+	 (#xfae9 #xE5CA)
+	 (#xfaea #xE5CB)
+	 (#xfaeb #xE5CC)
+	 (#xfaec #xE5CD)
+	 (#xfaed #xE5CE)
+	 (#xfaee #xE5CF)
+	 (#xfaef #xE5D0)
+	 (#xfaf0 #xE5D1)
+	 (#xfaf1 #xE5D2)
+	 (#xfaf2 #xE5D3)
+	 (#xfaf3 #xE5D4)
+	 (#xfaf4 #xE5D5)
+	 (#xfaf5 #xE5D6)
+	 (#xfaf6 #xE5D7)
+	 (#xfaf7 #xE5D8)
+	 (#xfaf8 #xE5D9)
+	 (#xfaf9 #xE5DA)
+	 (#xfafa #xE5DB)
+	 (#xfafb #xE5DC)
+	 (#xfafc #xE5DD)
+	 (#xfafd #xE5DE)
+	 (#xfafe #xE5DF)
+	 (#xfba1 #xE5E0)
+	 (#xfba2 #xE5E1)
+	 (#xfba3 #xE5E2)
+	 (#xfba4 #xE5E3)
+	 (#xfba5 #xE5E4)
+	 (#xfba6 #xE5E5)
+	 (#xfba7 #xE5E6)
+	 (#xfba8 #xE5E7)
+	 (#xfba9 #xE5E8)
+	 (#xfbaa #xE5E9)
+	 (#xfbab #xE5EA)
+	 (#xfbac #xE5EB)
+	 (#xfbad #xE5EC)
+	 (#xfbae #xE5ED)
+	 (#xfbaf #xE5EE)
+	 (#xfbb0 #xE5EF)
+	 (#xfbb1 #xE5F0)
+	 (#xfbb2 #xE5F1)
+	 (#xfbb3 #xE5F2)
+	 (#xfbb4 #xE5F3)
+	 (#xfbb5 #xE5F4)
+	 (#xfbb6 #xE5F5)
+	 (#xfbb7 #xE5F6)
+	 (#xfbb8 #xE5F7)
+	 (#xfbb9 #xE5F8)
+	 (#xfbba #xE5F9)
+	 (#xfbbb #xE5FA)
+	 (#xfbbc #xE5FB)
+	 (#xfbbd #xE5FC)
+	 (#xfbbe #xE5FD)
+	 (#xfbbf #xE5FE)
+	 (#xfbc0 #xE5FF)
+	 (#xfbc1 #xE600)
+	 (#xfbc2 #xE601)
+	 (#xfbc3 #xE602)
+	 (#xfbc4 #xE603)
+	 (#xfbc5 #xE604)
+	 (#xfbc6 #xE605)
+	 (#xfbc7 #xE606)
+	 (#xfbc8 #xE607)
+	 (#xfbc9 #xE608)
+	 (#xfbca #xE609)
+	 (#xfbcb #xE60A)
+	 (#xfbcc #xE60B)
+	 (#xfbcd #xE60C)
+	 (#xfbce #xE60D)
+	 (#xfbcf #xE60E)
+	 (#xfbd0 #xE60F)
+	 (#xfbd1 #xE610)
+	 (#xfbd2 #xE611)
+	 (#xfbd3 #xE612)
+	 (#xfbd4 #xE613)
+	 (#xfbd5 #xE614)
+	 (#xfbd6 #xE615)
+	 (#xfbd7 #xE616)
+	 (#xfbd8 #xE617)
+	 (#xfbd9 #xE618)
+	 (#xfbda #xE619)
+	 (#xfbdb #xE61A)
+	 (#xfbdc #xE61B)
+	 (#xfbdd #xE61C)
+	 (#xfbde #xE61D)
+	 (#xfbdf #xE61E)
+	 (#xfbe0 #xE61F)
+	 (#xfbe1 #xE620)
+	 (#xfbe2 #xE621)
+	 (#xfbe3 #xE622)
+	 (#xfbe4 #xE623)
+	 (#xfbe5 #xE624)
+	 (#xfbe6 #xE625)
+	 (#xfbe7 #xE626)
+	 (#xfbe8 #xE627)
+	 (#xfbe9 #xE628)
+	 (#xfbea #xE629)
+	 (#xfbeb #xE62A)
+	 (#xfbec #xE62B)
+	 (#xfbed #xE62C)
+	 (#xfbee #xE62D)
+	 (#xfbef #xE62E)
+	 (#xfbf0 #xE62F)
+	 (#xfbf1 #xE630)
+	 (#xfbf2 #xE631)
+	 (#xfbf3 #xE632)
+	 (#xfbf4 #xE633)
+	 (#xfbf5 #xE634)
+	 (#xfbf6 #xE635)
+	 (#xfbf7 #xE636)
+	 (#xfbf8 #xE637)
+	 (#xfbf9 #xE638)
+	 (#xfbfa #xE639)
+	 (#xfbfb #xE63A)
+	 (#xfbfc #xE63B)
+	 (#xfbfd #xE63C)
+	 (#xfbfe #xE63D)
+	 (#xfca1 #xE63E)
+	 (#xfca2 #xE63F)
+	 (#xfca3 #xE640)
+	 (#xfca4 #xE641)
+	 (#xfca5 #xE642)
+	 (#xfca6 #xE643)
+	 (#xfca7 #xE644)
+	 (#xfca8 #xE645)
+	 (#xfca9 #xE646)
+	 (#xfcaa #xE647)
+	 (#xfcab #xE648)
+	 (#xfcac #xE649)
+	 (#xfcad #xE64A)
+	 (#xfcae #xE64B)
+	 (#xfcaf #xE64C)
+	 (#xfcb0 #xE64D)
+	 (#xfcb1 #xE64E)
+	 (#xfcb2 #xE64F)
+	 (#xfcb3 #xE650)
+	 (#xfcb4 #xE651)
+	 (#xfcb5 #xE652)
+	 (#xfcb6 #xE653)
+	 (#xfcb7 #xE654)
+	 (#xfcb8 #xE655)
+	 (#xfcb9 #xE656)
+	 (#xfcba #xE657)
+	 (#xfcbb #xE658)
+	 (#xfcbc #xE659)
+	 (#xfcbd #xE65A)
+	 (#xfcbe #xE65B)
+	 (#xfcbf #xE65C)
+	 (#xfcc0 #xE65D)
+	 (#xfcc1 #xE65E)
+	 (#xfcc2 #xE65F)
+	 (#xfcc3 #xE660)
+	 (#xfcc4 #xE661)
+	 (#xfcc5 #xE662)
+	 (#xfcc6 #xE663)
+	 (#xfcc7 #xE664)
+	 (#xfcc8 #xE665)
+	 (#xfcc9 #xE666)
+	 (#xfcca #xE667)
+	 (#xfccb #xE668)
+	 (#xfccc #xE669)
+	 (#xfccd #xE66A)
+	 (#xfcce #xE66B)
+	 (#xfccf #xE66C)
+	 (#xfcd0 #xE66D)
+	 (#xfcd1 #xE66E)
+	 (#xfcd2 #xE66F)
+	 (#xfcd3 #xE670)
+	 (#xfcd4 #xE671)
+	 (#xfcd5 #xE672)
+	 (#xfcd6 #xE673)
+	 (#xfcd7 #xE674)
+	 (#xfcd8 #xE675)
+	 (#xfcd9 #xE676)
+	 (#xfcda #xE677)
+	 (#xfcdb #xE678)
+	 (#xfcdc #xE679)
+	 (#xfcdd #xE67A)
+	 (#xfcde #xE67B)
+	 (#xfcdf #xE67C)
+	 (#xfce0 #xE67D)
+	 (#xfce1 #xE67E)
+	 (#xfce2 #xE67F)
+	 (#xfce3 #xE680)
+	 (#xfce4 #xE681)
+	 (#xfce5 #xE682)
+	 (#xfce6 #xE683)
+	 (#xfce7 #xE684)
+	 (#xfce8 #xE685)
+	 (#xfce9 #xE686)
+	 (#xfcea #xE687)
+	 (#xfceb #xE688)
+	 (#xfcec #xE689)
+	 (#xfced #xE68A)
+	 (#xfcee #xE68B)
+	 (#xfcef #xE68C)
+	 (#xfcf0 #xE68D)
+	 (#xfcf1 #xE68E)
+	 (#xfcf2 #xE68F)
+	 (#xfcf3 #xE690)
+	 (#xfcf4 #xE691)
+	 (#xfcf5 #xE692)
+	 (#xfcf6 #xE693)
+	 (#xfcf7 #xE694)
+	 (#xfcf8 #xE695)
+	 (#xfcf9 #xE696)
+	 (#xfcfa #xE697)
+	 (#xfcfb #xE698)
+	 (#xfcfc #xE699)
+	 (#xfcfd #xE69A)
+	 (#xfcfe #xE69B)
+	 (#xfda1 #xE69C)
+	 (#xfda2 #xE69D)
+	 (#xfda3 #xE69E)
+	 (#xfda4 #xE69F)
+	 (#xfda5 #xE6A0)
+	 (#xfda6 #xE6A1)
+	 (#xfda7 #xE6A2)
+	 (#xfda8 #xE6A3)
+	 (#xfda9 #xE6A4)
+	 (#xfdaa #xE6A5)
+	 (#xfdab #xE6A6)
+	 (#xfdac #xE6A7)
+	 (#xfdad #xE6A8)
+	 (#xfdae #xE6A9)
+	 (#xfdaf #xE6AA)
+	 (#xfdb0 #xE6AB)
+	 (#xfdb1 #xE6AC)
+	 (#xfdb2 #xE6AD)
+	 (#xfdb3 #xE6AE)
+	 (#xfdb4 #xE6AF)
+	 (#xfdb5 #xE6B0)
+	 (#xfdb6 #xE6B1)
+	 (#xfdb7 #xE6B2)
+	 (#xfdb8 #xE6B3)
+	 (#xfdb9 #xE6B4)
+	 (#xfdba #xE6B5)
+	 (#xfdbb #xE6B6)
+	 (#xfdbc #xE6B7)
+	 (#xfdbd #xE6B8)
+	 (#xfdbe #xE6B9)
+	 (#xfdbf #xE6BA)
+	 (#xfdc0 #xE6BB)
+	 (#xfdc1 #xE6BC)
+	 (#xfdc2 #xE6BD)
+	 (#xfdc3 #xE6BE)
+	 (#xfdc4 #xE6BF)
+	 (#xfdc5 #xE6C0)
+	 (#xfdc6 #xE6C1)
+	 (#xfdc7 #xE6C2)
+	 (#xfdc8 #xE6C3)
+	 (#xfdc9 #xE6C4)
+	 (#xfdca #xE6C5)
+	 (#xfdcb #xE6C6)
+	 (#xfdcc #xE6C7)
+	 (#xfdcd #xE6C8)
+	 (#xfdce #xE6C9)
+	 (#xfdcf #xE6CA)
+	 (#xfdd0 #xE6CB)
+	 (#xfdd1 #xE6CC)
+	 (#xfdd2 #xE6CD)
+	 (#xfdd3 #xE6CE)
+	 (#xfdd4 #xE6CF)
+	 (#xfdd5 #xE6D0)
+	 (#xfdd6 #xE6D1)
+	 (#xfdd7 #xE6D2)
+	 (#xfdd8 #xE6D3)
+	 (#xfdd9 #xE6D4)
+	 (#xfdda #xE6D5)
+	 (#xfddb #xE6D6)
+	 (#xfddc #xE6D7)
+	 (#xfddd #xE6D8)
+	 (#xfdde #xE6D9)
+	 (#xfddf #xE6DA)
+	 (#xfde0 #xE6DB)
+	 (#xfde1 #xE6DC)
+	 (#xfde2 #xE6DD)
+	 (#xfde3 #xE6DE)
+	 (#xfde4 #xE6DF)
+	 (#xfde5 #xE6E0)
+	 (#xfde6 #xE6E1)
+	 (#xfde7 #xE6E2)
+	 (#xfde8 #xE6E3)
+	 (#xfde9 #xE6E4)
+	 (#xfdea #xE6E5)
+	 (#xfdeb #xE6E6)
+	 (#xfdec #xE6E7)
+	 (#xfded #xE6E8)
+	 (#xfdee #xE6E9)
+	 (#xfdef #xE6EA)
+	 (#xfdf0 #xE6EB)
+	 (#xfdf1 #xE6EC)
+	 (#xfdf2 #xE6ED)
+	 (#xfdf3 #xE6EE)
+	 (#xfdf4 #xE6EF)
+	 (#xfdf5 #xE6F0)
+	 (#xfdf6 #xE6F1)
+	 (#xfdf7 #xE6F2)
+	 (#xfdf8 #xE6F3)
+	 (#xfdf9 #xE6F4)
+	 (#xfdfa #xE6F5)
+	 (#xfdfb #xE6F6)
+	 (#xfdfc #xE6F7)
+	 (#xfdfd #xE6F8)
+	 (#xfdfe #xE6F9)
+	 (#xfea1 #xE6FA)
+	 (#xfea2 #xE6FB)
+	 (#xfea3 #xE6FC)
+	 (#xfea4 #xE6FD)
+	 (#xfea5 #xE6FE)
+	 (#xfea6 #xE6FF)
+	 (#xfea7 #xE700)
+	 (#xfea8 #xE701)
+	 (#xfea9 #xE702)
+	 (#xfeaa #xE703)
+	 (#xfeab #xE704)
+	 (#xfeac #xE705)
+	 (#xfead #xE706)
+	 (#xfeae #xE707)
+	 (#xfeaf #xE708)
+	 (#xfeb0 #xE709)
+	 (#xfeb1 #xE70A)
+	 (#xfeb2 #xE70B)
+	 (#xfeb3 #xE70C)
+	 (#xfeb4 #xE70D)
+	 (#xfeb5 #xE70E)
+	 (#xfeb6 #xE70F)
+	 (#xfeb7 #xE710)
+	 (#xfeb8 #xE711)
+	 (#xfeb9 #xE712)
+	 (#xfeba #xE713)
+	 (#xfebb #xE714)
+	 (#xfebc #xE715)
+	 (#xfebd #xE716)
+	 (#xfebe #xE717)
+	 (#xfebf #xE718)
+	 (#xfec0 #xE719)
+	 (#xfec1 #xE71A)
+	 (#xfec2 #xE71B)
+	 (#xfec3 #xE71C)
+	 (#xfec4 #xE71D)
+	 (#xfec5 #xE71E)
+	 (#xfec6 #xE71F)
+	 (#xfec7 #xE720)
+	 (#xfec8 #xE721)
+	 (#xfec9 #xE722)
+	 (#xfeca #xE723)
+	 (#xfecb #xE724)
+	 (#xfecc #xE725)
+	 (#xfecd #xE726)
+	 (#xfece #xE727)
+	 (#xfecf #xE728)
+	 (#xfed0 #xE729)
+	 (#xfed1 #xE72A)
+	 (#xfed2 #xE72B)
+	 (#xfed3 #xE72C)
+	 (#xfed4 #xE72D)
+	 (#xfed5 #xE72E)
+	 (#xfed6 #xE72F)
+	 (#xfed7 #xE730)
+	 (#xfed8 #xE731)
+	 (#xfed9 #xE732)
+	 (#xfeda #xE733)
+	 (#xfedb #xE734)
+	 (#xfedc #xE735)
+	 (#xfedd #xE736)
+	 (#xfede #xE737)
+	 (#xfedf #xE738)
+	 (#xfee0 #xE739)
+	 (#xfee1 #xE73A)
+	 (#xfee2 #xE73B)
+	 (#xfee3 #xE73C)
+	 (#xfee4 #xE73D)
+	 (#xfee5 #xE73E)
+	 (#xfee6 #xE73F)
+	 (#xfee7 #xE740)
+	 (#xfee8 #xE741)
+	 (#xfee9 #xE742)
+	 (#xfeea #xE743)
+	 (#xfeeb #xE744)
+	 (#xfeec #xE745)
+	 (#xfeed #xE746)
+	 (#xfeee #xE747)
+	 (#xfeef #xE748)
+	 (#xfef0 #xE749)
+	 (#xfef1 #xE74A)
+	 (#xfef2 #xE74B)
+	 (#xfef3 #xE74C)
+	 (#xfef4 #xE74D)
+	 (#xfef5 #xE74E)
+	 (#xfef6 #xE74F)
+	 (#xfef7 #xE750)
+	 (#xfef8 #xE751)
+	 (#xfef9 #xE752)
+	 (#xfefa #xE753)
+	 (#xfefb #xE754)
+	 (#xfefc #xE755)
+	 (#xfefd #xE756)
+	 (#xfefe #xE757))))
+  (setq map
+    (mapcar
+	(lambda (x)
+	    (let ((code (logand (car x) #x7F7F)))
+	      (if (integerp (cdr x))
+		  (cons (decode-char 'japanese-jisx0208 code) (cdr x))
+		(cons (decode-char 'japanese-jisx0212 code)
+		      (cadr x)))))
+	map))
+  (define-translation-table 'eucjp-ms-decode map)
+  (mapc (lambda (x)
+	    (let ((tmp (car x)))
+	      (setcar x (cdr x)) (setcdr x tmp)))
+	map)
+  (define-translation-table 'eucjp-ms-encode map))
+
+(provide 'eucjp-ms)
@@ -0,0 +1,62 @@
+;;; ja-dic.el --- dictionary for Japanese input method  -*- lexical-binding:t -*-
+;;	Generated by the command `skkdic-convert'
+;;	Original SKK dictionary file: ../../../leim/SKK-DIC/SKK-JISYO.L
+
+;; This file is part of GNU Emacs.
+
+;;; Start of the header of the original SKK dictionary.
+
+;; -*- coding: euc-jp -*-
+;; okuri-ari entries.
+
+;;; Code:
+
+(eval-when-compile (require 'ja-dic-cnv))
+
+;; Setting okuri-ari entries.
+(skkdic-set-okuri-ari
+"あr 有"
+)
+
+;; Setting postfix entries.
+(skkdic-set-postfix
+"いき 行"
+"がかり 係"
+"がく 学"
+"がわ 川"
+"しゃ 社"
+"しゅう 集"
+"しょう 賞 城"
+"じょう 城"
+"せん 線"
+"だけ 岳"
+"ちゃく 着"
+"てん 店"
+"とうげ 峠"
+"どおり 通り"
+"やま 山"
+"ばし 橋"
+"はつ 発"
+"もく 目"
+"ゆき 行"
+)
+
+;; Setting prefix entries.
+(skkdic-set-prefix
+)
+
+;; Setting okuri-nasi entries.
+(skkdic-set-okuri-nasi
+"あい 愛"
+)
+
+;;
+(provide 'ja-dic)
+
+;; Local Variables:
+;; version-control: never
+;; no-update-autoloads: t
+;; coding: utf-8
+;; End:
+
+;;; ja-dic.el ends here
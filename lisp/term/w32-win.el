@@ -283,8 +283,7 @@ libgnutls-version
 	 '(gnutls "libgnutls-28.dll" "libgnutls-26.dll"))
        '(libxml2 "libxml2-2.dll" "libxml2.dll")
        '(zlib "zlib1.dll" "libz-1.dll")
-       '(lcms2 "liblcms2-2.dll")
-       '(json "libjansson-4.dll")))
+       '(lcms2 "liblcms2-2.dll")))
 
 ;;; multi-tty support
 (defvar w32-initialized nil
@@ -2341,6 +2341,93 @@ DEFUN ("bool-vector", Fbool_vector, Sbool_vector, 0, MANY, 0,
   return vector;
 }
 
+/* Return a newly allocated, uninitialized numeric vector of type TYPE,
+   PVEC_F64VECTOR or PVEC_I64VECTOR, with SIZE elements.  */
+
+Lisp_Object
+make_uninit_numeric_vector (enum pvec_type type, EMACS_INT size)
+{
+  Lisp_Object val;
+  verify (sizeof (union numeric_vector_elt) == word_size);
+  EMACS_INT needed_elements = ((numeric_vector_header_size - header_size
+				+ word_size - 1) / word_size
+			       + size);
+  if (PTRDIFF_MAX < needed_elements)
+    memory_full (SIZE_MAX);
+  struct Lisp_Numeric_Vector *p
+    = (struct Lisp_Numeric_Vector *) allocate_vector (needed_elements);
+  XSETVECTOR (val, p);
+  XSETPVECTYPESIZE (XVECTOR (val), type, 0, 0);
+  p->size = size;
+  return val;
+}
+
+/* Return a new numeric vector of type TYPE and length LENGTH, with
+   every element INIT.  */
+
+static Lisp_Object
+make_numeric_vector (enum pvec_type type, Lisp_Object length,
+		     Lisp_Object init)
+{
+  CHECK_FIXNAT (length);
+  EMACS_INT size = XFIXNAT (length);
+  Lisp_Object val = make_uninit_numeric_vector (type, size);
+  if (size > 0)
+    {
+      numeric_vector_set (val, 0, init);
+      union numeric_vector_elt *data = numeric_vector_data (val);
+      for (EMACS_INT i = 1; i < size; i++)
+	data[i] = data[0];
+    }
+  return val;
+}
+
+DEFUN ("make-f64vector", Fmake_f64vector, Smake_f64vector, 1, 2, 0,
+       doc: /* Return a new f64vector of length LENGTH, with each element INIT.
+An f64vector holds unboxed double-precision floating-point numbers.
+INIT must be a number and defaults to 0.0.  */)
+  (Lisp_Object length, Lisp_Object init)
+{
+  return make_numeric_vector (PVEC_F64VECTOR, length,
+			      NILP (init) ? make_fixnum (0) : init);
+}
+
+DEFUN ("make-i64vector", Fmake_i64vector, Smake_i64vector, 1, 2, 0,
+       doc: /* Return a new i64vector of length LENGTH, with each element INIT.
+An i64vector holds unboxed signed 64-bit integers.
+INIT must be an integer in that range and defaults to 0.  */)
+  (Lisp_Object length, Lisp_Object init)
+{
+  return make_numeric_vector (PVEC_I64VECTOR, length,
+			      NILP (init) ? make_fixnum (0) : init);
+}
+
+DEFUN ("f64vector", Ff64vector, Sf64vector, 0, MANY, 0,
+       doc: /* Return a new f64vector with specified arguments as elements.
+Each argument must be a number.  Allows any number of arguments,
+including zero.
+usage: (f64vector &rest NUMBERS)  */)
+  (ptrdiff_t nargs, Lisp_Object *args)
+{
+  Lisp_Object val = make_uninit_numeric_vector (PVEC_F64VECTOR, nargs);
+  for (ptrdiff_t i = 0; i < nargs; i++)
+    numeric_vector_set (val, i, args[i]);
+  return val;
+}
+
+DEFUN ("i64vector", Fi64vector, Si64vector, 0, MANY, 0,
+       doc: /* Return a new i64vector with specified arguments as elements.
+Each argument must be an integer that fits in 64 bits.  Allows any
+number of arguments, including zero.
+usage: (i64vector &rest INTEGERS)  */)
+  (ptrdiff_t nargs, Lisp_Object *args)
+{
+  Lisp_Object val = make_uninit_numeric_vector (PVEC_I64VECTOR, nargs);
+  for (ptrdiff_t i = 0; i < nargs; i++)
+    numeric_vector_set (val, i, args[i]);
+  return val;
+}
+
 /* Make a string from NBYTES bytes at CONTENTS, and compute the number
    of characters from the contents.  This string may be unibyte or
    multibyte, depending on the contents.  */
@@ -3079,6 +3166,14 @@ vectorlike_nbytes (const union vectorlike_header *hdr)
 	  verify (header_size <= bool_header_size);
 	  nwords = (boolvec_bytes - header_size + word_size - 1) / word_size;
         }
+      else if (PSEUDOVECTOR_TYPEP (hdr, PVEC_F64VECTOR)
+	       || PSEUDOVECTOR_TYPEP (hdr, PVEC_I64VECTOR))
+	{
+	  struct Lisp_Numeric_Vector *nv = (struct Lisp_Numeric_Vector *) hdr;
+	  nwords = ((numeric_vector_header_size - header_size
+		     + word_size - 1) / word_size
+		    + nv->size);
+	}
       else
 	nwords = ((size & PSEUDOVECTOR_SIZE_MASK)
 		  + ((size & PSEUDOVECTOR_REST_MASK)
@@ -3133,6 +3228,8 @@ cleanup_vector (struct Lisp_Vector *vector)
     finalize_one_mutex (PSEUDOVEC_STRUCT (vector, Lisp_Mutex));
   else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_CONDVAR))
     finalize_one_condvar (PSEUDOVEC_STRUCT (vector, Lisp_CondVar));
+  else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_JSON_PARSER))
+    finalize_json_parser (vector);
   else if (PSEUDOVECTOR_TYPEP (&vector->header, PVEC_MARKER))
     {
       /* sweep_buffer should already have unchained this from its buffer.  */
@@ -3855,7 +3952,9 @@ vector_marked_p (const struct Lisp_Vector *v)
          the vector header just to tell that it's a bool vector.  */
       if (pdumper_cold_object_p (v))
         {
-          eassert (PSEUDOVECTOR_TYPE (v) == PVEC_BOOL_VECTOR);
+          eassert (PSEUDOVECTOR_TYPE (v) == PVEC_BOOL_VECTOR
+		   || PSEUDOVECTOR_TYPE (v) == PVEC_F64VECTOR
+		   || PSEUDOVECTOR_TYPE (v) == PVEC_I64VECTOR);
           return true;
         }
       return pdumper_marked_p (v);
@@ -3868,7 +3967,9 @@ set_vector_marked (struct Lisp_Vector *v)
 {
   if (pdumper_object_p (v))
     {
-      eassert (PSEUDOVECTOR_TYPE (v) != PVEC_BOOL_VECTOR);
+      eassert (PSEUDOVECTOR_TYPE (v) != PVEC_BOOL_VECTOR
+	       && PSEUDOVECTOR_TYPE (v) != PVEC_F64VECTOR
+	       && PSEUDOVECTOR_TYPE (v) != PVEC_I64VECTOR);
       pdumper_set_marked (v);
     }
   else
@@ -6283,8 +6384,10 @@ mark_vectorlike (union vectorlike_header *header)
 
   eassert (!vector_marked_p (ptr));
 
-  /* Bool vectors have a different case in mark_object.  */
-  eassert (PSEUDOVECTOR_TYPE (ptr) != PVEC_BOOL_VECTOR);
+  /* Bool and numeric vectors have a different case in mark_object.  */
+  eassert (PSEUDOVECTOR_TYPE (ptr) != PVEC_BOOL_VECTOR
+	   && PSEUDOVECTOR_TYPE (ptr) != PVEC_F64VECTOR
+	   && PSEUDOVECTOR_TYPE (ptr) != PVEC_I64VECTOR);
 
   set_vector_marked (ptr); /* Else mark it.  */
   if (size & PSEUDOVECTOR_FLAG)
@@ -6679,11 +6782,14 @@ #define CHECK_ALLOCATED_AND_LIVE_SYMBOL()		((void) 0)
 	    break;
 
           case PVEC_BOOL_VECTOR:
+          case PVEC_F64VECTOR:
+          case PVEC_I64VECTOR:
             /* bool vectors in a dump are permanently "marked", since
                they're in the old section and don't have mark bits.
                If we're looking at a dumped bool vector, we should
                have aborted above when we called vector_marked_p, so
-               we should never get here.  */
+               we should never get here.  The same goes for numeric
+               vectors, which contain no Lisp objects either.  */
             eassert (!pdumper_object_p (ptr));
             set_vector_marked (ptr);
             break;
@@ -7578,6 +7684,10 @@ syms_of_alloc (void)
   defsubr (&Smake_record);
   defsubr (&Smake_string);
   defsubr (&Smake_bool_vector);
+  defsubr (&Sf64vector);
+  defsubr (&Si64vector);
+  defsubr (&Smake_f64vector);
+  defsubr (&Smake_i64vector);
   defsubr (&Smake_symbol);
   defsubr (&Smake_marker);
   defsubr (&Smake_finalizer);
@@ -273,6 +273,63 @@ bignum_to_uintmax (Lisp_Object x)
   return mpz_to_uintmax (*xbignum_val (x), &i) ? i : 0;
 }
 
+#if HAVE_WIDEINT
+
+/* If the Lisp integer X fits in a wideint, store its value into *PW
+   and return true.  Return false otherwise.  */
+bool
+integer_to_wideint (Lisp_Object x, wideint *pw)
+{
+  if (FIXNUMP (x))
+    {
+      *pw = XFIXNUM (x);
+      return true;
+    }
+
+  mpz_t const *z = xbignum_val (x);
+  ptrdiff_t bits = mpz_sizeinbase (*z, 2);
+  if (WIDEINT_WIDTH <= bits)
+    return false;
+
+  uwideint u = 0;
+  for (int i = 0, shift = 0; shift < bits; i++, shift += GMP_NUMB_BITS)
+    u |= (uwideint) mpz_getlimbn (*z, i) << shift;
+  *pw = mpz_sgn (*z) < 0 ? - (wideint) u : (wideint) u;
+  return true;
+}
+
+/* Set RESULT to W.  */
+void
+mpz_set_wideint (mpz_t result, wideint w)
+{
+  bool negative = w < 0;
+  uwideint u = negative ? - (uwideint) w : w;
+  int maxlimbs = (WIDEINT_WIDTH + GMP_NUMB_BITS - 1) / GMP_NUMB_BITS;
+  mp_limb_t *limb = mpz_limbs_write (result, maxlimbs);
+  int n = 0;
+
+  do
+    {
+      limb[n++] = u;
+      u = GMP_NUMB_BITS < WIDEINT_WIDTH ? u >> GMP_NUMB_BITS : 0;
+    }
+  while (u != 0);
+
+  mpz_limbs_finish (result, negative ? -n : n);
+}
+
+/* Return a Lisp integer equal to W.  Set mpz[0] to a junk value.  */
+Lisp_Object
+make_wideint (wideint w)
+{
+  if (INTMAX_MIN <= w && w <= INTMAX_MAX)
+    return make_int (w);
+  mpz_set_wideint (mpz[0], w);
+  return make_bignum ();
+}
+
+#endif
+
 
 /* Multiply and exponentiate mpz_t values without aborting due to size
    limits.  */
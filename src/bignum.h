@@ -30,6 +30,20 @@ #define BIGNUM_H
 enum { GMP_NUMB_BITS = TYPE_WIDTH (mp_limb_t) };
 #endif
 
+/* A signed integer type twice as wide as intmax_t, if the compiler
+   has one along with overflow-checking builtins for it.  Integer
+   arithmetic that overflows intmax_t can then often be finished in
+   this type, without the cost of GMP.  */
+#if (defined __SIZEOF_INT128__ && INTMAX_WIDTH == 64 \
+     && _GL_HAS_BUILTIN_MUL_OVERFLOW)
+# define HAVE_WIDEINT true
+__extension__ typedef __int128 wideint;
+__extension__ typedef unsigned __int128 uwideint;
+enum { WIDEINT_WIDTH = 128 };
+#else
+# define HAVE_WIDEINT false
+#endif
+
 struct Lisp_Bignum
 {
   union vectorlike_header header;
@@ -51,6 +65,11 @@ #define BIGNUM_H
 extern void emacs_mpz_pow_ui (mpz_t, mpz_t const, unsigned long)
   ARG_NONNULL ((1, 2));
 extern double mpz_get_d_rounded (mpz_t const) ATTRIBUTE_CONST;
+#if HAVE_WIDEINT
+extern bool integer_to_wideint (Lisp_Object, wideint *) ARG_NONNULL ((2));
+extern void mpz_set_wideint (mpz_t, wideint) ARG_NONNULL ((1));
+extern Lisp_Object make_wideint (wideint);
+#endif
 
 INLINE_HEADER_BEGIN
 
@@ -24,11 +24,13 @@ Copyright (C) 1985-1989, 1993-1995, 1997-2021 Free Software Foundation,
 #include <sys/stat.h>
 #include <sys/param.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
 
 #include <verify.h>
+#include <stat-time.h>
 
 #include "lisp.h"
 #include "intervals.h"
@@ -41,6 +43,7 @@ Copyright (C) 1985-1989, 1993-1995, 1997-2021 Free Software Foundation,
 #include "region-cache.h"
 #include "indent.h"
 #include "blockinput.h"
+#include "keyboard.h"
 #include "keymap.h"
 #include "frame.h"
 #include "xwidget.h"
@@ -50,6 +53,11 @@ Copyright (C) 1985-1989, 1993-1995, 1997-2021 Free Software Foundation,
 #include "w32heap.h"		/* for mmap_* */
 #endif
 
+#if defined HAVE_MMAP && !defined WINDOWSNT
+#include <sys/mman.h>
+#include "syssignal.h"
+#endif
+
 /* This structure holds the default values of the buffer-local variables
    defined with DEFVAR_PER_BUFFER, that have special slots in each buffer.
    The default value occupies the same slot in this structure
@@ -595,6 +603,7 @@ DEFUN ("get-buffer-create", Fget_buffer_create, Sget_buffer_create, 1, 2, 0,
   BUF_END_UNCHANGED (b) = 0;
   BUF_BEG_UNCHANGED (b) = 0;
   *(BUF_GPT_ADDR (b)) = *(BUF_Z_ADDR (b)) = 0; /* Put an anchor '\0'.  */
+  b->text->end_slack = 0;
   b->text->inhibit_shrinking = false;
   b->text->redisplay = false;
 
@@ -1693,8 +1702,9 @@ compact_buffer (struct buffer *buffer)
       if (!EQ (BVAR(buffer, undo_list), Qt))
 	truncate_undo_list (buffer);
 
-      /* Shrink buffer gaps.  */
-      if (!buffer->text->inhibit_shrinking)
+      /* Shrink buffer gaps, but not of mapped text, which that would
+	 copy.  */
+      if (!buffer->text->inhibit_shrinking && !buffer->text->mapped)
 	{
 	  /* If a buffer's gap size is more than 10% of the buffer
 	     size, or larger than GAP_BYTES_DFL bytes, then shrink it
@@ -1704,6 +1714,14 @@ compact_buffer (struct buffer *buffer)
 					   GAP_BYTES_DFL);
 	  if (BUF_GAP_SIZE (buffer) > size)
 	    make_gap_1 (buffer, -(BUF_GAP_SIZE (buffer) - size));
+
+	  /* Give back the free space that edits near the end of the
+	     text left behind, too.  */
+	  if (buffer->text->end_slack > 0)
+	    {
+	      enlarge_buffer_text (buffer, -buffer->text->end_slack);
+	      buffer->text->end_slack = 0;
+	    }
 	}
       BUF_COMPACT (buffer) = BUF_MODIFF (buffer);
     }
@@ -5051,8 +5069,281 @@ alloc_buffer_text (struct buffer *b, ptrdiff_t nbytes)
   unblock_input ();
 }
 
+/* True if a file mapped into a buffer shrank, so that some of the
+   buffer's text now reads as zeros, and no error has said so yet.  */
+
+bool volatile mapped_text_lost;
+
+#if (defined HAVE_MMAP && defined MAP_ANONYMOUS && defined MREMAP_FIXED \
+     && defined SIGBUS && !defined WINDOWSNT)
+# define MAP_BUFFER_TEXT true
+#else
+# define MAP_BUFFER_TEXT false
+#endif
+
+#if MAP_BUFFER_TEXT
+
+/* The memory that map_buffer_text has mapped from files.  */
+struct text_mapping
+{
+  /* The mapped memory and its size.  */
+  unsigned char *beg;
+  ptrdiff_t size;
+
+  /* As much anonymous memory, reserved but never touched.
+     handle_sigbus moves its pages over those that are gone from the
+     file.  */
+  unsigned char *spare;
+
+  /* A descriptor open on the file, and the file's size and
+     modification time when it was mapped.  */
+  int fd;
+  off_t file_size;
+  struct timespec mtime;
+
+  /* True if a change to the file since then has been reported.  */
+  bool change_reported;
+};
+static struct text_mapping *text_mappings;
+static ptrdiff_t n_text_mappings, text_mappings_size;
+
+/* The page size, for handle_sigbus.  */
+static ptrdiff_t text_mapping_page;
+
+/* What SIGBUS did before map_buffer_text first took it over.  */
+static struct sigaction old_sigbus_action;
+
+/* Handle SIGBUS, which accessing text mapped from a file raises if
+   the file has been truncated since.  Replace the page that is gone
+   with a page of zeros set aside for it, so that the access can be
+   retried, and have maybe_quit signal an error about it.  Pass any
+   other SIGBUS on to the action from before.  */
+
+static void
+handle_sigbus (int sig, siginfo_t *siginfo, void *arg)
+{
+  unsigned char *addr = siginfo->si_addr;
+  ptrdiff_t page = text_mapping_page;
+
+  for (ptrdiff_t i = 0; i < n_text_mappings; i++)
+    {
+      struct text_mapping *m = &text_mappings[i];
+      if (m->beg <= addr && addr < m->beg + m->size)
+	{
+	  ptrdiff_t offset = addr - m->beg - (addr - m->beg) % page;
+	  if (mremap (m->spare + offset, page, page,
+		      MREMAP_MAYMOVE | MREMAP_FIXED, m->beg + offset)
+	      == MAP_FAILED)
+	    break;
+	  mapped_text_lost = true;
+	  pending_signals = true;
+	  return;
+	}
+    }
+
+  if (old_sigbus_action.sa_flags & SA_SIGINFO)
+    old_sigbus_action.sa_sigaction (sig, siginfo, arg);
+  else if (old_sigbus_action.sa_handler == SIG_DFL)
+    {
+      /* Die of the signal once this handler returns.  */
+      signal (sig, SIG_DFL);
+      raise (sig);
+    }
+  else if (old_sigbus_action.sa_handler != SIG_IGN)
+    old_sigbus_action.sa_handler (sig);
+}
+
+/* Return the mapping holding buffer B's text, or null if there is
+   none.  */
+
+static struct text_mapping *
+buffer_text_mapping (struct buffer *b)
+{
+  if (b->text->mapped)
+    for (ptrdiff_t i = 0; i < n_text_mappings; i++)
+      if (text_mappings[i].beg == b->text->beg)
+	return &text_mappings[i];
+  return NULL;
+}
+
+/* Release the file mapping holding buffer B's text, which starts at
+   BEG.  */
+
+static void
+unmap_buffer_text (struct buffer *b, unsigned char *beg)
+{
+  for (ptrdiff_t i = 0; i < n_text_mappings; i++)
+    if (text_mappings[i].beg == beg)
+      {
+	struct text_mapping *m = &text_mappings[i];
+	munmap (beg, m->size);
+	munmap (m->spare, m->size);
+	emacs_close (m->fd);
+	*m = text_mappings[--n_text_mappings];
+	break;
+      }
+  b->text->mapped = false;
+}
+
+#else
+
+static void
+unmap_buffer_text (struct buffer *b, unsigned char *beg)
+{
+  b->text->mapped = false;
+}
+
+#endif
+
+/* Signal an error if text mapped from a file has been lost since
+   this was last called, unless quitting is inhibited, in which case
+   try again later.  */
+
+void
+report_lost_mapped_text (void)
+{
+  if (mapped_text_lost)
+    {
+      if (!NILP (Vinhibit_quit))
+	return;
+      mapped_text_lost = false;
+      error ("Mapped file was truncated; its lost text reads as zeros");
+    }
+}
+
+/* Signal an error if the file whose text is mapped into buffer B has
+   been changed since, so that B's text may have changed along with
+   it.  Do this only once for each mapping.  */
+
+void
+report_changed_mapped_text (struct buffer *b)
+{
+#if MAP_BUFFER_TEXT
+  struct text_mapping *m = buffer_text_mapping (b);
+  struct stat st;
+  if (m && !m->change_reported
+      && (fstat (m->fd, &st) != 0
+	  || st.st_size != m->file_size
+	  || timespec_cmp (get_stat_mtime (&st), m->mtime) != 0))
+    {
+      m->change_reported = true;
+      error ("File mapped into buffer %s changed on disk; its text may too",
+	     SDATA (BVAR (b, name)));
+    }
+#endif
+}
+
+/* If the text of buffer B is mapped from the file named FILE, copy it
+   into memory of its own, so that writing to FILE leaves it alone.  */
+
+void
+unmap_buffer_text_of_file (struct buffer *b, char const *file)
+{
+#if MAP_BUFFER_TEXT
+  struct text_mapping *m = buffer_text_mapping (b);
+  struct stat st, mst;
+  if (m && emacs_fstatat (AT_FDCWD, file, &st, 0) == 0
+      && fstat (m->fd, &mst) == 0
+      && st.st_dev == mst.st_dev && st.st_ino == mst.st_ino)
+    enlarge_buffer_text (b, 0);
+#endif
+}
+
+/* Make the text of buffer B, which must be empty, a private mapping
+   of the first NBYTES bytes of the file open on FD, instead of reading
+   them into memory.  Leave the bytes at the end of the gap, where
+   decode_coding_gap wants them.  Return false, and change nothing, if
+   the file cannot be mapped.
+
+   The file's pages are read only when the text is looked at, and are
+   shared with the file system cache until they are written to.
+   prepare_to_modify_buffer copies mapped text into memory of its own
+   before the first change, so until then the text follows changes
+   that other programs make to the file.  The first change after the
+   file has changed, or the next command, signals an error saying so.
+   If the file is truncated, the text that is gone reads as zeros, and
+   the next maybe_quit signals an error.  */
+
+bool
+map_buffer_text (struct buffer *b, int fd, ptrdiff_t nbytes)
+{
+#if MAP_BUFFER_TEXT
+  ptrdiff_t page = getpagesize ();
+  ptrdiff_t gap = ROUNDUP (GAP_BYTES_DFL, page);
+  ptrdiff_t size;
+  struct stat st;
+
+  eassert (BUF_Z_BYTE (b) == BUF_BEG_BYTE (b));
+  if (nbytes <= 0 || INT_ADD_WRAPV (gap, nbytes, &size)
+      || INT_ADD_WRAPV (size, page, &size))
+    return false;
+  size -= (gap + nbytes) % page;
+
+  static bool handling_sigbus;
+  if (!handling_sigbus)
+    {
+      struct sigaction action;
+      emacs_sigaction_init (&action, SIG_DFL);
+      action.sa_sigaction = handle_sigbus;
+      action.sa_flags |= SA_SIGINFO;
+      text_mapping_page = page;
+      if (sigaction (SIGBUS, &action, &old_sigbus_action) != 0)
+	return false;
+      handling_sigbus = true;
+    }
+  if (n_text_mappings == text_mappings_size)
+    text_mappings = xpalloc (text_mappings, &text_mappings_size, 1, -1,
+			     sizeof *text_mappings);
+
+  /* Keep the file open, to tell later whether it changed.  */
+  int mapfd = fcntl (fd, F_DUPFD_CLOEXEC, 0);
+  if (mapfd < 0)
+    return false;
+
+  /* Reserve room for the gap, the file and the byte after it, and
+     then map the file at the end of the gap.  The rest of the file's
+     last page, and the page after it if the file fills that one,
+     read as zeros.  Set aside as much memory again for handle_sigbus,
+     which must not allocate any.  */
+  unsigned char *beg = mmap (NULL, size, PROT_READ | PROT_WRITE,
+			     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  unsigned char *spare = mmap (NULL, size, PROT_READ | PROT_WRITE,
+			       MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+			       -1, 0);
+  if (beg == MAP_FAILED || spare == MAP_FAILED
+      || mmap (beg + gap, nbytes, PROT_READ | PROT_WRITE,
+	       MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED
+      /* Don't map past the end of a file that shrank meanwhile.  */
+      || fstat (fd, &st) != 0 || st.st_size < nbytes)
+    {
+      if (beg != MAP_FAILED)
+	munmap (beg, size);
+      if (spare != MAP_FAILED)
+	munmap (spare, size);
+      emacs_close (mapfd);
+      return false;
+    }
+
+  block_input ();
+  free_buffer_text (b);
+  text_mappings[n_text_mappings++]
+    = (struct text_mapping) { .beg = beg, .size = size, .spare = spare,
+			      .fd = mapfd, .file_size = st.st_size,
+			      .mtime = get_stat_mtime (&st) };
+  b->text->beg = beg;
+  b->text->mapped = true;
+  b->text->end_slack = 0;
+  BUF_GAP_SIZE (b) = gap + nbytes;
+  unblock_input ();
+  return true;
+#else
+  return false;
+#endif
+}
+
 /* Enlarge buffer B's text buffer by DELTA bytes.  DELTA < 0 means
-   shrink it.  */
+   shrink it.  The size of the text buffer includes B's end slack, which
+   the caller must adjust if DELTA changes it.  */
 
 void
 enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
@@ -5061,10 +5352,11 @@ enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
   void *p;
   unsigned char *old_beg = b->text->beg;
   ptrdiff_t old_nbytes =
-    BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) + BUF_GAP_SIZE (b) + 1;
+    BUF_Z_BYTE (b) - BUF_BEG_BYTE (b) + BUF_GAP_SIZE (b) + 1
+    + b->text->end_slack;
   ptrdiff_t new_nbytes = old_nbytes + delta;
 
-  if (pdumper_object_p (old_beg))
+  if (pdumper_object_p (old_beg) || b->text->mapped)
     b->text->beg = NULL;
   else
     old_beg = NULL;
@@ -5088,6 +5380,8 @@ enlarge_buffer_text (struct buffer *b, ptrdiff_t delta)
 
   if (old_beg)
     memcpy (p, old_beg, min (old_nbytes, new_nbytes));
+  if (b->text->mapped)
+    unmap_buffer_text (b, old_beg);
 
   BUF_BEG_ADDR (b) = p;
   unblock_input ();
@@ -5101,7 +5395,9 @@ free_buffer_text (struct buffer *b)
 {
   block_input ();
 
-  if (!pdumper_object_p (b->text->beg))
+  if (b->text->mapped)
+    unmap_buffer_text (b, b->text->beg);
+  else if (!pdumper_object_p (b->text->beg))
     {
 #if defined USE_MMAP_FOR_BUFFERS
       mmap_free ((void **) &b->text->beg);
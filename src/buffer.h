@@ -157,6 +157,11 @@ #define END_UNCHANGED BUF_END_UNCHANGED (current_buffer)
 				 ptrdiff_t, ptrdiff_t);
 extern void set_point_from_marker (Lisp_Object);
 extern void enlarge_buffer_text (struct buffer *, ptrdiff_t);
+extern bool map_buffer_text (struct buffer *, int, ptrdiff_t);
+extern bool volatile mapped_text_lost;
+extern void report_lost_mapped_text (void);
+extern void report_changed_mapped_text (struct buffer *);
+extern void unmap_buffer_text_of_file (struct buffer *, char const *);
 
 INLINE void
 SET_PT (ptrdiff_t position)
@@ -228,6 +233,8 @@ #define FETCH_BYTE(n) *(BYTE_POS_ADDR ((n)))
     ptrdiff_t gpt_byte;		/* Byte pos of gap in buffer.  */
     ptrdiff_t z_byte;		/* Byte pos of end of buffer.  */
     ptrdiff_t gap_size;		/* Size of buffer's gap.  */
+    ptrdiff_t end_slack;	/* Size of free space after the anchor
+				   at Z; see make_room_at_point.  */
     modiff_count modiff;	/* This counts buffer-modification events
 				   for this buffer.  It is incremented for
 				   each such event, and never otherwise
@@ -278,6 +285,10 @@ #define FETCH_BYTE(n) *(BYTE_POS_ADDR ((n)))
 
     /* True if it needs to be redisplayed.  */
     bool_bf redisplay : 1;
+
+    /* True if BEG is a private mapping of a file made by
+       map_buffer_text, rather than allocated memory.  */
+    bool_bf mapped : 1;
   };
 
 /* Most code should use this macro to access Lisp fields in struct buffer.  */
@@ -388,14 +388,21 @@ exec_byte_code (Lisp_Object bytestr, Lisp_Object vector, Lisp_Object maxdepth,
 	Fsignal (Qwrong_number_of_arguments,
 		 list2 (Fcons (make_fixnum (mandatory), make_fixnum (nonrest)),
 			make_fixnum (nargs)));
+      /* Copy the arguments that fill positional slots in one go; the
+	 remaining work depends only on the arity class.  */
       ptrdiff_t pushedargs = min (nonrest, nargs);
-      for (ptrdiff_t i = 0; i < pushedargs; i++, args++)
-	PUSH (*args);
+      memcpy (top + 1, args, pushedargs * word_size);
+      top += pushedargs;
       if (nonrest < nargs)
-	PUSH (Flist (nargs - nonrest, args));
-      else
-	for (ptrdiff_t i = nargs - rest; i < nonrest; i++)
-	  PUSH (Qnil);
+	/* &rest with surplus arguments.  */
+	PUSH (rest_args_list (nargs - nonrest, args + nonrest));
+      else if (nargs < nonrest + rest)
+	/* Missing &optional arguments, and an empty &rest.  */
+	{
+	  ptrdiff_t missing = nonrest + rest - nargs;
+	  memclear (top + 1, missing * word_size);
+	  top += missing;
+	}
     }
 
   while (true)
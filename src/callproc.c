@@ -35,6 +35,23 @@ Copyright (C) 1985-1988, 1993-1995, 1999-2021 Free Software Foundation,
 # include <sys/stropts.h>
 #endif
 
+/* Whether posix_spawn can start subprocesses; it must be able to
+   change the working directory and create a new session.  */
+#if (defined HAVE_SPAWN_H && defined HAVE_POSIX_SPAWN			\
+     && defined HAVE_POSIX_SPAWNATTR_SETFLAGS				\
+     && (defined HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR			\
+	 || defined HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR_NP)		\
+     && defined HAVE_DECL_POSIX_SPAWN_SETSID && HAVE_DECL_POSIX_SPAWN_SETSID)
+# include <spawn.h>
+# define USABLE_POSIX_SPAWN 1
+# ifndef HAVE_POSIX_SPAWN_FILE_ACTIONS_ADDCHDIR
+#  define posix_spawn_file_actions_addchdir \
+     posix_spawn_file_actions_addchdir_np
+# endif
+#else
+# define USABLE_POSIX_SPAWN 0
+#endif
+
 #ifdef WINDOWSNT
 #include <sys/socket.h>	/* for fcntl */
 #include <windows.h>
@@ -104,6 +121,11 @@ #define _P_NOWAIT 1	/* from process.h */
     CALLPROC_FDS
   };
 
+/* The capacity to ask for the pipe from the subsidiary process's
+   stdout.  The child stalls whenever the pipe is full, which with the
+   usual 64 KiB happens every time Emacs stops reading to decode.  */
+enum { CALLPROC_PIPE_SIZE = 1024 * 1024 };
+
 static Lisp_Object call_process (ptrdiff_t, Lisp_Object *, int, ptrdiff_t);
 
 #ifdef DOS_NT
@@ -531,6 +553,12 @@ call_process (ptrdiff_t nargs, Lisp_Object *args, int filefd,
 	report_file_error ("Creating process pipe", Qnil);
       callproc_fd[CALLPROC_PIPEREAD] = fd[0];
       fd_output = fd[1];
+#ifdef F_SETPIPE_SZ
+      /* Let the child run ahead while we decode and insert what it
+	 has already written.  If the system refuses, the default
+	 capacity will do.  */
+      fcntl (fd[0], F_SETPIPE_SZ, CALLPROC_PIPE_SIZE);
+#endif
     }
   callproc_fd[CALLPROC_STDOUT] = fd_output;
 
@@ -1089,36 +1117,52 @@ t (mix it with ordinary output), or a file name string.
   return unbind_to (count, val);
 }
 
+/* The names of the variables in an environment block that is being
+   built, so that all but the first definition of each variable can be
+   dropped in constant time.  */
+
+struct env_names
+{
+  /* Open-addressed hash table of environment strings, each standing
+     for its variable name; unused slots are null.  */
+  char **table;
+  /* The size of TABLE minus one; the size is a power of two.  */
+  ptrdiff_t mask;
+};
+
+/* Add STRING to the environment block whose end is NEW_ENV, and return
+   the new end.  Do not add it if its variable is already in NAMES,
+   since when an env var has multiple definitions, we keep the
+   definition that comes first in process-environment.  A lone
+   variable name is a placeholder for a variable that is not to be
+   included in the environment; it is never added, but it hides later
+   definitions.  */
+
 static char **
-add_env (char **env, char **new_env, char *string)
+add_env (struct env_names *names, char **new_env, char *string)
 {
-  char **ep;
-  bool ok = 1;
   if (string == NULL)
     return new_env;
 
-  /* See if this string duplicates any string already in the env.
-     If so, don't put it in.
-     When an env var has multiple definitions,
-     we keep the definition that comes first in process-environment.  */
-  for (ep = env; ok && ep != new_env; ep++)
+  ptrdiff_t len = 0;
+  while (string[len] && string[len] != '=')
+    len++;
+
+  for (ptrdiff_t i = hash_string (string, len) & names->mask; ;
+       i = (i + 1) & names->mask)
     {
-      char *p = *ep, *q = string;
-      while (ok)
+      char *name = names->table[i];
+      if (!name)
 	{
-	  if (*p && *q != *p)
-	    break;
-	  if (*q == 0)
-	    /* The string is a lone variable name; keep it for now, we
-	       will remove it later.  It is a placeholder for a
-	       variable that is not to be included in the environment.  */
-	    break;
-	  if (*q == '=')
-	    ok = 0;
-	  p++, q++;
+	  names->table[i] = string;
+	  break;
 	}
+      if (memcmp (name, string, len) == 0
+	  && (name[len] == '=' || name[len] == '\0'))
+	return new_env;
     }
-  if (ok)
+
+  if (string[len] == '=')
     *new_env++ = string;
   return new_env;
 }
@@ -1227,6 +1271,73 @@ child_setup (int in, int out, int err, char **new_argv, char **env,
 #endif  /* not WINDOWSNT */
 }
 
+#if USABLE_POSIX_SPAWN
+
+/* Start a new subprocess with posix_spawn, setting it up as
+   emacs_spawn and child_setup would for a subprocess without a
+   pseudoterminal.  The arguments are as for emacs_spawn.  Return zero
+   if successful, and an error number otherwise.  */
+
+static int
+emacs_posix_spawn (pid_t *newpid, int std_in, int std_out, int std_err,
+		   char **argv, char **envp, const char *cwd,
+		   const sigset_t *oldset)
+{
+  posix_spawn_file_actions_t actions;
+  posix_spawnattr_t attributes;
+  sigset_t sigdefault;
+
+  int error = posix_spawn_file_actions_init (&actions);
+  if (error != 0)
+    return error;
+  error = posix_spawnattr_init (&attributes);
+  if (error != 0)
+    {
+      posix_spawn_file_actions_destroy (&actions);
+      return error;
+    }
+
+  /* The signals that emacs_spawn resets in a vforked child.  */
+  sigemptyset (&sigdefault);
+#ifdef DARWIN_OS
+  sigaddset (&sigdefault, SIGCHLD);
+#endif
+  sigaddset (&sigdefault, SIGINT);
+  sigaddset (&sigdefault, SIGQUIT);
+#ifdef SIGPROF
+  sigaddset (&sigdefault, SIGPROF);
+#endif
+  sigaddset (&sigdefault, SIGPIPE);
+
+  error = posix_spawn_file_actions_adddup2 (&actions, std_in, STDIN_FILENO);
+  if (error == 0)
+    error = posix_spawn_file_actions_adddup2 (&actions, std_out,
+					      STDOUT_FILENO);
+  if (error == 0)
+    error = posix_spawn_file_actions_adddup2 (&actions,
+					      std_err < 0 ? std_out : std_err,
+					      STDERR_FILENO);
+  if (error == 0)
+    error = posix_spawn_file_actions_addchdir (&actions, cwd);
+  if (error == 0)
+    error = posix_spawnattr_setflags (&attributes,
+				      (POSIX_SPAWN_SETSID
+				       | POSIX_SPAWN_SETSIGDEF
+				       | POSIX_SPAWN_SETSIGMASK));
+  if (error == 0)
+    error = posix_spawnattr_setsigdefault (&attributes, &sigdefault);
+  if (error == 0)
+    error = posix_spawnattr_setsigmask (&attributes, oldset);
+  if (error == 0)
+    error = posix_spawn (newpid, argv[0], &actions, &attributes, argv, envp);
+
+  posix_spawnattr_destroy (&attributes);
+  posix_spawn_file_actions_destroy (&actions);
+  return error;
+}
+
+#endif	/* USABLE_POSIX_SPAWN */
+
 /* Start a new asynchronous subprocess.  If successful, return zero
    and store the process identifier of the new process in *NEWPID.
    Use STDIN, STDOUT, and STDERR as standard streams for the new
@@ -1250,6 +1361,16 @@ emacs_spawn (pid_t *newpid, int std_in, int std_out, int std_err,
 
   eassert (input_blocked_p ());
 
+#if USABLE_POSIX_SPAWN
+  /* Prefer posix_spawn, which does not run any of our code in the
+     child.  It cannot set up a pseudoterminal, restore the limit on
+     open files or reenable ASLR, so vfork if any of that is needed.  */
+  if (pty == NULL && !nofile_limit_lowered_p ()
+      && !emacs_exec_file_special_p ())
+    return emacs_posix_spawn (newpid, std_in, std_out, std_err,
+			      argv, envp, cwd, oldset);
+#endif
+
 #ifndef WINDOWSNT
   /* vfork, and prevent local vars from being clobbered by the vfork.  */
   pid_t *volatile newpid_volatile = newpid;
@@ -1570,9 +1691,9 @@ make_environment_block (Lisp_Object current_dir)
   {
     register Lisp_Object tem;
     register char **new_env;
-    char **p, **q;
     register int new_length;
     Lisp_Object display = Qnil;
+    struct env_names names;
 
     new_length = 0;
 
@@ -1606,37 +1727,35 @@ make_environment_block (Lisp_Object current_dir)
     /* new_length + 2 to include PWD and terminating 0.  */
     env = new_env = xnmalloc (new_length + 2, sizeof *env);
     record_unwind_protect_ptr (xfree, env);
+
+    /* Make the hash table of names at most half full.  */
+    names.mask = 1;
+    while (names.mask < 2 * (new_length + 2))
+      names.mask *= 2;
+    names.table = xzalloc (names.mask * sizeof *names.table);
+    record_unwind_protect_ptr (xfree, names.table);
+    names.mask--;
+
     /* If we have a PWD envvar, pass one down,
        but with corrected value.  */
     if (egetenv ("PWD"))
-      *new_env++ = pwd_var;
+      new_env = add_env (&names, new_env, pwd_var);
 
     if (STRINGP (display))
       {
 	char *vdata = xmalloc (sizeof "DISPLAY=" + SBYTES (display));
 	record_unwind_protect_ptr (xfree, vdata);
 	lispstpcpy (stpcpy (vdata, "DISPLAY="), display);
-	new_env = add_env (env, new_env, vdata);
+	new_env = add_env (&names, new_env, vdata);
       }
 
     /* Overrides.  */
     for (tem = Vprocess_environment;
 	 CONSP (tem) && STRINGP (XCAR (tem));
 	 tem = XCDR (tem))
-      new_env = add_env (env, new_env, SSDATA (XCAR (tem)));
+      new_env = add_env (&names, new_env, SSDATA (XCAR (tem)));
 
     *new_env = 0;
-
-    /* Remove variable names without values.  */
-    p = q = env;
-    while (*p != 0)
-      {
-	while (*q != 0 && strchr (*q, '=') == NULL)
-	  q++;
-	*p = *q++;
-	if (*p != 0)
-	  p++;
-      }
   }
 
   return env;
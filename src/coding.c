@@ -1118,6 +1118,168 @@ #define UTF_8_BOM_1 0xEF
 #define UTF_8_BOM_2 0xBB
 #define UTF_8_BOM_3 0xBF
 
+static Lisp_Object get_translation_table (Lisp_Object attrs, bool encodep,
+					  int *max_lookup);
+
+/* Runs of ASCII text, and other runs of bytes that a scan has no use
+   for, are skipped a word at a time.  */
+
+typedef uintptr_t coding_word;
+#define CODING_WORD_ONES ((coding_word) -1 / 0xff)
+
+static coding_word
+load_coding_word (const unsigned char *p)
+{
+  coding_word w;
+  memcpy (&w, p, sizeof w);
+  return w;
+}
+
+/* Return true if some byte of W is less than N, which must be at
+   most 0x80.  */
+
+static bool
+coding_word_has_less (coding_word w, unsigned char n)
+{
+  return ((w - CODING_WORD_ONES * n) & ~w & CODING_WORD_ONES * 0x80) != 0;
+}
+
+/* Return true if some byte of W is B.  */
+
+static bool
+coding_word_has_byte (coding_word w, unsigned char b)
+{
+  return coding_word_has_less (w ^ (CODING_WORD_ONES * b), 1);
+}
+
+/* Return the end of the longest run of whole words of ASCII bytes
+   from SRC to END.  If EOL_SEEN is non-null, the run also stops
+   before any CR, and EOL_SEEN_LF is added to *EOL_SEEN if the run
+   contains an LF.  */
+
+static const unsigned char *
+skip_ascii_words (const unsigned char *src, const unsigned char *end,
+		  int *eol_seen)
+{
+  bool lf = false;
+
+  while (end - src >= sizeof (coding_word))
+    {
+      coding_word w = load_coding_word (src);
+      if (w & CODING_WORD_ONES * 0x80)
+	break;
+      if (eol_seen)
+	{
+	  if (coding_word_has_byte (w, '\r'))
+	    break;
+	  lf |= coding_word_has_byte (w, '\n');
+	}
+      src += sizeof w;
+    }
+  if (lf)
+    *eol_seen |= EOL_SEEN_LF;
+  return src;
+}
+
+/* Return the end of the longest run of whole words from SRC to END
+   that contain no control characters, that is, no bytes below 0x20.
+   If ASCII_ONLY, the run also stops before any byte with the high bit
+   set.  */
+
+static const unsigned char *
+skip_non_control_words (const unsigned char *src, const unsigned char *end,
+			bool ascii_only)
+{
+  while (end - src >= sizeof (coding_word))
+    {
+      coding_word w = load_coding_word (src);
+      if ((ascii_only && (w & CODING_WORD_ONES * 0x80))
+	  || coding_word_has_less (w, 0x20))
+	break;
+      src += sizeof w;
+    }
+  return src;
+}
+
+/* Return the end of the longest run of whole words from SRC to END
+   that contain neither LF nor CR.  */
+
+static const unsigned char *
+skip_non_eol_words (const unsigned char *src, const unsigned char *end)
+{
+  while (end - src >= sizeof (coding_word))
+    {
+      coding_word w = load_coding_word (src);
+      if (coding_word_has_byte (w, '\n') || coding_word_has_byte (w, '\r'))
+	break;
+      src += sizeof w;
+    }
+  return src;
+}
+
+/* Return the length of the longest prefix of the NBYTES bytes at SRC
+   that decode_coding_utf_8 would decode into exactly the same bytes
+   in the internal representation, and store in *NCHARS the number of
+   characters in it.  These are the well-formed sequences of at most
+   4 bytes, for characters that are not surrogates.  */
+
+static ptrdiff_t
+utf_8_internal_prefix (const unsigned char *src, ptrdiff_t nbytes,
+		       ptrdiff_t *nchars)
+{
+  const unsigned char *p = src, *end = src + nbytes;
+  ptrdiff_t n = 0;
+
+  while (p < end)
+    {
+      const unsigned char *q = skip_ascii_words (p, end, NULL);
+      n += q - p;
+      p = q;
+      if (p == end)
+	break;
+
+      int c = *p;
+      int len;
+      if (UTF_8_1_OCTET_P (c))
+	len = 1;
+      else if (UTF_8_2_OCTET_LEADING_P (c))
+	len = (c >= 0xC2 && end - p >= 2 && UTF_8_EXTRA_OCTET_P (p[1])
+	       ? 2 : 0);
+      else if (UTF_8_3_OCTET_LEADING_P (c))
+	{
+	  len = 0;
+	  if (end - p >= 3
+	      && UTF_8_EXTRA_OCTET_P (p[1]) && UTF_8_EXTRA_OCTET_P (p[2]))
+	    {
+	      c = (((c & 0xF) << 12) | ((p[1] & 0x3F) << 6) | (p[2] & 0x3F));
+	      if (c >= 0x800 && ! (c >= 0xd800 && c < 0xe000))
+		len = 3;
+	    }
+	}
+      else if (UTF_8_4_OCTET_LEADING_P (c))
+	{
+	  len = 0;
+	  if (end - p >= 4
+	      && UTF_8_EXTRA_OCTET_P (p[1]) && UTF_8_EXTRA_OCTET_P (p[2])
+	      && UTF_8_EXTRA_OCTET_P (p[3]))
+	    {
+	      c = (((c & 0x7) << 18) | ((p[1] & 0x3F) << 12)
+		   | ((p[2] & 0x3F) << 6) | (p[3] & 0x3F));
+	      if (c >= 0x10000)
+		len = 4;
+	    }
+	}
+      else
+	len = 0;
+      if (! len)
+	break;
+      p += len;
+      n++;
+    }
+  *nchars = n;
+  return p - src;
+}
+
 /* Unlike the other detect_coding_XXX, this function counts the number
    of characters and checks the EOL format.  */
 
@@ -1152,6 +1314,12 @@ detect_coding_utf_8 (struct coding_system *coding,
     {
       int c, c1, c2, c3, c4;
 
+      if (! multibytep)
+	{
+	  const unsigned char *p = skip_ascii_words (src, src_end, &eol_seen);
+	  nchars += p - src;
+	  src = p;
+	}
       src_base = src;
       ONE_MORE_BYTE (c);
       if (c < 0 || UTF_8_1_OCTET_P (c))
@@ -1283,6 +1451,37 @@ decode_coding_utf_8 (struct coding_system *coding)
     }
   CODING_UTF_8_BOM (coding) = utf_without_bom;
 
+  /* If a unibyte source starts with text whose internal
+     representation is the same bytes, let produce_chars copy them as
+     they are, instead of decoding them into charbuf and encoding them
+     again.  produce_chars copies from the start of the source, so
+     this can be done only there; the rest is decoded as usual.  */
+  if (src == coding->source && coding->charbuf_used == 0
+      && ! multibytep && coding->dst_multibyte
+      && NILP (get_translation_table (CODING_ID_ATTRS (coding->id), false,
+				      NULL)))
+    {
+      ptrdiff_t nchars;
+      ptrdiff_t nbytes = utf_8_internal_prefix (src, src_end - src, &nchars);
+
+      /* Leave a CR at the end to the code below, which can pair it
+	 with an LF that comes in the next block.  */
+      if (eol_dos && nbytes > 0 && src + nbytes == src_end
+	  && src[nbytes - 1] == '\r')
+	nbytes--, nchars--;
+      if (nbytes > 0)
+	{
+	  coding->chars_at_source = 1;
+	  coding->chars_at_source_multibyte = 1;
+	  coding->consumed = nbytes;
+	  coding->consumed_char = nchars;
+	  record_conversion_result (coding, CODING_RESULT_SUCCESS);
+	  return;
+	}
+    }
+  coding->chars_at_source = 0;
+  coding->chars_at_source_multibyte = 0;
+
   while (1)
     {
       int c, c1, c2, c3, c4, c5;
@@ -2961,6 +3160,18 @@ detect_coding_iso_2022 (struct coding_system *coding,
 
   while (rejected != CATEGORY_MASK_ISO)
     {
+      /* Printable ASCII is handled as by the default case below.  */
+      if (! multibytep)
+	{
+	  const unsigned char *p = skip_non_control_words (src, src_end, true);
+	  if (p != src)
+	    {
+	      if (composition_count >= 0)
+		composition_count += p - src;
+	      single_shifting = 0;
+	      src = p;
+	    }
+	}
       src_base = src;
       ONE_MORE_BYTE (c);
       switch (c)
@@ -4593,6 +4804,8 @@ detect_coding_sjis (struct coding_system *coding,
 
   while (1)
     {
+      if (! multibytep)
+	src = skip_ascii_words (src, src_end, NULL);
       src_base = src;
       ONE_MORE_BYTE (c);
       if (c < 0x80)
@@ -4643,6 +4856,8 @@ detect_coding_big5 (struct coding_system *coding,
 
   while (1)
     {
+      if (! multibytep)
+	src = skip_ascii_words (src, src_end, NULL);
       src_base = src;
       ONE_MORE_BYTE (c);
       if (c < 0x80)
@@ -6176,8 +6391,11 @@ check_ascii (struct coding_system *coding)
       || SYMBOLP (eol_type))
     {
       /* We don't have to check EOL format.  */
-      while (src < end && !( *src & 0x80))
+      while (src < end)
 	{
+	  src = skip_ascii_words (src, end, &eol_seen);
+	  if (src == end || (*src & 0x80))
+	    break;
 	  if (*src++ == '\n')
 	    eol_seen |= EOL_SEEN_LF;
 	}
@@ -6187,6 +6405,10 @@ check_ascii (struct coding_system *coding)
       end--;		    /* We look ahead one byte for "CR LF".  */
       while (src < end)
 	{
+	  src = skip_ascii_words (src, end, &eol_seen);
+	  if (src == end)
+	    break;
+
 	  int c = *src;
 
 	  if (c & 0x80)
@@ -6226,63 +6448,59 @@ check_ascii (struct coding_system *coding)
 }
 
 
-/* Return the number of characters at the source if all the bytes are
-   valid UTF-8 (of Unicode range).  Otherwise, return -1.  By side
-   effects, update coding->eol_seen.  The value of coding->eol_seen is
-   "logical or" of EOL_SEEN_LF, EOL_SEEN_CR, and EOL_SEEN_CRLF, but
-   the value is reliable only when all the source bytes are valid
-   UTF-8.  */
+/* Return the number of characters from SRC to END if all the bytes
+   are valid UTF-8 (of Unicode range).  Otherwise, return -1.  Add to
+   *EOL_SEEN the EOL formats seen, as for check_utf_8.  */
 
 static ptrdiff_t
-check_utf_8 (struct coding_system *coding)
+check_utf_8_range (const unsigned char *src, const unsigned char *end,
+		   int *eol_seen)
 {
-  const unsigned char *src, *end;
-  int eol_seen;
-  ptrdiff_t nchars = coding->head_ascii;
+  ptrdiff_t nchars = 0;
+  int seen = *eol_seen;
 
-  if (coding->head_ascii < 0)
-    check_ascii (coding);
-  else
-    coding_set_source (coding);
-  src = coding->source + coding->head_ascii;
-  /* We look ahead one byte for CR LF.  */
-  end = coding->source + coding->src_bytes - 1;
-  eol_seen = coding->eol_seen;
   while (src < end)
     {
       int c = *src;
 
-      if (UTF_8_1_OCTET_P (*src))
+      if (UTF_8_1_OCTET_P (c))
 	{
+	  const unsigned char *p = skip_ascii_words (src, end, &seen);
+	  if (p != src)
+	    {
+	      nchars += p - src;
+	      src = p;
+	      continue;
+	    }
 	  src++;
 	  if (c < 0x20)
 	    {
 	      if (c == '\r')
 		{
-		  if (*src == '\n')
+		  if (src < end && *src == '\n')
 		    {
-		      eol_seen |= EOL_SEEN_CRLF;
+		      seen |= EOL_SEEN_CRLF;
 		      src++;
 		      nchars++;
 		    }
 		  else
-		    eol_seen |= EOL_SEEN_CR;
+		    seen |= EOL_SEEN_CR;
 		}
 	      else if (c == '\n')
-		eol_seen |= EOL_SEEN_LF;
+		seen |= EOL_SEEN_LF;
 	    }
 	}
       else if (UTF_8_2_OCTET_LEADING_P (c))
 	{
 	  if (c < 0xC2		/* overlong sequence */
-	      || src + 1 >= end
+	      || end - src < 2
 	      || ! UTF_8_EXTRA_OCTET_P (src[1]))
 	    return -1;
 	  src += 2;
 	}
       else if (UTF_8_3_OCTET_LEADING_P (c))
 	{
-	  if (src + 2 >= end
+	  if (end - src < 3
 	      || ! (UTF_8_EXTRA_OCTET_P (src[1])
 		    && UTF_8_EXTRA_OCTET_P (src[2])))
 	    return -1;
@@ -6295,7 +6513,7 @@ check_utf_8 (struct coding_system *coding)
 	}
       else if (UTF_8_4_OCTET_LEADING_P (c))
 	{
-	  if (src + 3 >= end
+	  if (end - src < 4
 	      || ! (UTF_8_EXTRA_OCTET_P (src[1])
 		    && UTF_8_EXTRA_OCTET_P (src[2])
 		    && UTF_8_EXTRA_OCTET_P (src[3])))
@@ -6312,16 +6530,159 @@ check_utf_8 (struct coding_system *coding)
       nchars++;
     }
 
-  if (src == end)
+  *eol_seen = seen;
+  return nchars;
+}
+
+/* Large texts are checked and converted by several threads, each
+   working on one chunk of the text.  Chunks do not split a UTF-8
+   sequence or a CR LF pair, so that each chunk can be handled on its
+   own and the results simply combined.  */
+
+enum { CODING_MAX_CHUNKS = 16 };
+
+struct coding_chunk
+{
+  /* The text of this chunk.  */
+  unsigned char *beg, *end;
+
+  /* The number of characters in it, or -1 if it is not valid.  */
+  ptrdiff_t nchars;
+
+  /* The EOL formats seen in it.  */
+  int eol_seen;
+};
+
+/* Return the number of chunks to split NBYTES bytes of text into, or
+   1 if they are not worth handling in parallel.  */
+
+static int
+coding_chunk_count (ptrdiff_t nbytes)
+{
+#if defined THREADS_ENABLED && defined _SC_NPROCESSORS_ONLN
+  if (FIXNATP (Vparallel_decoding_threshold)
+      && XFIXNAT (Vparallel_decoding_threshold) <= nbytes)
+    {
+      long ncpus = sysconf (_SC_NPROCESSORS_ONLN);
+      return clip_to_bounds (1, ncpus, CODING_MAX_CHUNKS);
+    }
+#endif
+  return 1;
+}
+
+/* Split the text from BEG to END into N chunks, which CHUNKS must
+   have room for.  */
+
+static void
+split_coding_chunks (unsigned char *beg, unsigned char *end,
+		     struct coding_chunk *chunks, int n)
+{
+  unsigned char *p = beg;
+  for (int i = 0; i < n; i++)
+    {
+      unsigned char *q = end;
+      if (i < n - 1)
+	{
+	  unsigned char *limit;
+	  q = max (p, beg + (end - beg) / n * (i + 1));
+	  limit = q + min (end - q, MAX_MULTIBYTE_LENGTH);
+	  while (q < limit && UTF_8_EXTRA_OCTET_P (*q))
+	    q++;
+	  if (beg < q && q < end && q[-1] == '\r' && *q == '\n')
+	    q++;
+	}
+      chunks[i].beg = p;
+      chunks[i].end = q;
+      chunks[i].nchars = 0;
+      chunks[i].eol_seen = EOL_SEEN_NONE;
+      p = q;
+    }
+}
+
+/* Check that the text of the chunk ARG is valid UTF-8.  */
+
+static void
+check_utf_8_chunk (void *arg)
+{
+  struct coding_chunk *chunk = arg;
+  chunk->nchars = check_utf_8_range (chunk->beg, chunk->end,
+				     &chunk->eol_seen);
+}
+
+/* Convert each CR LF in the chunk ARG into LF, moving the text to the
+   end of the chunk, and set its nchars to the number of bytes
+   removed.  */
+
+static void
+decode_eol_dos_chunk (void *arg)
+{
+  struct coding_chunk *chunk = arg;
+  unsigned char *beg = chunk->beg;
+  unsigned char *src = chunk->end, *dst = src, *p = src;
+  unsigned char *lf;
+
+  while (beg < p && (lf = memrchr (beg, '\n', p - beg)))
     {
-      if (! UTF_8_1_OCTET_P (*src))
+      if (beg < lf && lf[-1] == '\r')
+	{
+	  dst -= src - lf;
+	  memmove (dst, lf, src - lf);
+	  src = p = lf - 1;
+	}
+      else
+	p = lf;
+    }
+  dst -= src - beg;
+  memmove (dst, beg, src - beg);
+  chunk->beg = dst;
+  chunk->nchars = dst - beg;
+}
+
+/* Return the number of characters at the source if all the bytes are
+   valid UTF-8 (of Unicode range).  Otherwise, return -1.  By side
+   effects, update coding->eol_seen.  The value of coding->eol_seen is
+   "logical or" of EOL_SEEN_LF, EOL_SEEN_CR, and EOL_SEEN_CRLF, but
+   the value is reliable only when all the source bytes are valid
+   UTF-8.  */
+
+static ptrdiff_t
+check_utf_8 (struct coding_system *coding)
+{
+  unsigned char *src, *end;
+  int eol_seen;
+  ptrdiff_t nchars;
+
+  if (coding->head_ascii < 0)
+    check_ascii (coding);
+  else
+    coding_set_source (coding);
+  nchars = coding->head_ascii;
+  src = (unsigned char *) coding->source + coding->head_ascii;
+  end = (unsigned char *) coding->source + coding->src_bytes;
+  eol_seen = coding->eol_seen;
+
+  int n = coding_chunk_count (end - src);
+  if (n == 1)
+    {
+      ptrdiff_t chars = check_utf_8_range (src, end, &eol_seen);
+      if (chars < 0)
 	return -1;
-      nchars++;
-      if (*src == '\r')
-	eol_seen |= EOL_SEEN_CR;
-      else if (*src  == '\n')
-	eol_seen |= EOL_SEEN_LF;
+      nchars += chars;
+    }
+  else
+    {
+      struct coding_chunk chunks[CODING_MAX_CHUNKS];
+      split_coding_chunks (src, end, chunks, n);
+      sys_run_parallel (check_utf_8_chunk, chunks, sizeof *chunks, n);
+      for (int i = 0; i < n; i++)
+	{
+	  if (chunks[i].nchars < 0)
+	    return -1;
+	  nchars += chunks[i].nchars;
+	  eol_seen |= chunks[i].eol_seen;
+	}
     }
+
   coding->eol_seen = eol_seen;
   return nchars;
 }
@@ -6445,7 +6806,7 @@ detect_eol (const unsigned char *source, ptrdiff_t src_bytes,
 	}
     }
   else
-    while (src < src_end)
+    while ((src = skip_non_eol_words (src, src_end)) < src_end)
       {
 	c = *src++;
 	if (c == '\n' || c == '\r')
@@ -6546,6 +6907,15 @@ detect_coding (struct coding_system *coding)
       detect_info.checked = detect_info.found = detect_info.rejected = 0;
       for (src = coding->source; src < src_end; src++)
 	{
+	  /* Bytes other than control characters only count as ASCII
+	     until the first 8-bit byte, and need no other handling.  */
+	  const unsigned char *p
+	    = skip_non_control_words (src, src_end, ! eight_bit_found);
+	  if (! eight_bit_found)
+	    coding->head_ascii += p - src;
+	  src = p;
+	  if (src == src_end)
+	    break;
 	  c = *src;
 	  if (c & 0x80)
 	    {
@@ -6797,6 +7167,14 @@ decode_eol (struct coding_system *coding)
     {
       int eol_seen = EOL_SEEN_NONE;
 
+      /* Without any CR, there is nothing to count or convert.  */
+      if (! memchr (pbeg, '\r', pend - pbeg))
+	{
+	  if (memchr (pbeg, '\n', pend - pbeg))
+	    adjust_coding_eol_type (coding, EOL_SEEN_LF);
+	  return;
+	}
+
       for (p = pbeg; p < pend; p++)
 	{
 	  if (*p == '\n')
@@ -6832,7 +7210,7 @@ decode_eol (struct coding_system *coding)
 	if (*p == '\r')
 	  *p = '\n';
     }
-  else if (EQ (eol_type, Qdos))
+  else if (EQ (eol_type, Qdos) && memchr (pbeg, '\r', pend - pbeg))
     {
       ptrdiff_t n = 0;
       ptrdiff_t pos = coding->dst_pos;
@@ -7109,7 +7487,8 @@ produce_chars (struct coding_system *coding, Lisp_Object translation_table,
 	  eassert (growable_destination (coding));
 	  dst_end = (unsigned char *) src;
 	}
-      if (coding->src_multibyte != coding->dst_multibyte)
+      if (coding->src_multibyte != coding->dst_multibyte
+	  && ! coding->chars_at_source_multibyte)
 	{
 	  if (coding->src_multibyte)
 	    {
@@ -7196,8 +7575,8 @@ produce_chars (struct coding_system *coding, Lisp_Object translation_table,
 		}
 	    }
 	  produced_chars = coding->consumed_char;
-	  while (src < src_end)
-	    *dst++ = *src++;
+	  memmove (dst, src, src_end - src);
+	  dst += src_end - src;
 	}
     }
 
@@ -7384,6 +7763,7 @@ decode_coding (struct coding_system *coding)
   coding->consumed = coding->consumed_char = 0;
   coding->produced = coding->produced_char = 0;
   coding->chars_at_source = 0;
+  coding->chars_at_source_multibyte = 0;
   record_conversion_result (coding, CODING_RESULT_SUCCESS);
 
   ALLOC_CONVERSION_WORK_AREA (coding, coding->src_bytes);
@@ -7935,9 +8315,11 @@ decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
 	chars = check_ascii (coding);
       if (chars != bytes)
 	{
-	  /* There exists a non-ASCII byte.  */
+	  /* There exists a non-ASCII byte.  If the coding system was
+	     given rather than detected, check the whole text.  */
 	  if (EQ (CODING_ATTR_TYPE (attrs), Qutf_8)
-	      && coding->detected_utf8_bytes == coding->src_bytes)
+	      && (coding->detected_utf8_bytes == coding->src_bytes
+		  || coding->detected_utf8_bytes < 0))
 	    {
 	      if (coding->detected_utf8_chars >= 0)
 		chars = coding->detected_utf8_chars;
@@ -7980,18 +8362,24 @@ decode_coding_gap (struct coding_system *coding, ptrdiff_t bytes)
 	    }
 	  else if (EQ (eol_type, Qdos))
 	    {
-	      unsigned char *src = GAP_END_ADDR;
-	      unsigned char *src_beg = src - coding->src_bytes;
-	      unsigned char *dst = src;
-	      ptrdiff_t diff;
-
-	      while (src_beg < src)
+	      unsigned char *src_end = GAP_END_ADDR;
+	      unsigned char *src = src_end - coding->src_bytes;
+	      struct coding_chunk chunks[CODING_MAX_CHUNKS];
+	      int n = coding_chunk_count (coding->src_bytes);
+	      ptrdiff_t diff = 0;
+
+	      /* Convert each chunk in place, and then move the chunks
+		 together at the end of the gap.  */
+	      split_coding_chunks (src, src_end, chunks, n);
+	      sys_run_parallel (decode_eol_dos_chunk, chunks, sizeof *chunks,
+				n);
+	      for (int i = n - 1; i >= 0; i--)
 		{
-		  *--dst = *--src;
-		  if (*src == '\n' && src > src_beg && src[-1] == '\r')
-		    src--;
+		  ptrdiff_t len = chunks[i].end - chunks[i].beg;
+		  memmove (src_end - len, chunks[i].beg, len);
+		  src_end -= len;
+		  diff += chunks[i].nchars;
 		}
-	      diff = dst - src;
 	      bytes -= diff;
 	      chars -= diff;
 	    }
@@ -8243,6 +8631,54 @@ decode_coding_object (struct coding_system *coding,
   unbind_to (count, coding->dst_object);
 }
 
+/* Decode the NBYTES bytes at SRC by CODING, and insert the result at
+   point in the current buffer, which must be multibyte.  Like
+   insert_from_string_before_markers, run the change hooks and leave
+   point and any markers at point after the new text.  Unlike it,
+   decode straight into the gap, without an intermediate string.
+   CODING must not require detection or have a post-read-conversion.  */
+
+void
+decode_coding_insert_before_markers (struct coding_system *coding,
+				     const unsigned char *src,
+				     ptrdiff_t nbytes)
+{
+  ptrdiff_t opoint = PT, opoint_byte = PT_BYTE;
+  Lisp_Object buffer;
+
+  eassert (! NILP (BVAR (current_buffer, enable_multibyte_characters)));
+  eassert (! CODING_REQUIRE_DETECTION (coding));
+  eassert (NILP (CODING_ATTR_POST_READ (CODING_ID_ATTRS (coding->id))));
+
+  prepare_to_modify_buffer (PT, PT, NULL);
+  XSETBUFFER (buffer, current_buffer);
+  decode_coding_c_string (coding, src, nbytes, buffer);
+
+  ptrdiff_t nchars = coding->produced_char;
+  ptrdiff_t produced = coding->produced;
+  if (nchars > 0)
+    {
+      struct Lisp_Marker *m;
+
+      CHARS_MODIFF = MODIFF;
+      if (Z - GPT < END_UNCHANGED)
+	END_UNCHANGED = Z - GPT;
+
+      /* insert_from_gap moved only the markers whose insertion type
+	 is t; move the rest too.  */
+      for (m = BUF_MARKERS (current_buffer); m; m = m->next)
+	if (m->bytepos == opoint_byte)
+	  {
+	    m->bytepos = opoint_byte + produced;
+	    m->charpos = opoint + nchars;
+	  }
+      TEMP_SET_PT_BOTH (opoint + nchars, opoint_byte + produced);
+    }
+
+  signal_after_change (opoint, 0, PT - opoint);
+  update_compositions (opoint, PT, CHECK_BORDER);
+}
+
 
 void
 encode_coding_object (struct coding_system *coding,
@@ -8640,6 +9076,13 @@ detect_coding_system (const unsigned char *src,
       /* Skip all ASCII bytes except for a few ISO2022 controls.  */
       for (; src < src_end; src++)
 	{
+	  const unsigned char *p
+	    = skip_non_control_words (src, src_end, ! eight_bit_found);
+	  if (! eight_bit_found)
+	    coding.head_ascii += p - src;
+	  src = p;
+	  if (src == src_end)
+	    break;
 	  c = *src;
 	  if (c & 0x80)
 	    {
@@ -9480,6 +9923,31 @@ string_ascii_p (Lisp_Object string)
   return true;
 }
 
+/* Return true if encoding the NBYTES bytes of text at SRC with
+   CODING would produce the same bytes, so that the caller can use
+   them as they are.  This is the case for UTF-8 when nothing but the
+   eight-bit characters, whose representation starts with 0xC0 or
+   0xC1, would need conversion.  */
+
+bool
+encode_coding_identity_p (struct coding_system *coding,
+			  const unsigned char *src, ptrdiff_t nbytes)
+{
+  Lisp_Object attrs = CODING_ID_ATTRS (coding->id);
+  Lisp_Object eol_type = CODING_ID_EOL_TYPE (coding->id);
+
+  return (EQ (CODING_ATTR_TYPE (attrs), Qutf_8)
+	  && CODING_UTF_8_BOM (coding) == utf_without_bom
+	  && NILP (CODING_ATTR_PRE_WRITE (attrs))
+	  && NILP (get_translation_table (attrs, true, NULL))
+	  && (inhibit_eol_conversion || EQ (eol_type, Qunix)
+	      || VECTORP (eol_type) || ! memchr (src, '\n', nbytes))
+	  && (! (coding->mode & CODING_MODE_SELECTIVE_DISPLAY)
+	      || ! memchr (src, '\r', nbytes))
+	  && ! memchr (src, 0xC0, nbytes)
+	  && ! memchr (src, 0xC1, nbytes));
+}
+
 Lisp_Object
 code_convert_string (Lisp_Object string, Lisp_Object coding_system,
 		     Lisp_Object dst_object, bool encodep, bool nocopy,
@@ -9531,6 +9999,36 @@ code_convert_string (Lisp_Object string, Lisp_Object coding_system,
                      ? make_unibyte_string (SSDATA (string), bytes)
                      : make_multibyte_string (SSDATA (string), bytes, bytes)));
         }
+
+      /* Likewise for encoding text whose internal representation is
+         already the encoded bytes.  */
+      if (encodep && STRING_MULTIBYTE (string)
+          && encode_coding_identity_p (&coding, SDATA (string), bytes))
+        {
+          if (! norecord)
+            Vlast_coding_system_used = coding_system;
+          return make_unibyte_string (SSDATA (string), bytes);
+        }
+
+      /* Likewise for decoding UTF-8 text that is the same bytes in
+         the internal representation.  */
+      if (! encodep && ! STRING_MULTIBYTE (string)
+          && EQ (CODING_ATTR_TYPE (attrs), Qutf_8)
+          && CODING_UTF_8_BOM (&coding) == utf_without_bom
+          && NILP (CODING_ATTR_POST_READ (attrs))
+          && NILP (get_translation_table (attrs, false, NULL))
+          && (EQ (CODING_ID_EOL_TYPE (coding.id), Qunix)
+              || inhibit_eol_conversion
+              || ! memchr (SDATA (string), '\r', bytes)))
+        {
+          ptrdiff_t nchars;
+          if (utf_8_internal_prefix (SDATA (string), bytes, &nchars) == bytes)
+            {
+              if (! norecord)
+                Vlast_coding_system_used = coding_system;
+              return make_multibyte_string (SSDATA (string), nchars, bytes);
+            }
+        }
     }
   else if (BUFFERP (dst_object))
     {
@@ -12118,6 +12616,15 @@ system (e.g. `iso-2022-7bit').
 Internal use only.  Remove after the experimental optimizer becomes stable.  */);
   disable_ascii_optimization = 0;
 
+  DEFVAR_LISP ("parallel-decoding-threshold", Vparallel_decoding_threshold,
+	       doc: /* Size of text, in bytes, from which it is decoded by several threads.
+When a file or the output of a process that is at least this many bytes
+is decoded with a UTF-8 coding system, it is validated, and its CR LF
+line ends are converted, by as many threads as there are processors.
+This speeds up visiting very large files.  If nil, the default, all
+decoding is done by the main thread.  */);
+  Vparallel_decoding_threshold = Qnil;
+
   DEFVAR_LISP ("translation-table-for-input", Vtranslation_table_for_input,
 	       doc: /* Char table for translating self-inserting characters.
 This is applied to the result of input methods, not their input.
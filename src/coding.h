@@ -421,6 +421,11 @@ #define CODING_MODE_SAFE_ENCODING		0x10
      `charbuf', but at `src_object'.  */
   bool_bf chars_at_source : 1;
 
+  /* True if, in addition, those characters are already in the
+     internal multibyte representation although the source is
+     unibyte, so that they can be copied as they are.  */
+  bool_bf chars_at_source_multibyte : 1;
+
   /* Nonzero if the result of conversion is in `destination'
      buffer rather than in `dst_object'.  */
   bool_bf raw_destination : 1;
@@ -678,6 +683,8 @@ #define UTF_16_LOW_SURROGATE_P(val) \
 /* Extern declarations.  */
 extern Lisp_Object code_conversion_save (bool, bool);
 extern bool encode_coding_utf_8 (struct coding_system *);
+extern bool encode_coding_identity_p (struct coding_system *,
+				      const unsigned char *, ptrdiff_t);
 extern bool utf8_string_p (Lisp_Object);
 extern void setup_coding_system (Lisp_Object, struct coding_system *);
 extern Lisp_Object coding_charset_list (struct coding_system *);
@@ -703,6 +710,9 @@ #define UTF_16_LOW_SURROGATE_P(val) \
 extern void decode_coding_object (struct coding_system *,
                                   Lisp_Object, ptrdiff_t, ptrdiff_t,
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
+extern void decode_coding_insert_before_markers (struct coding_system *,
+						 const unsigned char *,
+						 ptrdiff_t);
 extern void encode_coding_object (struct coding_system *,
                                   Lisp_Object, ptrdiff_t, ptrdiff_t,
                                   ptrdiff_t, ptrdiff_t, Lisp_Object);
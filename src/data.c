@@ -233,6 +233,8 @@ DEFUN ("type-of", Ftype_of, Stype_of, 1, 1, 0,
         case PVEC_BUFFER: return Qbuffer;
         case PVEC_CHAR_TABLE: return Qchar_table;
         case PVEC_BOOL_VECTOR: return Qbool_vector;
+        case PVEC_F64VECTOR: return Qf64vector;
+        case PVEC_I64VECTOR: return Qi64vector;
         case PVEC_FRAME: return Qframe;
         case PVEC_HASH_TABLE: return Qhash_table;
         case PVEC_FONT:
@@ -259,6 +261,8 @@ DEFUN ("type-of", Ftype_of, Stype_of, 1, 1, 0,
           }
         case PVEC_MODULE_FUNCTION:
           return Qmodule_function;
+        case PVEC_JSON_PARSER:
+          return Qjson_parser;
         case PVEC_XWIDGET:
           return Qxwidget;
         case PVEC_XWIDGET_VIEW:
@@ -410,6 +414,33 @@ DEFUN ("bool-vector-p", Fbool_vector_p, Sbool_vector_p, 1, 1, 0,
   return Qnil;
 }
 
+DEFUN ("f64vectorp", Ff64vectorp, Sf64vectorp, 1, 1, 0,
+       doc: /* Return t if OBJECT is an f64vector.  */)
+  (Lisp_Object object)
+{
+  if (F64VECTORP (object))
+    return Qt;
+  return Qnil;
+}
+
+DEFUN ("i64vectorp", Fi64vectorp, Si64vectorp, 1, 1, 0,
+       doc: /* Return t if OBJECT is an i64vector.  */)
+  (Lisp_Object object)
+{
+  if (I64VECTORP (object))
+    return Qt;
+  return Qnil;
+}
+
+DEFUN ("numeric-vector-p", Fnumeric_vector_p, Snumeric_vector_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is an f64vector or an i64vector.  */)
+  (Lisp_Object object)
+{
+  if (NUMERIC_VECTOR_P (object))
+    return Qt;
+  return Qnil;
+}
+
 DEFUN ("arrayp", Farrayp, Sarrayp, 1, 1, 0,
        doc: /* Return t if OBJECT is an array (string or vector).  */)
   (Lisp_Object object)
@@ -1072,6 +1103,24 @@ wrong_range (Lisp_Object min, Lisp_Object max, Lisp_Object wrong)
 	    wrong);
 }
 
+/* Return true if PREDICATE, the type predicate of a per-buffer
+   variable, is one of the common type predicates and accepts VALUE.
+   This spares `let' of such variables a call to PREDICATE.  */
+
+static bool
+fast_buffer_predicate_p (Lisp_Object predicate, Lisp_Object value)
+{
+  if (EQ (predicate, Qintegerp))
+    return INTEGERP (value);
+  if (EQ (predicate, Qstringp))
+    return STRINGP (value);
+  if (EQ (predicate, Qsymbolp))
+    return SYMBOLP (value);
+  if (EQ (predicate, Qnumberp))
+    return NUMBERP (value);
+  return false;
+}
+
 /* Store NEWVAL into SYMBOL, where VALCONTENTS is found in the value cell
    of SYMBOL.  If SYMBOL is buffer-local, VALCONTENTS should be the
    buffer-independent contents of the value cell: forwarded just one
@@ -1134,7 +1183,8 @@ store_symval_forwarding (lispfwd valcontents, Lisp_Object newval,
 	int offset = XBUFFER_OBJFWD (valcontents)->offset;
 	Lisp_Object predicate = XBUFFER_OBJFWD (valcontents)->predicate;
 
-	if (!NILP (newval) && !NILP (predicate))
+	if (!NILP (newval) && !NILP (predicate)
+	    && !fast_buffer_predicate_p (predicate, newval))
 	  {
 	    eassert (SYMBOLP (predicate));
 	    Lisp_Object choiceprop = Fget (predicate, Qchoice);
@@ -1277,6 +1327,41 @@ find_symbol_value (Lisp_Object symbol)
     }
 }
 
+/* Load the binding of the SYMBOL_LOCALIZED variable SYM for the
+   current buffer and return its value.  Set *FOUND to whether that
+   binding is buffer-local rather than the default one.  */
+
+Lisp_Object
+load_localized_binding (struct Lisp_Symbol *sym, bool *found)
+{
+  struct Lisp_Buffer_Local_Value *blv = SYMBOL_BLV (sym);
+  swap_in_symval_forwarding (sym, blv);
+  *found = blv_found (blv);
+  return (blv->fwd.fwdptr
+	  ? do_symval_forwarding (blv->fwd)
+	  : blv_value (blv));
+}
+
+/* Store NEWVAL into the currently loaded binding of the untrapped
+   SYMBOL_LOCALIZED variable SYM, which must be the binding for BUF.
+   This is what set_internal does once it has found the right binding;
+   `let' uses it to skip that search, which set_internal redoes every
+   time the default binding is loaded.  NEWVAL must not be Qunbound.  */
+
+void
+store_loaded_binding (struct Lisp_Symbol *sym, Lisp_Object newval,
+		      struct buffer *buf)
+{
+  struct Lisp_Buffer_Local_Value *blv = SYMBOL_BLV (sym);
+  eassert (sym->u.s.trapped_write == SYMBOL_UNTRAPPED_WRITE);
+  eassert (EQ (blv->where, make_lisp_ptr (buf, Lisp_Vectorlike)));
+  eassert (!EQ (newval, Qunbound));
+
+  set_blv_value (blv, newval);
+  if (blv->fwd.fwdptr)
+    store_symval_forwarding (blv->fwd, newval, buf);
+}
+
 DEFUN ("symbol-value", Fsymbol_value, Ssymbol_value, 1, 1, 0,
        doc: /* Return SYMBOL's value.  Error if that is void.
 Note that if `lexical-binding' is in effect, this returns the
@@ -2224,12 +2309,54 @@ DEFUN ("indirect-function", Findirect_function, Sindirect_function, 1, 2, 0,
   return Qnil;
 }
 
+/* Return the element of the numeric vector V at index IDX, which must
+   be in range.  */
+
+Lisp_Object
+numeric_vector_ref (Lisp_Object v, EMACS_INT idx)
+{
+  union numeric_vector_elt *data = numeric_vector_data (v);
+  return (F64VECTORP (v)
+	  ? make_float (data[idx].f)
+	  : make_int (data[idx].i));
+}
+
+/* Return NUM as an element of an i64vector, signaling an error if it
+   is not an integer or is out of range.  */
+
+int64_t
+numeric_vector_i64 (Lisp_Object num)
+{
+  intmax_t i;
+  CHECK_INTEGER (num);
+  if (! (integer_to_intmax (num, &i) && INT64_MIN <= i && i <= INT64_MAX))
+    xsignal1 (Qoverflow_error, num);
+  return i;
+}
+
+/* Store NEWELT into the numeric vector V at index IDX, which must be
+   in range.  */
+
+void
+numeric_vector_set (Lisp_Object v, EMACS_INT idx, Lisp_Object newelt)
+{
+  union numeric_vector_elt *data = numeric_vector_data (v);
+  if (F64VECTORP (v))
+    {
+      CHECK_NUMBER (newelt);
+      data[idx].f = XFLOATINT (newelt);
+    }
+  else
+    data[idx].i = numeric_vector_i64 (newelt);
+}
+
 /* Extract and set vector and string elements.  */
 
 DEFUN ("aref", Faref, Saref, 2, 2, 0,
        doc: /* Return the element of ARRAY at index IDX.
-ARRAY may be a vector, a string, a char-table, a bool-vector, a record,
-or a byte-code object.  IDX starts at 0.  */)
+ARRAY may be a vector, a string, a char-table, a bool-vector, an
+f64vector, an i64vector, a record, or a byte-code object.  IDX starts
+at 0.  */)
   (register Lisp_Object array, Lisp_Object idx)
 {
   register EMACS_INT idxval;
@@ -2256,6 +2383,12 @@ DEFUN ("aref", Faref, Saref, 2, 2, 0,
 	args_out_of_range (array, idx);
       return bool_vector_ref (array, idxval);
     }
+  else if (NUMERIC_VECTOR_P (array))
+    {
+      if (idxval < 0 || idxval >= numeric_vector_size (array))
+	args_out_of_range (array, idx);
+      return numeric_vector_ref (array, idxval);
+    }
   else if (CHAR_TABLE_P (array))
     {
       CHECK_CHARACTER (idx);
@@ -2279,8 +2412,8 @@ DEFUN ("aref", Faref, Saref, 2, 2, 0,
 
 DEFUN ("aset", Faset, Saset, 3, 3, 0,
        doc: /* Store into the element of ARRAY at index IDX the value NEWELT.
-Return NEWELT.  ARRAY may be a vector, a string, a char-table or a
-bool-vector.  IDX starts at 0.  */)
+Return NEWELT.  ARRAY may be a vector, a string, a char-table, a
+bool-vector, an f64vector or an i64vector.  IDX starts at 0.  */)
   (register Lisp_Object array, Lisp_Object idx, Lisp_Object newelt)
 {
   register EMACS_INT idxval;
@@ -2303,6 +2436,12 @@ DEFUN ("aset", Faset, Saset, 3, 3, 0,
 	args_out_of_range (array, idx);
       bool_vector_set (array, idxval, !NILP (newelt));
     }
+  else if (NUMERIC_VECTOR_P (array))
+    {
+      if (idxval < 0 || idxval >= numeric_vector_size (array))
+	args_out_of_range (array, idx);
+      numeric_vector_set (array, idxval, newelt);
+    }
   else if (CHAR_TABLE_P (array))
     {
       CHECK_CHARACTER (idx);
@@ -2810,13 +2949,13 @@ float_arith_driver (enum arithop code, ptrdiff_t nargs, Lisp_Object *args,
 
 /* Return the result of applying the arithmetic operation CODE to the
    NARGS arguments starting at ARGS.  If ARGNUM is positive, ARGNUM of
-   the arguments were already consumed, yielding IACCUM.  0 <= ARGNUM
-   < NARGS, 2 <= NARGS, and VAL is the value of ARGS[ARGSNUM],
-   converted to integer.  */
+   the arguments were already consumed, yielding the value in mpz[0].
+   0 <= ARGNUM < NARGS, 2 <= NARGS, and VAL is the value of
+   ARGS[ARGSNUM], converted to integer.  */
 
 static Lisp_Object
 bignum_arith_driver (enum arithop code, ptrdiff_t nargs, Lisp_Object *args,
-		     ptrdiff_t argnum, intmax_t iaccum, Lisp_Object val)
+		     ptrdiff_t argnum, Lisp_Object val)
 {
   mpz_t const *accum;
   if (argnum == 0)
@@ -2824,7 +2963,6 @@ bignum_arith_driver (enum arithop code, ptrdiff_t nargs, Lisp_Object *args,
       accum = bignum_integer (&mpz[0], val);
       goto next_arg;
     }
-  mpz_set_intmax (mpz[0], iaccum);
   accum = &mpz[0];
 
   while (true)
@@ -2860,6 +2998,70 @@ bignum_arith_driver (enum arithop code, ptrdiff_t nargs, Lisp_Object *args,
     }
 }
 
+#if HAVE_WIDEINT
+
+/* Like bignum_arith_driver, except that if ARGNUM is positive the
+   value of the consumed arguments is ACCUM.  Keep going in wideint
+   arithmetic while the arguments and results fit, so that integers
+   only slightly too wide for intmax_t do not need GMP, and switch to
+   bignum_arith_driver only when they stop fitting.  */
+
+static Lisp_Object
+wideint_arith_driver (enum arithop code, ptrdiff_t nargs, Lisp_Object *args,
+		      ptrdiff_t argnum, wideint accum, Lisp_Object val)
+{
+  if (argnum == 0)
+    {
+      if (!integer_to_wideint (val, &accum))
+	return bignum_arith_driver (code, nargs, args, argnum, val);
+      goto next_arg;
+    }
+
+  while (true)
+    {
+      wideint next, a;
+      if (!integer_to_wideint (val, &next))
+	break;
+
+      bool overflow = false;
+      switch (code)
+	{
+	case Aadd : overflow = INT_ADD_WRAPV (accum, next, &a); break;
+	case Amult: overflow = INT_MULTIPLY_WRAPV (accum, next, &a); break;
+	case Asub : overflow = INT_SUBTRACT_WRAPV (accum, next, &a); break;
+	case Adiv:
+	  if (next == 0)
+	    xsignal0 (Qarith_error);
+	  if (next == -1)
+	    overflow = INT_SUBTRACT_WRAPV (0, accum, &a);
+	  else
+	    a = accum / next;
+	  break;
+	case Alogand: a = accum & next; break;
+	case Alogior: a = accum | next; break;
+	case Alogxor: a = accum ^ next; break;
+	default: eassume (false);
+	}
+      if (overflow)
+	break;
+      accum = a;
+
+    next_arg:
+      argnum++;
+      if (argnum == nargs)
+	return make_wideint (accum);
+      val = check_number_coerce_marker (args[argnum]);
+      if (FLOATP (val))
+	return float_arith_driver (code, nargs, args, argnum, accum, val);
+    }
+
+  /* Fall back on GMP for ARGS[ARGNUM] and later.  */
+  mpz_set_wideint (mpz[0], accum);
+  return bignum_arith_driver (code, nargs, args, argnum, val);
+}
+
+#endif
+
 /* Return the result of applying the arithmetic operation CODE to the
    NARGS arguments starting at ARGS, with the first argument being the
    number VAL.  2 <= NARGS.  Check that the remaining arguments are
@@ -2916,9 +3118,15 @@ arith_driver (enum arithop code, ptrdiff_t nargs, Lisp_Object *args,
 	accum = a;
       }
 
-  return (FLOATP (val)
-	  ? float_arith_driver (code, nargs, args, argnum, accum, val)
-	  : bignum_arith_driver (code, nargs, args, argnum, accum, val));
+  if (FLOATP (val))
+    return float_arith_driver (code, nargs, args, argnum, accum, val);
+#if HAVE_WIDEINT
+  return wideint_arith_driver (code, nargs, args, argnum, accum, val);
+#else
+  if (argnum != 0)
+    mpz_set_intmax (mpz[0], accum);
+  return bignum_arith_driver (code, nargs, args, argnum, val);
+#endif
 }
 
 
@@ -3212,6 +3420,22 @@ DEFUN ("ash", Fash, Sash, 2, 2, 0,
 	}
     }
 
+#if HAVE_WIDEINT
+  /* Shift in wideint arithmetic if the result fits.  */
+  wideint w;
+  if (XFIXNUM (count) < WIDEINT_WIDTH && integer_to_wideint (value, &w))
+    {
+      EMACS_INT shift = XFIXNUM (count);
+      if (shift < 0)
+	return make_wideint (-shift < WIDEINT_WIDTH
+			     ? w >> -shift
+			     : w < 0 ? -1 : 0);
+      wideint r = (uwideint) w << shift;
+      if (r >> shift == w)
+	return make_wideint (r);
+    }
+#endif
+
   mpz_t const *zval = bignum_integer (&mpz[0], value);
   if (XFIXNUM (count) < 0)
     {
@@ -3778,6 +4002,7 @@ syms_of_data (void)
   DEFSYM (Qvectorp, "vectorp");
   DEFSYM (Qrecordp, "recordp");
   DEFSYM (Qbool_vector_p, "bool-vector-p");
+  DEFSYM (Qnumeric_vector_p, "numeric-vector-p");
   DEFSYM (Qchar_or_string_p, "char-or-string-p");
   DEFSYM (Qmarkerp, "markerp");
   DEFSYM (Quser_ptrp, "user-ptrp");
@@ -3877,6 +4102,7 @@ #define PUT_ERROR(sym, tail, msg)			\
   DEFSYM (Qoverlay, "overlay");
   DEFSYM (Qfinalizer, "finalizer");
   DEFSYM (Qmodule_function, "module-function");
+  DEFSYM (Qjson_parser, "json-parser");
   DEFSYM (Quser_ptr, "user-ptr");
   DEFSYM (Qfloat, "float");
   DEFSYM (Qwindow_configuration, "window-configuration");
@@ -3890,6 +4116,8 @@ #define PUT_ERROR(sym, tail, msg)			\
   DEFSYM (Qrecord, "record");
   DEFSYM (Qchar_table, "char-table");
   DEFSYM (Qbool_vector, "bool-vector");
+  DEFSYM (Qf64vector, "f64vector");
+  DEFSYM (Qi64vector, "i64vector");
   DEFSYM (Qhash_table, "hash-table");
   DEFSYM (Qthread, "thread");
   DEFSYM (Qmutex, "mutex");
@@ -3930,6 +4158,9 @@ #define PUT_ERROR(sym, tail, msg)			\
   defsubr (&Schar_table_p);
   defsubr (&Svector_or_char_table_p);
   defsubr (&Sbool_vector_p);
+  defsubr (&Sf64vectorp);
+  defsubr (&Si64vectorp);
+  defsubr (&Snumeric_vector_p);
   defsubr (&Sarrayp);
   defsubr (&Ssequencep);
   defsubr (&Sbufferp);
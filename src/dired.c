@@ -48,9 +48,29 @@
 extern int is_slow_fs (const char *);
 #endif
 
+/* The names of the owner and group that file_attributes last looked
+   up, as decoded strings or nil, kept while listing a directory,
+   whose files mostly share their owner and group.  */
+struct id_names
+{
+  bool have_uid, have_gid;
+  uid_t uid;
+  gid_t gid;
+  Lisp_Object uname, gname;
+};
+
+/* The status of a file, or the errno of failing to get it.  */
+struct file_status
+{
+  int err;
+  struct stat st;
+};
+
 static ptrdiff_t scmp (const char *, const char *, ptrdiff_t);
 static Lisp_Object file_attributes (int, char const *, Lisp_Object,
-				    Lisp_Object, Lisp_Object);
+				    Lisp_Object, Lisp_Object,
+				    struct id_names *,
+				    struct file_status const *);
 
 /* Return the number of bytes in DP's name.  */
 static ptrdiff_t
@@ -157,6 +177,161 @@ read_dirent (DIR *dir, Lisp_Object dirname)
     }
 }
 
+/* Entries of a directory, read ahead so that the status of each can
+   be found by several threads.  */
+
+struct dir_entries
+{
+  /* The number of entries.  */
+  ptrdiff_t n;
+
+  /* Their names, each followed by a null byte, and NAMES_SIZE bytes
+     allocated for them.  */
+  char *names;
+  ptrdiff_t names_size;
+
+  /* Where each name starts in NAMES, and the number of elements
+     allocated.  */
+  ptrdiff_t *start;
+  ptrdiff_t start_size;
+
+  /* The status of each entry, or null if none was found.  */
+  struct file_status *status;
+};
+
+/* At most this many entries are read ahead, and their status found,
+   at a time, so that listing a large directory can be quit, and stops
+   examining files once it has enough of them.  */
+enum { DIR_STATUS_BATCH = 1024 };
+
+enum { DIR_STATUS_MAX_THREADS = 16 };
+
+/* A share of the entries whose status to find.  */
+struct dir_status_part
+{
+  struct dir_entries *entries;
+  int fd;
+  ptrdiff_t beg, end;
+};
+
+static void
+free_dir_entries (void *arg)
+{
+  struct dir_entries *entries = arg;
+  xfree (entries->names);
+  xfree (entries->start);
+  xfree (entries->status);
+}
+
+/* Read entries of directory D, named DIRNAME, into ENTRIES in place of
+   those it had, until WANT of them have names that match the regular
+   expression MATCH, unless it is nil, using CASE_TABLE, or there are
+   no more entries.  Keep only the entries that match, and return a
+   vector of their decoded names.  Set *AT_END to whether D has no
+   more entries.  */
+
+static Lisp_Object
+read_dir_entries (DIR *d, Lisp_Object dirname, struct dir_entries *entries,
+		  ptrdiff_t want, Lisp_Object match, Lisp_Object case_table,
+		  bool *at_end)
+{
+  Lisp_Object names = make_nil_vector (min (want, DIR_STATUS_BATCH));
+  ptrdiff_t nbytes = 0;
+
+  entries->n = 0;
+  *at_end = false;
+  while (entries->n < want)
+    {
+      struct dirent *dp = read_dirent (d, dirname);
+      if (!dp)
+	{
+	  *at_end = true;
+	  break;
+	}
+      ptrdiff_t len = dirent_namelen (dp);
+
+      /* This can GC.  */
+      Lisp_Object name = DECODE_FILE (make_unibyte_string (dp->d_name, len));
+
+      maybe_quit ();
+
+      if (!NILP (match)
+	  && fast_string_match_internal (match, name, case_table) < 0)
+	continue;
+
+      if (entries->names_size - nbytes <= len)
+	entries->names = xpalloc (entries->names, &entries->names_size,
+				  len + 1 - (entries->names_size - nbytes),
+				  -1, 1);
+      memcpy (entries->names + nbytes, dp->d_name, len);
+      entries->names[nbytes + len] = '\0';
+      if (entries->start_size == entries->n)
+	entries->start = xpalloc (entries->start, &entries->start_size, 1,
+				  -1, sizeof *entries->start);
+      entries->start[entries->n] = nbytes;
+      nbytes += len + 1;
+      if (ASIZE (names) == entries->n)
+	names = larger_vector (names, 1, -1);
+      ASET (names, entries->n, name);
+      entries->n++;
+    }
+
+  return names;
+}
+
+#ifndef WINDOWSNT
+
+/* Find the status of the entries in the part ARG, without following
+   symbolic links.  This runs outside the main thread, so it must not
+   use any Lisp data, or quit.  */
+
+static void
+stat_dir_entries (void *arg)
+{
+  struct dir_status_part *part = arg;
+  struct dir_entries *entries = part->entries;
+
+  for (ptrdiff_t i = part->beg; i < part->end; i++)
+    {
+      struct file_status *status = &entries->status[i];
+      char const *name = entries->names + entries->start[i];
+      int r;
+
+      while ((r = fstatat (part->fd, name, &status->st, AT_SYMLINK_NOFOLLOW))
+	     != 0 && errno == EINTR)
+	continue;
+      status->err = r == 0 ? 0 : errno;
+    }
+}
+
+/* Find the status of ENTRIES from BEG to END, which are in the
+   directory open on FD, using as many threads as there are
+   processors.  */
+
+static void
+stat_dir_entries_in_parallel (int fd, struct dir_entries *entries,
+			      ptrdiff_t beg, ptrdiff_t end)
+{
+  struct dir_status_part parts[DIR_STATUS_MAX_THREADS];
+  int n = 1;
+
+#if defined THREADS_ENABLED && defined _SC_NPROCESSORS_ONLN
+  long ncpus = sysconf (_SC_NPROCESSORS_ONLN);
+  n = clip_to_bounds (1, min (ncpus, end - beg), DIR_STATUS_MAX_THREADS);
+#endif
+
+  for (int i = 0; i < n; i++)
+    {
+      parts[i].entries = entries;
+      parts[i].fd = fd;
+      parts[i].beg = beg + (end - beg) / n * i;
+      parts[i].end = i < n - 1 ? beg + (end - beg) / n * (i + 1) : end;
+    }
+  sys_run_parallel (stat_dir_entries, parts, sizeof *parts, n);
+}
+
+#endif /* !WINDOWSNT */
+
 /* Function shared by Fdirectory_files and Fdirectory_files_and_attributes.
    If not ATTRS, return a list of directory filenames;
    if ATTRS, return a list of directory filenames and their attributes.
@@ -232,32 +407,107 @@ directory_files_internal (Lisp_Object directory, Lisp_Object full,
   case_table = BVAR (&buffer_defaults, case_canon_table);
 #endif
 
+  struct id_names ids = { .have_uid = false, .have_gid = false };
+
+  /* When listing a directory with attributes, read ahead as many
+     matching entries as it takes to reach the threshold, if as many
+     are wanted.  If there are that many, find the status of the
+     entries in parallel, reading and examining them a batch at a
+     time; otherwise, go on with the entries that were read.  The w32
+     stat is not thread-safe.  */
+  struct dir_entries entries = { .n = 0 };
+  bool read_ahead = false, at_end = false;
+  Lisp_Object decoded_names = Qnil;
+#ifndef WINDOWSNT
+  ptrdiff_t status_end = 0;
+  if (attrs && FIXNATP (Vdirectory_files_parallel_threshold)
+      && XFIXNAT (Vdirectory_files_parallel_threshold) <= last)
+    {
+      ptrdiff_t threshold
+	= max (1, min (XFIXNAT (Vdirectory_files_parallel_threshold),
+		       PTRDIFF_MAX));
+      record_unwind_protect_ptr (free_dir_entries, &entries);
+      decoded_names = read_dir_entries (d, directory, &entries, threshold,
+					match, case_table, &at_end);
+      read_ahead = true;
+      if (entries.n == threshold)
+	entries.status = xnmalloc (entries.n, sizeof *entries.status);
+    }
+#endif
+
   /* Read directory entries and accumulate them into LIST.  */
   Lisp_Object list = Qnil;
-  for (struct dirent *dp; (dp = read_dirent (d, directory)); )
+  for (ptrdiff_t i = 0; ; i++)
     {
-      ptrdiff_t len = dirent_namelen (dp);
-      Lisp_Object name = make_unibyte_string (dp->d_name, len);
-      Lisp_Object finalname = name;
+      char const *dname;
+      Lisp_Object name;
 
-      /* This can GC.  */
-      name = DECODE_FILE (name);
+      if (read_ahead)
+	{
+	  if (i == entries.n)
+	    {
+	      if (at_end || ind == last)
+		break;
+	      decoded_names
+		= read_dir_entries (d, directory, &entries,
+				    min (last - ind, DIR_STATUS_BATCH),
+				    match, case_table, &at_end);
+	      if (entries.n == 0)
+		break;
+	      i = 0;
+#ifndef WINDOWSNT
+	      entries.status = xnrealloc (entries.status, entries.n,
+					  sizeof *entries.status);
+	      status_end = 0;
+#endif
+	    }
+
+	  /* The name has already been decoded and matched.  */
+	  dname = entries.names + entries.start[i];
+	  name = AREF (decoded_names, i);
+	}
+      else
+	{
+	  struct dirent *dp = read_dirent (d, directory);
+	  if (!dp)
+	    break;
+	  dname = dp->d_name;
+
+	  /* This can GC.  */
+	  name = DECODE_FILE (make_unibyte_string (dname,
+						   dirent_namelen (dp)));
+	}
 
       maybe_quit ();
 
-      if (!NILP (match)
+      if (!read_ahead && !NILP (match)
 	  && fast_string_match_internal (match, name, case_table) < 0)
 	continue;
 
+      if (ind == last)
+	break;
+
       Lisp_Object fileattrs UNINIT;
       if (attrs)
 	{
-	  fileattrs = file_attributes (fd, dp->d_name, directory, name,
-				       id_format);
+#ifndef WINDOWSNT
+	  /* Find the status of the next batch of entries, no more of
+	     them than are still wanted.  */
+	  if (entries.status && status_end <= i)
+	    {
+	      status_end = i + min (min (entries.n - i, last - ind),
+				    DIR_STATUS_BATCH);
+	      stat_dir_entries_in_parallel (fd, &entries, i, status_end);
+	    }
+#endif
+	  fileattrs = file_attributes (fd, dname, directory, name, id_format,
+				       &ids,
+				       entries.status ? &entries.status[i] : NULL);
 	  if (NILP (fileattrs))
 	    continue;
 	}
 
+      Lisp_Object finalname;
       if (!NILP (full))
 	{
 	  ptrdiff_t name_nbytes = SBYTES (name);
@@ -275,14 +525,13 @@ directory_files_internal (Lisp_Object directory, Lisp_Object full,
       else
 	finalname = name;
 
-      if (ind == last)
-          break;
       ind ++;
 
       list = Fcons (attrs ? Fcons (finalname, fileattrs) : finalname, list);
     }
 
   closedir (d);
+  free_dir_entries (&entries);
 #ifdef WINDOWSNT
   if (attrs)
     Vw32_get_true_file_attributes = w32_save;
@@ -867,6 +1116,52 @@ stat_gname (struct stat *st)
 #endif
 }
 
+/* Return the name of the owner of the file described by ST as a
+   string, or nil if it has none.  Use and update IDS unless it is
+   null.  */
+
+static Lisp_Object
+file_owner_name (struct stat *st, struct id_names *ids)
+{
+#ifndef WINDOWSNT
+  if (ids && ids->have_uid && ids->uid == st->st_uid)
+    return ids->uname;
+#endif
+  char *uname = stat_uname (st);
+  Lisp_Object name = (uname
+		      ? DECODE_SYSTEM (build_unibyte_string (uname))
+		      : Qnil);
+  if (ids)
+    {
+      ids->have_uid = true;
+      ids->uid = st->st_uid;
+      ids->uname = name;
+    }
+  return name;
+}
+
+/* Likewise for the group of the file.  */
+
+static Lisp_Object
+file_group_name (struct stat *st, struct id_names *ids)
+{
+#ifndef WINDOWSNT
+  if (ids && ids->have_gid && ids->gid == st->st_gid)
+    return ids->gname;
+#endif
+  char *gname = stat_gname (st);
+  Lisp_Object name = (gname
+		      ? DECODE_SYSTEM (build_unibyte_string (gname))
+		      : Qnil);
+  if (ids)
+    {
+      ids->have_gid = true;
+      ids->gid = st->st_gid;
+      ids->gname = name;
+    }
+  return name;
+}
+
 DEFUN ("file-attributes", Ffile_attributes, Sfile_attributes, 1, 2, 0,
        doc: /* Return a list of attributes of file FILENAME.
 Value is nil if specified file does not exist.
@@ -936,13 +1231,14 @@ DEFUN ("file-attributes", Ffile_attributes, Sfile_attributes, 1, 2, 0,
 
   encoded = ENCODE_FILE (filename);
   return file_attributes (AT_FDCWD, SSDATA (encoded), Qnil, filename,
-			  id_format);
+			  id_format, NULL, NULL);
 }
 
 static Lisp_Object
 file_attributes (int fd, char const *name,
 		 Lisp_Object dirname, Lisp_Object filename,
-		 Lisp_Object id_format)
+		 Lisp_Object id_format, struct id_names *ids,
+		 struct file_status const *status)
 {
   ptrdiff_t count = SPECPDL_INDEX ();
   struct stat s;
@@ -951,36 +1247,15 @@ file_attributes (int fd, char const *name,
      including its terminating space and null byte.  */
   char modes[sizeof "-rwxr-xr-x "];
 
-  char *uname = NULL, *gname = NULL;
+  Lisp_Object uname = Qnil, gname = Qnil;
 
-  int err = EINVAL;
-
-#if defined O_PATH && !defined HAVE_CYGWIN_O_PATH_BUG
-  int namefd = emacs_openat (fd, name, O_PATH | O_CLOEXEC | O_NOFOLLOW, 0);
-  if (namefd < 0)
-    err = errno;
-  else
+  int err;
+  if (status)
     {
-      record_unwind_protect_int (close_file_unwind, namefd);
-      if (fstat (namefd, &s) != 0)
-	{
-	  err = errno;
-	  /* The Linux kernel before version 3.6 does not support
-	     fstat on O_PATH file descriptors.  Handle this error like
-	     missing support for O_PATH.  */
-	  if (err == EBADF)
-	    err = EINVAL;
-	}
-      else
-	{
-	  err = 0;
-	  fd = namefd;
-	  name = "";
-	}
+      err = status->err;
+      s = status->st;
     }
-#endif
-
-  if (err == EINVAL)
+  else
     {
 #ifdef WINDOWSNT
       /* We usually don't request accurate owner and group info,
@@ -995,6 +1270,30 @@ file_attributes (int fd, char const *name,
 #endif
     }
 
+#if defined O_PATH && !defined HAVE_CYGWIN_O_PATH_BUG
+  /* Stat a symbolic link again through a descriptor for it, so that
+     the link read below is the one described by S.  Most files are
+     not links, and this saves them the extra system calls.  */
+  if (err == 0 && S_ISLNK (s.st_mode))
+    {
+      int namefd = emacs_openat (fd, name, O_PATH | O_CLOEXEC | O_NOFOLLOW, 0);
+      if (namefd >= 0)
+	{
+	  struct stat ls;
+	  record_unwind_protect_int (close_file_unwind, namefd);
+	  /* The Linux kernel before version 3.6 does not support
+	     fstat on O_PATH file descriptors.  Then, and if the link
+	     has gone meanwhile, handle it as if O_PATH were missing.  */
+	  if (fstat (namefd, &ls) == 0)
+	    {
+	      s = ls;
+	      fd = namefd;
+	      name = "";
+	    }
+	}
+    }
+#endif
+
   if (err != 0)
     return unbind_to (count, file_attribute_errno (filename, err));
 
@@ -1016,8 +1315,8 @@ file_attributes (int fd, char const *name,
 
   if (!(NILP (id_format) || EQ (id_format, Qinteger)))
     {
-      uname = stat_uname (&s);
-      gname = stat_gname (&s);
+      uname = file_owner_name (&s, ids);
+      gname = file_group_name (&s, ids);
     }
 
   filemodestring (&s, modes);
@@ -1025,12 +1324,8 @@ file_attributes (int fd, char const *name,
   return CALLN (Flist,
 		file_type,
 		make_fixnum (s.st_nlink),
-		(uname
-		 ? DECODE_SYSTEM (build_unibyte_string (uname))
-		 : INT_TO_INTEGER (s.st_uid)),
-		(gname
-		 ? DECODE_SYSTEM (build_unibyte_string (gname))
-		 : INT_TO_INTEGER (s.st_gid)),
+		(!NILP (uname) ? uname : INT_TO_INTEGER (s.st_uid)),
+		(!NILP (gname) ? gname : INT_TO_INTEGER (s.st_gid)),
 		make_lisp_time (get_stat_atime (&s)),
 		make_lisp_time (get_stat_mtime (&s)),
 		make_lisp_time (get_stat_ctime (&s)),
@@ -1118,6 +1413,16 @@ syms_of_dired (void)
   defsubr (&Ssystem_users);
   defsubr (&Ssystem_groups);
 
+  DEFVAR_LISP ("directory-files-parallel-threshold",
+	       Vdirectory_files_parallel_threshold,
+	       doc: /* Number of files from which a directory is examined by several threads.
+When `directory-files-and-attributes' lists a directory that has at
+least this many files, it gets their attributes using as many threads
+as there are processors.  This speeds up listing very large
+directories, especially on network file systems.  If nil, the
+default, the files are examined one at a time by the main thread.  */);
+  Vdirectory_files_parallel_threshold = Qnil;
+
   DEFVAR_LISP ("completion-ignored-extensions", Vcompletion_ignored_extensions,
 	       doc: /* Completion ignores file names ending in any string in this list.
 It does not ignore them if all possible completions end in one of
@@ -3139,18 +3139,22 @@ styled_format (ptrdiff_t nargs, Lisp_Object *args, bool message)
   /* Upper bound on number of format specs.  Each uses at least 2 chars.  */
   ptrdiff_t nspec_bound = SCHARS (args[0]) >> 1;
 
-  /* Allocate the info and discarded tables.  */
+  /* Allocate the info and discarded tables.  The discarded table is
+     used only to move the format string's text properties to the
+     output, so don't bother with it if there are none.  */
+  ptrdiff_t discarded_size = fmt_props ? formatlen : 0;
   ptrdiff_t info_size, alloca_size;
   if (INT_MULTIPLY_WRAPV (nspec_bound, sizeof *info, &info_size)
-      || INT_ADD_WRAPV (formatlen, info_size, &alloca_size)
+      || INT_ADD_WRAPV (discarded_size, info_size, &alloca_size)
       || SIZE_MAX < alloca_size)
     memory_full (SIZE_MAX);
   info = SAFE_ALLOCA (alloca_size);
   /* discarded[I] is 1 if byte I of the format
      string was not copied into the output.
      It is 2 if byte I was not the first byte of its character.  */
-  char *discarded = (char *) &info[nspec_bound];
-  memset (discarded, 0, formatlen);
+  char *discarded = fmt_props ? (char *) &info[nspec_bound] : NULL;
+  if (discarded)
+    memset (discarded, 0, formatlen);
 
   /* Try to determine whether the result should be multibyte.
      This is not always right; sometimes the result needs to be multibyte
@@ -3282,8 +3286,9 @@ styled_format (ptrdiff_t nargs, Lisp_Object *args, bool message)
 	    error ("Format string ends in middle of format specifier");
 
 	  char conversion = *format++;
-	  memset (&discarded[format0 - format_start], 1,
-		  format - format0 - (conversion == '%'));
+	  if (discarded)
+	    memset (&discarded[format0 - format_start], 1,
+		    format - format0 - (conversion == '%'));
 	  info[ispec].fbeg = format0 - format_start;
 	  if (conversion == '%')
 	    {
@@ -3379,6 +3384,15 @@ styled_format (ptrdiff_t nargs, Lisp_Object *args, bool message)
 	      ptrdiff_t nchars_string;
 	      if (prec == 0)
 		width = nchars_string = nbytes = 0;
+	      else if (prec < 0 && field_width == 0)
+		{
+		  /* The display width matters only for padding or
+		     truncation, and computing it means looking up every
+		     character's width and composition, so skip it.  */
+		  width = 0;
+		  nchars_string = SCHARS (arg);
+		  nbytes = SBYTES (arg);
+		}
 	      else
 		{
 		  ptrdiff_t nch, nby;
@@ -3823,8 +3837,9 @@ styled_format (ptrdiff_t nargs, Lisp_Object *args, bool message)
 		    format++;
 
 		  convbytes = format - format0;
-		  memset (&discarded[format0 + 1 - format_start], 2,
-			  convbytes - 1);
+		  if (discarded)
+		    memset (&discarded[format0 + 1 - format_start], 2,
+			    convbytes - 1);
 		}
 	      else if (multibyte && !ASCII_CHAR_P (format_char))
 		{
@@ -3892,6 +3907,10 @@ styled_format (ptrdiff_t nargs, Lisp_Object *args, bool message)
       goto return_val;
     }
 
+  /* The output was built in BUF and is copied into the result once.
+     It cannot be built in the result string itself, whose length and
+     multibyteness are known only now.  BUF is on the stack for all but
+     long results, so a separate arena for it would gain nothing.  */
   if (maybe_combine_byte)
     nchars = multibyte_chars_in_text ((unsigned char *) buf, p - buf);
   val = make_specified_string (buf, nchars, p - buf, multibyte);
@@ -3900,12 +3919,14 @@ styled_format (ptrdiff_t nargs, Lisp_Object *args, bool message)
      arguments has text properties, set up text properties of the
      result string.  */
 
-  if (string_intervals (args[0]) || arg_intervals)
+  if (fmt_props || arg_intervals)
     {
       /* Add text properties from the format string.  */
       Lisp_Object len = make_fixnum (SCHARS (args[0]));
-      Lisp_Object props = text_property_list (args[0], make_fixnum (0),
-					      len, Qnil);
+      Lisp_Object props = (fmt_props
+			   ? text_property_list (args[0], make_fixnum (0),
+						 len, Qnil)
+			   : Qnil);
       if (CONSP (props))
 	{
 	  ptrdiff_t bytepos = 0, position = 0, translated = 0;
@@ -1603,10 +1603,6 @@ main (int argc, char **argv)
     init_xfaces ();
 #endif
 
-#if defined HAVE_JSON && !defined WINDOWSNT
-  init_json ();
-#endif
-
   no_loadup
     = argmatch (argv, argc, "-nl", "--no-loadup", 6, NULL, &skip_args);
 
@@ -1952,10 +1948,7 @@ main (int argc, char **argv)
       syms_of_threads ();
       syms_of_profiler ();
       syms_of_pdumper ();
-
-#ifdef HAVE_JSON
       syms_of_json ();
-#endif
 
       keys_of_keyboard ();
     }
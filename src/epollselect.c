@@ -0,0 +1,723 @@
+/* A pselect replacement built on Linux epoll.
+
+Copyright (C) 2021 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* pselect hands the kernel the whole descriptor set on every call,
+   and the kernel polls each descriptor in turn, so the cost of an
+   idle wait grows with the number of subprocesses and connections.
+
+   epoll_select waits instead on epoll instances whose interest lists
+   are kept up to date as descriptors start and stop being monitored:
+   process.c calls epoll_select_watch whenever the way it monitors a
+   descriptor changes, and xg_select and the NS event loop register
+   their own descriptors with epoll_select_watch_aux.  A call to
+   epoll_select therefore does no work for descriptors that are not
+   ready.  The fd_sets it takes only select which of the watched
+   descriptors the caller is interested in this time, and on return
+   they hold the ready ones, as with pselect.  epoll_select_ready_fds
+   lists those, so that callers need not scan the sets.
+
+   Registrations are edge-triggered.  pselect reports a descriptor as
+   long as it stays ready, and callers such as read_process_output
+   rely on that, as they read at most one buffer per wakeup.  So each
+   waiter remembers the descriptors epoll reported until a poll with
+   zero timeout finds that they are no longer ready; any new data
+   after that produces a new edge.  Descriptors that are ready but
+   that the caller is not interested in, e.g., those of another
+   thread's processes, stay remembered without waking anyone again.
+
+   Each thread that waits gets an epoll instance of its own, so that
+   an edge is never consumed by a thread that has no use for it.
+   When a descriptor stops being watched, e.g., because its process
+   exited, every thread is woken through an eventfd of its own, as
+   pselect would wake on the hangup, so that it can look at its fd_sets
+   again.  All
+   the state below is protected by epoll_select_lock, which is never
+   held while waiting.  The SIGCHLD handler stops watching the
+   descriptors of processes that exit, so SIGCHLD is blocked while
+   the lock is held.  The tables indexed by descriptor grow as
+   higher descriptors are watched.  */
+
+#include <config.h>
+
+#include "epollselect.h"
+
+#ifdef HAVE_EPOLL
+
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#include "lisp.h"
+#include "syssignal.h"
+#include "systime.h"
+
+/* Bits recorded in interest[] for each descriptor.  */
+enum
+  {
+    /* What process.c watches the descriptor for, in the
+       EPOLL_SELECT_READ and EPOLL_SELECT_WRITE bits.  */
+    INTEREST_PROCESS = EPOLL_SELECT_READ | EPOLL_SELECT_WRITE,
+    /* What epoll_select_watch_aux watches it for, shifted left by
+       AUX_SHIFT.  */
+    AUX_SHIFT = 2,
+    INTEREST_AUX = INTEREST_PROCESS << AUX_SHIFT,
+    /* epoll refused this descriptor (e.g., a regular file or
+       /dev/null).  Such descriptors are always ready, as with
+       pselect.  */
+    INTEREST_UNPOLLABLE = 16
+  };
+
+/* Bits recorded in a waiter's ready[] for each descriptor.  */
+enum
+  {
+    /* epoll reported the descriptor ready for reading or writing,
+       and it has not been seen to stop being so since.  */
+    READY_READ = EPOLL_SELECT_READ,
+    READY_WRITE = EPOLL_SELECT_WRITE,
+    /* The descriptor is in the waiter's pending[].  */
+    READY_LISTED = 4,
+    /* The current call reports the descriptor ready for reading or
+       writing.  */
+    REPORT_READ = 8,
+    REPORT_WRITE = 16
+  };
+
+/* One thread waiting in epoll_select.  */
+struct waiter
+{
+  struct waiter *next;
+  sys_thread_t thread;
+
+  /* The thread's epoll instance.  Its interest list holds every
+     descriptor with a nonzero interest[] entry, and WAKEFD.  */
+  int epfd;
+
+  /* An eventfd that set_interest signals to wake the thread.  */
+  int wakefd;
+
+  /* Bits from the READY_ enum, indexed by descriptor, with
+     interest_size elements.  */
+  unsigned char *ready;
+
+  /* The descriptors with READY_LISTED set, and their number.  This
+     and RESULT have interest_size elements, too.  */
+  int *pending;
+  int npending;
+
+  /* The descriptors the last call reported ready, and their number,
+     or -1 if the last call did not use epoll.  */
+  int *result;
+  int nresult;
+
+  /* Where epoll_pwait stores events.  Only the waiting thread uses
+     this, and it does so without holding the lock.  */
+  struct epoll_event *events;
+  int events_size;
+};
+
+static sys_mutex_t epoll_select_lock;
+
+/* Bits from the INTEREST_ enum, indexed by descriptor, and the
+   number of elements allocated for it and for the waiters'
+   tables.  */
+static unsigned char *interest;
+static int interest_size;
+
+/* The number of descriptors with a nonzero interest[] entry.  */
+static int ninterest;
+
+static struct waiter *waiters;
+
+/* True if this kernel has no epoll; use pselect.  */
+static bool epoll_unavailable;
+
+/* The epoll events for the interest bits BITS.  */
+
+static uint32_t
+interest_events (int bits)
+{
+  bits = (bits | bits >> AUX_SHIFT) & INTEREST_PROCESS;
+  return ((bits & EPOLL_SELECT_READ ? EPOLLIN : 0)
+	  | (bits & EPOLL_SELECT_WRITE ? EPOLLOUT : 0));
+}
+
+/* Acquire epoll_select_lock, blocking SIGCHLD and storing the
+   previous signal mask in OLDSET.  */
+
+static void
+lock_tables (sigset_t *oldset)
+{
+  block_child_signal (oldset);
+  sys_mutex_lock (&epoll_select_lock);
+}
+
+/* Release epoll_select_lock and restore the signal mask OLDSET.  */
+
+static void
+unlock_tables (sigset_t const *oldset)
+{
+  sys_mutex_unlock (&epoll_select_lock);
+  unblock_child_signal (oldset);
+}
+
+/* Reallocate P to hold N elements of SIZE bytes.  The lock is held,
+   so release it, restoring OLDSET, before reporting failure.  */
+
+static void *
+grow_table (void *p, ptrdiff_t n, ptrdiff_t size, sigset_t const *oldset)
+{
+  void *q = realloc (p, n * size);
+  if (!q)
+    {
+      unlock_tables (oldset);
+      memory_full (n * size);
+    }
+  return q;
+}
+
+/* Make the tables indexed by descriptor large enough for FD.  */
+
+static void
+grow_tables (int fd, sigset_t const *oldset)
+{
+  int size = max (fd + 1, max (64, interest_size * 2));
+  ptrdiff_t added = size - interest_size;
+
+  interest = grow_table (interest, size, sizeof *interest, oldset);
+  for (struct waiter *w = waiters; w; w = w->next)
+    {
+      w->ready = grow_table (w->ready, size, sizeof *w->ready, oldset);
+      w->pending = grow_table (w->pending, size, sizeof *w->pending, oldset);
+      w->result = grow_table (w->result, size, sizeof *w->result, oldset);
+    }
+
+  memset (interest + interest_size, 0, added * sizeof *interest);
+  for (struct waiter *w = waiters; w; w = w->next)
+    memset (w->ready + interest_size, 0, added * sizeof *w->ready);
+  interest_size = size;
+}
+
+/* Record that FD is ready on W in the ways given by READY_BITS.  */
+
+static void
+mark_ready (struct waiter *w, int fd, int ready_bits)
+{
+  if (!(w->ready[fd] & READY_LISTED))
+    w->pending[w->npending++] = fd;
+  w->ready[fd] |= ready_bits | READY_LISTED;
+}
+
+/* Change W's registration of FD from the epoll events OLD to NEW.
+   Return false if epoll cannot watch FD.  */
+
+static bool
+update_registration (struct waiter *w, int fd, uint32_t old, uint32_t new)
+{
+  struct epoll_event ev = { .events = new | EPOLLET, .data.fd = fd };
+
+  if (!new)
+    {
+      if (old)
+	epoll_ctl (w->epfd, EPOLL_CTL_DEL, fd, &ev);
+      /* Leave READY_LISTED alone; recheck drops the entry.  */
+      w->ready[fd] &= READY_LISTED;
+      return true;
+    }
+
+  int r = epoll_ctl (w->epfd, old ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &ev);
+
+  /* The descriptor may have been closed and reopened behind our back,
+     in which case the kernel has already forgotten it (ENOENT), or
+     still knows it under the same number (EEXIST).  */
+  if (r < 0 && errno == ENOENT)
+    r = epoll_ctl (w->epfd, EPOLL_CTL_ADD, fd, &ev);
+  else if (r < 0 && errno == EEXIST)
+    r = epoll_ctl (w->epfd, EPOLL_CTL_MOD, fd, &ev);
+
+  return ! (r < 0 && errno == EPERM);
+}
+
+/* Set the part of FD's interest selected by MASK to BITS, and update
+   every waiter's registration accordingly.  This can be called from
+   the SIGCHLD handler, with BITS zero; it then allocates nothing.  */
+
+static void
+set_interest (int fd, int mask, int bits)
+{
+  eassert (0 <= fd);
+
+  sigset_t oldset;
+  lock_tables (&oldset);
+  if (interest_size <= fd)
+    {
+      if (!bits)
+	{
+	  unlock_tables (&oldset);
+	  return;
+	}
+      grow_tables (fd, &oldset);
+    }
+
+  int old = interest[fd];
+  int new = (old & ~mask) | bits;
+  uint32_t old_events = interest_events (old);
+  uint32_t new_events = interest_events (new);
+
+  if (!new_events)
+    new = 0;
+  ninterest += (new_events != 0) - (old_events != 0);
+
+  if (old_events != new_events)
+    for (struct waiter *w = waiters; w; w = w->next)
+      {
+	if (! (old & INTEREST_UNPOLLABLE)
+	    && !update_registration (w, fd, old_events, new_events))
+	  new |= INTEREST_UNPOLLABLE;
+
+	/* W may be about to wait for FD, or be waiting for it already,
+	   and would never hear from it again.  */
+	if (old_events & ~new_events)
+	  eventfd_write (w->wakefd, 1);
+      }
+
+  /* Report an unpollable descriptor ready until it is unwatched.  */
+  if (new & INTEREST_UNPOLLABLE)
+    for (struct waiter *w = waiters; w; w = w->next)
+      mark_ready (w, fd, READY_READ | READY_WRITE);
+  else if (old & INTEREST_UNPOLLABLE)
+    for (struct waiter *w = waiters; w; w = w->next)
+      w->ready[fd] &= READY_LISTED;
+
+  interest[fd] = new;
+  unlock_tables (&oldset);
+}
+
+/* Start or stop watching FD on behalf of process.c.  WANT is a mask
+   of EPOLL_SELECT_READ and EPOLL_SELECT_WRITE, zero to stop watching.
+   Stop watching a descriptor before closing it: epoll tracks open
+   file descriptions rather than descriptor numbers, so a registration
+   could otherwise outlive close if the description is shared, e.g.,
+   with a child process.  */
+
+void
+epoll_select_watch (int fd, int want)
+{
+  set_interest (fd, INTEREST_PROCESS, want);
+}
+
+/* Likewise, but on behalf of the window system's event loop, which
+   watches descriptors that process.c does not know about.  */
+
+void
+epoll_select_watch_aux (int fd, int want)
+{
+  set_interest (fd, INTEREST_AUX, want << AUX_SHIFT);
+}
+
+/* Return the calling thread's waiter, creating it if need be, or
+   NULL if that fails.  The lock is held.  */
+
+static struct waiter *
+current_waiter (void)
+{
+  sys_thread_t self = sys_thread_self ();
+  for (struct waiter *w = waiters; w; w = w->next)
+    if (sys_thread_equal (w->thread, self))
+      return w;
+
+  if (epoll_unavailable)
+    return NULL;
+
+  /* The caller does not hold the global lock, so it must not signal
+     an error; let it fall back on pselect instead.  */
+  int epfd = epoll_create1 (EPOLL_CLOEXEC);
+  if (epfd < 0)
+    {
+      if (errno == ENOSYS)
+	epoll_unavailable = true;
+      return NULL;
+    }
+  /* Descriptors may have stopped being watched after the caller
+     chose what to wait for but before this, so start out woken.  */
+  int wakefd = eventfd (1, EFD_CLOEXEC | EFD_NONBLOCK);
+  struct epoll_event ev = { .events = EPOLLIN, .data.fd = -1 };
+  if (wakefd < 0 || epoll_ctl (epfd, EPOLL_CTL_ADD, wakefd, &ev) < 0)
+    {
+      if (0 <= wakefd)
+	emacs_close (wakefd);
+      emacs_close (epfd);
+      return NULL;
+    }
+
+  int size = max (interest_size, 1);
+  struct waiter *w = calloc (1, sizeof *w);
+  if (w)
+    {
+      w->ready = calloc (size, sizeof *w->ready);
+      w->pending = malloc (size * sizeof *w->pending);
+      w->result = malloc (size * sizeof *w->result);
+      w->events_size = min (size, 64);
+      w->events = malloc (w->events_size * sizeof *w->events);
+    }
+  if (!w || !w->ready || !w->pending || !w->result || !w->events)
+    {
+      emacs_close (wakefd);
+      emacs_close (epfd);
+      if (w)
+	{
+	  free (w->ready);
+	  free (w->pending);
+	  free (w->result);
+	  free (w->events);
+	  free (w);
+	}
+      return NULL;
+    }
+  w->thread = self;
+  w->epfd = epfd;
+  w->wakefd = wakefd;
+  w->nresult = -1;
+
+  /* Register what is already being watched.  This is the only place
+     that looks at every descriptor.  */
+  for (int fd = 0; fd < interest_size; fd++)
+    {
+      uint32_t events = interest_events (interest[fd]);
+      if (events
+	  && ((interest[fd] & INTEREST_UNPOLLABLE)
+	      || !update_registration (w, fd, 0, events)))
+	{
+	  interest[fd] |= INTEREST_UNPOLLABLE;
+	  mark_ready (w, fd, READY_READ | READY_WRITE);
+	}
+    }
+
+  w->next = waiters;
+  waiters = w;
+  return w;
+}
+
+/* Check with poll whether the N descriptors in FDS are still ready
+   in the ways they ask for, and update W accordingly.  Return false
+   if poll failed; the descriptors then stay pending but unreported.  */
+
+static bool
+recheck_batch (struct waiter *w, struct pollfd *fds, int n)
+{
+  if (n == 0)
+    return true;
+
+  int r;
+  do
+    r = poll (fds, n, 0);
+  while (r < 0 && (errno == EINTR || errno == EAGAIN));
+  if (r < 0)
+    return false;
+
+  for (int i = 0; i < n; i++)
+    {
+      int fd = fds[i].fd;
+      short revents = fds[i].revents;
+      bool err = (revents & (POLLERR | POLLHUP)) != 0;
+      int report = 0;
+
+      if (revents & POLLNVAL)
+	{
+	  w->ready[fd] &= READY_LISTED;
+	  continue;
+	}
+
+      /* As with pselect, an error or hangup makes the descriptor
+	 ready for whatever the caller was waiting on.  */
+      if (fds[i].events & POLLIN)
+	{
+	  if (err || (revents & POLLIN))
+	    report |= REPORT_READ;
+	  else
+	    w->ready[fd] &= ~READY_READ;
+	}
+      if (fds[i].events & POLLOUT)
+	{
+	  if (err || (revents & POLLOUT))
+	    report |= REPORT_WRITE;
+	  else
+	    w->ready[fd] &= ~READY_WRITE;
+	}
+
+      if (report)
+	{
+	  w->ready[fd] |= report;
+	  w->result[w->nresult++] = fd;
+	}
+    }
+  return true;
+}
+
+/* Find which of W's pending descriptors are ready in the ways RFDS
+   and WFDS ask for, and record them in W->result.  Forget the ones
+   that are no longer ready at all.  Return false if some could not
+   be checked.  The lock is held.  */
+
+static bool
+recheck (struct waiter *w, int max_fds, fd_set *rfds, fd_set *wfds)
+{
+  struct pollfd batch[64];
+  int nbatch = 0;
+  bool ok = true;
+
+  w->nresult = 0;
+  for (int i = 0; i < w->npending; i++)
+    {
+      int fd = w->pending[i];
+      int ask = 0;
+      if (fd < max_fds)
+	ask = (w->ready[fd]
+	       & ((rfds && FD_ISSET (fd, rfds) ? READY_READ : 0)
+		  | (wfds && FD_ISSET (fd, wfds) ? READY_WRITE : 0)));
+      if (ask)
+	{
+	  batch[nbatch].fd = fd;
+	  batch[nbatch].events = ((ask & READY_READ ? POLLIN : 0)
+				  | (ask & READY_WRITE ? POLLOUT : 0));
+	  if (++nbatch == ARRAYELTS (batch))
+	    {
+	      ok &= recheck_batch (w, batch, nbatch);
+	      nbatch = 0;
+	    }
+	}
+    }
+  ok &= recheck_batch (w, batch, nbatch);
+
+  /* Drop the descriptors that are no longer ready in any way.  */
+  int j = 0;
+  for (int i = 0; i < w->npending; i++)
+    {
+      int fd = w->pending[i];
+      if (w->ready[fd] & (READY_READ | READY_WRITE))
+	w->pending[j++] = fd;
+      else
+	w->ready[fd] = 0;
+    }
+  w->npending = j;
+  return ok;
+}
+
+/* Like pselect, but wait on the calling thread's epoll instance.
+   RFDS and WFDS must contain only descriptors watched with
+   epoll_select_watch or epoll_select_watch_aux; others are never
+   reported ready.  Fall back on pselect when epoll cannot express the
+   request.
+
+   If epoll reports one of the requested descriptors but another
+   thread consumes the input before this one gets to it, or if a
+   descriptor stops being watched, fail with EINTR.  pselect would have
+   returned in those cases, too, and callers such as
+   wait_reading_process_output rely on that to notice changes in
+   process status that another thread has read the notification of.  */
+
+int
+epoll_select (int max_fds, fd_set *rfds, fd_set *wfds, fd_set *efds,
+	      const struct timespec *timeout, const sigset_t *sigmask)
+{
+  sigset_t oldset;
+  lock_tables (&oldset);
+  struct waiter *w = current_waiter ();
+  if (w)
+    w->nresult = -1;
+  unlock_tables (&oldset);
+  if (efds || !w)
+    return pselect (max_fds, rfds, wfds, efds, timeout, sigmask);
+
+  struct timespec deadline;
+  if (timeout)
+    deadline = timespec_add (current_timespec (), *timeout);
+
+  bool woken = false;
+  lock_tables (&oldset);
+  while (true)
+    {
+      bool checked = recheck (w, max_fds, rfds, wfds);
+      if (w->nresult)
+	break;
+      if (woken)
+	{
+	  unlock_tables (&oldset);
+	  errno = EINTR;
+	  return -1;
+	}
+      int nevents = ninterest + 1;
+      unlock_tables (&oldset);
+
+      int ms = -1;
+      if (!checked)
+	ms = 0;
+      else if (timeout)
+	{
+	  struct timespec left = timespec_sub (deadline, current_timespec ());
+	  if (timespec_sign (left) <= 0)
+	    ms = 0;
+	  else if (left.tv_sec < INT_MAX / 1000 - 1)
+	    ms = (left.tv_sec * 1000
+		  + (left.tv_nsec + 999999) / 1000000);
+	  else
+	    ms = INT_MAX;
+	}
+
+      /* Make room for an event from every watched descriptor, if
+	 possible; any that do not fit are returned next time.  */
+      if (w->events_size < nevents)
+	{
+	  struct epoll_event *events
+	    = realloc (w->events, nevents * sizeof *events);
+	  if (events)
+	    {
+	      w->events = events;
+	      w->events_size = nevents;
+	    }
+	}
+
+      int n = epoll_pwait (w->epfd, w->events, w->events_size, ms, sigmask);
+      int err = errno;
+
+      lock_tables (&oldset);
+      if (n < 0)
+	{
+	  unlock_tables (&oldset);
+	  errno = err;
+	  return n;
+	}
+      if (n == 0)
+	break;
+
+      /* Events for descriptors the caller is not interested in do
+	 not end the wait; they stay pending for later calls.  */
+      for (int i = 0; i < n; i++)
+	{
+	  int fd = w->events[i].data.fd;
+	  uint32_t ev = w->events[i].events;
+	  int ready_bits = 0;
+	  if (fd < 0)
+	    {
+	      eventfd_t count;
+	      eventfd_read (w->wakefd, &count);
+	      woken = true;
+	      continue;
+	    }
+	  if (ev & (EPOLLIN | EPOLLERR | EPOLLHUP))
+	    ready_bits |= READY_READ;
+	  if (ev & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+	    ready_bits |= READY_WRITE;
+
+	  /* The descriptor may have been unwatched while we waited.  */
+	  if (fd < interest_size && interest[fd])
+	    {
+	      mark_ready (w, fd, ready_bits);
+	      if (fd < max_fds
+		  && ((ready_bits & READY_READ && rfds && FD_ISSET (fd, rfds))
+		      || (ready_bits & READY_WRITE && wfds
+			  && FD_ISSET (fd, wfds))))
+		woken = true;
+	    }
+	}
+    }
+
+  if (rfds)
+    FD_ZERO (rfds);
+  if (wfds)
+    FD_ZERO (wfds);
+  int nfds = 0;
+  for (int i = 0; i < w->nresult; i++)
+    {
+      int fd = w->result[i];
+      if (w->ready[fd] & REPORT_READ)
+	{
+	  FD_SET (fd, rfds);
+	  nfds++;
+	}
+      if (w->ready[fd] & REPORT_WRITE)
+	{
+	  FD_SET (fd, wfds);
+	  nfds++;
+	}
+      w->ready[fd] &= ~(REPORT_READ | REPORT_WRITE);
+    }
+  unlock_tables (&oldset);
+
+  return nfds;
+}
+
+/* Copy to FDS up to SIZE of the descriptors that the calling thread's
+   last call to epoll_select reported ready, in no particular order.
+   Return their total number, or -1 if that call did not use epoll and
+   the caller should scan its fd_sets instead.  */
+
+int
+epoll_select_ready_fds (int *fds, int size)
+{
+  int n = -1;
+  sigset_t oldset;
+  lock_tables (&oldset);
+  sys_thread_t self = sys_thread_self ();
+  for (struct waiter *w = waiters; w; w = w->next)
+    if (sys_thread_equal (w->thread, self))
+      {
+	n = w->nresult;
+	if (0 < n)
+	  memcpy (fds, w->result, min (n, size) * sizeof *fds);
+	break;
+      }
+  unlock_tables (&oldset);
+  return n;
+}
+
+/* Release the calling thread's epoll instance; the thread is about to
+   exit.  */
+
+void
+epoll_select_thread_exit (void)
+{
+  sigset_t oldset;
+  lock_tables (&oldset);
+  sys_thread_t self = sys_thread_self ();
+  for (struct waiter **p = &waiters; *p; p = &(*p)->next)
+    if (sys_thread_equal ((*p)->thread, self))
+      {
+	struct waiter *w = *p;
+	*p = w->next;
+	emacs_close (w->wakefd);
+	emacs_close (w->epfd);
+	free (w->ready);
+	free (w->pending);
+	free (w->result);
+	free (w->events);
+	free (w);
+	break;
+      }
+  unlock_tables (&oldset);
+}
+
+void
+init_epoll_select (void)
+{
+  sys_mutex_init (&epoll_select_lock);
+}
+
+#endif /* HAVE_EPOLL */
@@ -0,0 +1,46 @@
+/* Header for epoll_select.
+
+Copyright (C) 2021 Free Software Foundation, Inc.
+
+This file is part of GNU Emacs.
+
+GNU Emacs is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or (at
+your option) any later version.
+
+GNU Emacs is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.  */
+
+#ifndef EPOLLSELECT_H
+#define EPOLLSELECT_H
+
+#include "lisp.h"
+#include "sysselect.h"
+
+struct timespec;
+
+/* What a descriptor is watched for.  */
+enum
+  {
+    EPOLL_SELECT_READ = 1,
+    EPOLL_SELECT_WRITE = 2
+  };
+
+extern int epoll_select (int max_fds,
+			 fd_set *rfds, fd_set *wfds, fd_set *efds,
+			 const struct timespec *timeout,
+			 const sigset_t *sigmask);
+extern int epoll_select_ready_fds (int *fds, int size);
+
+extern void epoll_select_watch (int fd, int want);
+extern void epoll_select_watch_aux (int fd, int want);
+extern void epoll_select_thread_exit (void);
+extern void init_epoll_select (void);
+
+#endif /* EPOLLSELECT_H */
@@ -63,6 +63,14 @@ Copyright (C) 1985-1987, 1993-1995, 1999-2021 Free Software Foundation,
 union specbinding *backtrace_next (union specbinding *) EXTERNALLY_VISIBLE;
 union specbinding *backtrace_top (void) EXTERNALLY_VISIBLE;
 
+/* When `apply' spreads its last argument into the argument vector of
+   a call, these record where the spread elements start, how many there
+   are, and the list they came from.  rest_args_list uses them to hand
+   that list to a `&rest' parameter instead of consing a copy.  */
+static Lisp_Object *apply_spread_args;
+static ptrdiff_t apply_spread_nargs;
+static Lisp_Object apply_spread_list;
+
 static Lisp_Object funcall_lambda (Lisp_Object, ptrdiff_t, Lisp_Object *);
 static Lisp_Object apply_lambda (Lisp_Object, Lisp_Object, ptrdiff_t);
 static Lisp_Object lambda_arity (Lisp_Object);
@@ -1622,7 +1630,8 @@ process_quit_flag (void)
    If quit-flag is set to `kill-emacs' the SIGINT handler has received
    a request to exit Emacs when it is safe to do.
 
-   When not quitting, process any pending signals.  */
+   When not quitting, process any pending signals, and signal an
+   error if a file mapped into a buffer was truncated.  */
 
 void
 maybe_quit (void)
@@ -1630,7 +1639,10 @@ maybe_quit (void)
   if (!NILP (Vquit_flag) && NILP (Vinhibit_quit))
     process_quit_flag ();
   else if (pending_signals)
-    process_pending_signals ();
+    {
+      process_pending_signals ();
+      report_lost_mapped_text ();
+    }
 }
 
 DEFUN ("signal", Fsignal, Ssignal, 2, 2, 0,
@@ -2532,6 +2544,12 @@ DEFUN ("apply", Fapply, Sapply, 1, MANY, 0,
   /* Spread the last arg we got.  Its first element goes in
      the slot that it used to occupy, hence this value of I.  */
   i = nargs - 1;
+  if (apply_share_rest_args && funcall_nargs == 1 + numargs)
+    {
+      apply_spread_args = funcall_args + i;
+      apply_spread_nargs = numargs + 1 - i;
+      apply_spread_list = spread_arg;
+    }
   while (!NILP (spread_arg))
     {
       funcall_args [i++] = XCAR (spread_arg);
@@ -2540,9 +2558,38 @@ DEFUN ("apply", Fapply, Sapply, 1, MANY, 0,
 
   Lisp_Object retval = Ffuncall (funcall_nargs, funcall_args);
 
+  apply_spread_args = NULL;
+  apply_spread_list = Qnil;
   SAFE_FREE ();
   return retval;
 }
+
+/* Return a list of the N arguments starting at ARGS, for binding to a
+   `&rest' parameter.  If those arguments are exactly the ones `apply'
+   just spread from its last argument, and `apply-share-rest-args' is
+   non-nil, return that list itself instead of a fresh copy.  */
+
+Lisp_Object
+rest_args_list (ptrdiff_t n, Lisp_Object *args)
+{
+  if (args == apply_spread_args && n == apply_spread_nargs)
+    {
+      Lisp_Object list = apply_spread_list;
+      apply_spread_args = NULL;
+      apply_spread_list = Qnil;
+
+      /* The record is stale if a nonlocal exit skipped its reset in
+	 Fapply, so check that ARGS still hold the list's elements.  */
+      Lisp_Object tail = list;
+      ptrdiff_t i;
+      for (i = 0; i < n && CONSP (tail); i++, tail = XCDR (tail))
+	if (!EQ (XCAR (tail), args[i]))
+	  break;
+      if (i == n && NILP (tail))
+	return list;
+    }
+  return Flist (n, args);
+}
 
 /* Run hook variables in various ways.  */
 
@@ -3148,7 +3195,7 @@ funcall_lambda (Lisp_Object fun, ptrdiff_t nargs,
 	  Lisp_Object arg;
 	  if (rest)
 	    {
-	      arg = Flist (nargs - i, &arg_vector[i]);
+	      arg = rest_args_list (nargs - i, &arg_vector[i]);
 	      i = nargs;
 	    }
 	  else if (i < nargs)
@@ -3426,6 +3473,24 @@ specbind (Lisp_Object symbol, Lisp_Object value)
       do_specbind (sym, specpdl_ptr - 1, value, SET_INTERNAL_BIND);
       break;
     case SYMBOL_LOCALIZED:
+      if (sym->u.s.trapped_write == SYMBOL_UNTRAPPED_WRITE
+	  && !EQ (value, Qunbound))
+	{
+	  /* Variables like `deactivate-mark' are let-bound in tight
+	     loops, so bind them directly in the binding that is loaded
+	     for the current buffer.  */
+	  bool found;
+	  Lisp_Object ovalue = load_localized_binding (sym, &found);
+	  specpdl_ptr->let.kind = found ? SPECPDL_LET_LOCAL : SPECPDL_LET_DEFAULT;
+	  specpdl_ptr->let.symbol = symbol;
+	  specpdl_ptr->let.old_value = ovalue;
+	  specpdl_ptr->let.where = Fcurrent_buffer ();
+	  specpdl_ptr->let.saved_value = Qnil;
+	  grow_specpdl ();
+	  store_loaded_binding (sym, value, current_buffer);
+	  break;
+	}
+      FALLTHROUGH;
     case SYMBOL_FORWARDED:
       {
 	Lisp_Object ovalue = find_symbol_value (symbol);
@@ -3631,7 +3696,15 @@ do_one_unbind (union specbinding *this_binding, bool unwinding,
 
 	/* If this was a local binding, reset the value in the appropriate
 	   buffer, but only if that buffer's binding still exists.  */
-	if (!NILP (Flocal_variable_p (symbol, where)))
+	struct Lisp_Symbol *sym = XSYMBOL (symbol);
+	if (sym->u.s.redirect == SYMBOL_LOCALIZED
+	    && sym->u.s.trapped_write == SYMBOL_UNTRAPPED_WRITE
+	    && EQ (SYMBOL_BLV (sym)->where, where)
+	    && blv_found (SYMBOL_BLV (sym))
+	    && !EQ (old_value, Qunbound))
+	  /* WHERE's own binding is still the one loaded.  */
+	  store_loaded_binding (sym, old_value, XBUFFER (where));
+	else if (!NILP (Flocal_variable_p (symbol, where)))
           set_internal (symbol, old_value, where, bindflag);
       }
       break;
@@ -4297,6 +4370,15 @@ syms_of_eval (void)
 still determine whether to handle the particular condition.  */);
   Vdebug_on_signal = Qnil;
 
+  DEFVAR_BOOL ("apply-share-rest-args", apply_share_rest_args,
+	       doc: /* Non-nil means `apply' may pass its last argument to `&rest'.
+When the list given as the last argument to `apply' supplies exactly the
+arguments bound to the called function's `&rest' parameter, that
+parameter is bound to the list itself rather than to a fresh copy.
+This avoids consing on each such call, but a function that destructively
+modifies its `&rest' list then also modifies the caller's list.  */);
+  apply_share_rest_args = false;
+
   DEFVAR_BOOL ("backtrace-on-error-noninteractive",
                backtrace_on_error_noninteractive,
                doc: /* Non-nil means print backtrace on error in batch mode.
@@ -4345,6 +4427,8 @@ syms_of_eval (void)
   Vautoload_queue = Qnil;
   staticpro (&Vsignaling_function);
   Vsignaling_function = Qnil;
+  staticpro (&apply_spread_list);
+  apply_spread_list = Qnil;
 
   staticpro (&Qcatch_all_memory_full);
   /* Make sure Qcatch_all_memory_full is a unique object.  We could
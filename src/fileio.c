@@ -24,6 +24,9 @@ Copyright (C) 1985-1988, 1993-2021 Free Software Foundation, Inc.
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <unistd.h>
+#ifdef HAVE_WRITEV
+#include <sys/uio.h>
+#endif
 
 #ifdef DARWIN_OS
 #include <sys/attr.h>
@@ -55,6 +58,7 @@ Copyright (C) 1985-1988, 1993-2021 Free Software Foundation, Inc.
 #include "blockinput.h"
 #include "region-cache.h"
 #include "frame.h"
+#include "keyboard.h"
 
 #ifdef HAVE_LINUX_FS_H
 # include <sys/ioctl.h>
@@ -3585,12 +3589,16 @@ decide_coding_unwind (Lisp_Object unwind_data)
         where the coding-system is `raw-text-unix`).
      Here we choose 2.  */
 
-  /* Move the bytes back to (the beginning of) the gap.
+  /* Move the bytes back to (the beginning of) the gap, or to its end
+     if they are mapped from the file, which is where they started.
      In general this may have to move all the bytes, but here
      this can't move more bytes than were moved during the execution
      of Vset_auto_coding_function, which is normally 0 (because it
      normally doesn't modify the buffer).  */
-  move_gap_both (Z, Z_BYTE);
+  if (current_buffer->text->mapped)
+    move_gap_both (BEG, BEG_BYTE);
+  else
+    move_gap_both (Z, Z_BYTE);
   ptrdiff_t inserted = Z_BYTE - BEG_BYTE;
   GAP_SIZE += inserted;
   ZV = Z = GPT = BEG;
@@ -4444,14 +4452,6 @@ because (1) it preserves some marker positions (in unchanged portions
     }
 
   move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < total)
-    make_gap (total - GAP_SIZE);
-
-  if (beg_offset != 0 || !NILP (replace))
-    {
-      if (lseek (fd, beg_offset, SEEK_SET) < 0)
-	report_file_error ("Setting file position", orig_filename);
-    }
 
   /* In the following loop, HOW_MUCH contains the total bytes read so
      far for a regular file, and not changed for a special file.  But,
@@ -4462,6 +4462,26 @@ because (1) it preserves some marker positions (in unchanged portions
   /* Total bytes inserted.  */
   inserted = 0;
 
+  /* Map a whole file that is large enough into an empty unibyte
+     buffer instead of reading it.  That leaves the bytes at the end of
+     the gap rather than at its beginning.  Multibyte text must stay
+     valid, which another program writing to the file could break.  */
+  if (! not_regular && Z == BEG && NILP (replace)
+      && NILP (BVAR (current_buffer, enable_multibyte_characters))
+      && NILP (beg) && NILP (end) && total == st.st_size
+      && FIXNATP (Vlarge_file_mapping_threshold)
+      && XFIXNAT (Vlarge_file_mapping_threshold) <= total
+      && map_buffer_text (current_buffer, fd, total))
+    how_much = inserted = total;
+  else if (GAP_SIZE < total)
+    make_gap (total - GAP_SIZE);
+
+  if (beg_offset != 0 || !NILP (replace))
+    {
+      if (lseek (fd, beg_offset, SEEK_SET) < 0)
+	report_file_error ("Setting file position", orig_filename);
+    }
+
   /* Here, we don't do code conversion in the loop.  It is done by
      decode_coding_gap after all data are read into the buffer.  */
   {
@@ -4582,7 +4602,8 @@ because (1) it preserves some marker positions (in unchanged portions
 	  record_unwind_protect (decide_coding_unwind, unwind_data);
 
           /* Make the text read part of the buffer.  */
-          insert_from_gap_1 (inserted, inserted, false);
+          insert_from_gap_1 (inserted, inserted,
+			     current_buffer->text->mapped);
 
 	  if (inserted > 0 && ! NILP (Vset_auto_coding_function))
 	    {
@@ -4645,8 +4666,9 @@ because (1) it preserves some marker positions (in unchanged portions
     {
       /* Now we have all the new bytes at the beginning of the gap,
          but `decode_coding_gap` can't have them at the beginning of the gap,
-         so we need to move them.  */
-      memmove (GAP_END_ADDR - inserted, GPT_ADDR, inserted);
+         so we need to move them.  Mapped bytes are already at the end.  */
+      if (! current_buffer->text->mapped)
+	memmove (GAP_END_ADDR - inserted, GPT_ADDR, inserted);
       decode_coding_gap (&coding, inserted);
       inserted = coding.produced_char;
       coding_system = CODING_ID_NAME (coding.id);
@@ -4655,11 +4677,17 @@ because (1) it preserves some marker positions (in unchanged portions
     {
       /* Make the text read part of the buffer.  */
       eassert (NILP (BVAR (current_buffer, enable_multibyte_characters)));
-      insert_from_gap_1 (inserted, inserted, false);
+      if (current_buffer->text->mapped)
+	/* Keep mapped bytes where they are, as decode_coding_gap does.  */
+	insert_from_gap (inserted, inserted, true);
+      else
+	{
+	  insert_from_gap_1 (inserted, inserted, false);
 
-      invalidate_buffer_caches (current_buffer, PT, PT + inserted);
-      adjust_after_insert (PT, PT_BYTE, PT + inserted, PT_BYTE + inserted,
-			   inserted);
+	  invalidate_buffer_caches (current_buffer, PT, PT + inserted);
+	  adjust_after_insert (PT, PT_BYTE, PT + inserted, PT_BYTE + inserted,
+			       inserted);
+	}
     }
 
   /* Call after-change hooks for the inserted text, aside from the case
@@ -5179,6 +5207,10 @@ write_region (Lisp_Object start, Lisp_Object end, Lisp_Object filename,
   mode = auto_saving ? auto_save_mode_bits : 0666;
 #endif
 
+  /* Writing a file must not change the text that is written.  */
+  if (!STRINGP (start))
+    unmap_buffer_text_of_file (current_buffer, fn);
+
   if (open_and_close_file)
     {
       desc = emacs_open (fn, open_flags, mode);
@@ -5533,6 +5565,64 @@ a_write (int desc, Lisp_Object string, ptrdiff_t pos,
 
 enum { E_WRITE_MAX = 8 * 1024 * 1024 };
 
+/* Return true if encoding the bytes of the current buffer from
+   START_BYTE to END_BYTE with CODING would not change them.  */
+
+static bool
+buffer_text_identity_p (struct coding_system *coding,
+			ptrdiff_t start_byte, ptrdiff_t end_byte)
+{
+  ptrdiff_t gap = clip_to_bounds (start_byte, GPT_BYTE, end_byte);
+  return (encode_coding_identity_p (coding, BYTE_POS_ADDR (start_byte),
+				    gap - start_byte)
+	  && encode_coding_identity_p (coding, BYTE_POS_ADDR (gap),
+				       end_byte - gap));
+}
+
+/* Write the bytes of the current buffer from START_BYTE to END_BYTE
+   into descriptor DESC as they are.  If the range spans the gap,
+   write both parts with one system call when possible.  Return true
+   if successful.  */
+
+static bool
+write_buffer_bytes (int desc, ptrdiff_t start_byte, ptrdiff_t end_byte)
+{
+#ifdef HAVE_WRITEV
+  if (start_byte < GPT_BYTE && GPT_BYTE < end_byte
+      && end_byte - start_byte <= MAX_RW_COUNT)
+    {
+      struct iovec iov[2];
+      iov[0].iov_base = BYTE_POS_ADDR (start_byte);
+      iov[0].iov_len = GPT_BYTE - start_byte;
+      iov[1].iov_base = GAP_END_ADDR;
+      iov[1].iov_len = end_byte - GPT_BYTE;
+
+      ssize_t written;
+      while ((written = writev (desc, iov, 2)) < 0 && errno == EINTR)
+	{
+	  maybe_quit ();
+	  if (pending_signals)
+	    process_pending_signals ();
+	}
+      if (written < 0)
+	return false;
+      start_byte += written;
+    }
+#endif
+
+  while (start_byte < end_byte)
+    {
+      ptrdiff_t stop = (start_byte < GPT_BYTE
+			? min (GPT_BYTE, end_byte) : end_byte);
+      ptrdiff_t nbytes = stop - start_byte;
+      if (emacs_write_quit (desc, BYTE_POS_ADDR (start_byte), nbytes)
+	  != nbytes)
+	return false;
+      start_byte = stop;
+    }
+  return true;
+}
+
 /* Write text in the range START and END into descriptor DESC,
    encoding them with coding system CODING.  If STRING is nil, START
    and END are character positions of the current buffer, else they
@@ -5551,12 +5641,31 @@ e_write (int desc, Lisp_Object string, ptrdiff_t start, ptrdiff_t end,
   /* We used to have a code for handling selective display here.  But,
      now it is handled within encode_coding.  */
 
+  /* Decide once whether the text needs encoding at all, rather than
+     for the rest of it before each chunk, which would take quadratic
+     time.  */
+  bool encode;
+  if (STRINGP (string))
+    {
+      coding->src_multibyte = SCHARS (string) < SBYTES (string);
+      encode = (CODING_REQUIRE_ENCODING (coding)
+		&& ! encode_coding_identity_p (coding, SDATA (string),
+					       SBYTES (string)));
+    }
+  else
+    {
+      ptrdiff_t start_byte = CHAR_TO_BYTE (start);
+      ptrdiff_t end_byte = CHAR_TO_BYTE (end);
+      coding->src_multibyte = (end - start) < (end_byte - start_byte);
+      encode = (CODING_REQUIRE_ENCODING (coding)
+		&& ! buffer_text_identity_p (coding, start_byte, end_byte));
+    }
+
   while (start < end)
     {
       if (STRINGP (string))
 	{
-	  coding->src_multibyte = SCHARS (string) < SBYTES (string);
-	  if (CODING_REQUIRE_ENCODING (coding))
+	  if (encode)
 	    {
 	      ptrdiff_t nchars = min (end - start, E_WRITE_MAX);
 
@@ -5581,8 +5690,7 @@ e_write (int desc, Lisp_Object string, ptrdiff_t start, ptrdiff_t end,
 	  ptrdiff_t start_byte = CHAR_TO_BYTE (start);
 	  ptrdiff_t end_byte = CHAR_TO_BYTE (end);
 
-	  coding->src_multibyte = (end - start) < (end_byte - start_byte);
-	  if (CODING_REQUIRE_ENCODING (coding))
+	  if (encode)
 	    {
 	      ptrdiff_t nchars = min (end - start, E_WRITE_MAX);
 
@@ -5596,18 +5704,11 @@ e_write (int desc, Lisp_Object string, ptrdiff_t start, ptrdiff_t end,
 	    }
 	  else
 	    {
-	      coding->dst_object = Qnil;
-	      coding->dst_pos_byte = start_byte;
-	      if (start >= GPT || end <= GPT)
-		{
-		  coding->consumed_char = end - start;
-		  coding->produced = end_byte - start_byte;
-		}
-	      else
-		{
-		  coding->consumed_char = GPT - start;
-		  coding->produced = GPT_BYTE - start_byte;
-		}
+	      /* The text can be written as it is, without copying.  */
+	      if (! write_buffer_bytes (desc, start_byte, end_byte))
+		return 0;
+	      coding->consumed_char = end - start;
+	      coding->produced = 0;
 	    }
 	}
 
@@ -6440,6 +6541,24 @@ do (file-exists-p FILENAME) and FILENAME is handled by HANDLER, then
 file is usually more useful if it contains the deleted text.  */);
   Vauto_save_include_big_deletions = Qnil;
 
+  DEFVAR_LISP ("large-file-mapping-threshold", Vlarge_file_mapping_threshold,
+	       doc: /* Size of files, in bytes, from which they are mapped into buffers.
+When `insert-file-contents' inserts a whole regular file that is at
+least this many bytes into an empty unibyte buffer, it maps the file
+into memory instead of reading it.  If the file needs no code
+conversion, the buffer text then uses the file's pages directly, which
+are read only when needed and shared with the operating system's file
+cache.  The first change to the buffer text copies it into memory of
+its own.  Until then, the buffer may show changes that other programs
+make to the file; if they do, the next command or change to the buffer
+signals an error saying so.  If the file is truncated, the text that
+is gone reads as zeros and an error is signaled, so this is best used
+to view large files that do not change, for example with
+`find-file-literally'.  Files are mapped only on systems that allow
+recovering from truncation, such as GNU/Linux.
+If nil, the default, files are always read.  */);
+  Vlarge_file_mapping_threshold = Qnil;
+
   DEFVAR_BOOL ("write-region-inhibit-fsync", write_region_inhibit_fsync,
 	       doc: /* Non-nil means don't call fsync in `write-region'.
 This variable affects calls to `write-region' as well as save commands.
@@ -610,6 +610,428 @@ DEFUN ("ftruncate", Fftruncate, Sftruncate, 1, 1, 0,
   return make_float (d);
 }
 
+/* Numeric vectors.
+
+   These loops are written so that a vectorizing compiler can turn them
+   into SIMD code for whatever the target supports, without having to
+   spell out any particular instruction set here.  */
+
+/* Check that B is either a number or a numeric vector of the same
+   type and length as A.  */
+
+static void
+check_numeric_operand (Lisp_Object a, Lisp_Object b)
+{
+  if (NUMERIC_VECTOR_P (b))
+    {
+      if (PSEUDOVECTOR_TYPE (XVECTOR (a)) != PSEUDOVECTOR_TYPE (XVECTOR (b)))
+	wrong_type_argument (F64VECTORP (a) ? Qf64vector : Qi64vector, b);
+      if (numeric_vector_size (a) != numeric_vector_size (b))
+	xsignal2 (Qwrong_length_argument, a, b);
+    }
+  else
+    CHECK_NUMBER (b);
+}
+
+enum numeric_vector_op { NV_ADD, NV_SUB, NV_MUL, NV_DIV };
+
+/* Apply OP elementwise to the numeric vector A and B, which is either
+   a numeric vector of the same type and length or a scalar.  Store the
+   result into DEST if it is non-nil, and into a new vector otherwise.  */
+
+static Lisp_Object
+numeric_vector_arith (enum numeric_vector_op op, Lisp_Object a,
+		      Lisp_Object b, Lisp_Object dest)
+{
+  CHECK_NUMERIC_VECTOR (a);
+  check_numeric_operand (a, b);
+  EMACS_INT n = numeric_vector_size (a);
+  if (NILP (dest))
+    dest = make_uninit_numeric_vector (PSEUDOVECTOR_TYPE (XVECTOR (a)), n);
+  else
+    {
+      CHECK_NUMERIC_VECTOR (dest);
+      check_numeric_operand (a, dest);
+    }
+
+  union numeric_vector_elt *x = numeric_vector_data (a);
+  union numeric_vector_elt *r = numeric_vector_data (dest);
+  bool vec = NUMERIC_VECTOR_P (b);
+  union numeric_vector_elt *y = vec ? numeric_vector_data (b) : NULL;
+
+  if (F64VECTORP (a))
+    {
+      double s = vec ? 0 : XFLOATINT (b);
+      switch (op)
+	{
+	case NV_ADD:
+	  if (vec)
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f + y[i].f;
+	  else
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f + s;
+	  break;
+	case NV_SUB:
+	  if (vec)
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f - y[i].f;
+	  else
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f - s;
+	  break;
+	case NV_MUL:
+	  if (vec)
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f * y[i].f;
+	  else
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f * s;
+	  break;
+	case NV_DIV:
+	  if (vec)
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f / y[i].f;
+	  else
+	    for (EMACS_INT i = 0; i < n; i++)
+	      r[i].f = x[i].f / s;
+	  break;
+	}
+      return dest;
+    }
+
+  /* For i64vectors, first check that every result fits and that no
+     divisor is zero, and only then store into DEST, so that an error
+     leaves DEST untouched even when it is A or B.  Both passes are
+     straight-line loops.  */
+  int64_t s = vec ? 0 : numeric_vector_i64 (b);
+  bool overflow = false;
+  int64_t t;
+  switch (op)
+    {
+    case NV_ADD:
+      for (EMACS_INT i = 0; i < n; i++)
+	overflow |= INT_ADD_WRAPV (x[i].i, vec ? y[i].i : s, &t);
+      break;
+    case NV_SUB:
+      for (EMACS_INT i = 0; i < n; i++)
+	overflow |= INT_SUBTRACT_WRAPV (x[i].i, vec ? y[i].i : s, &t);
+      break;
+    case NV_MUL:
+      for (EMACS_INT i = 0; i < n; i++)
+	overflow |= INT_MULTIPLY_WRAPV (x[i].i, vec ? y[i].i : s, &t);
+      break;
+    case NV_DIV:
+      {
+	bool zero = false;
+	for (EMACS_INT i = 0; i < n; i++)
+	  {
+	    int64_t d = vec ? y[i].i : s;
+	    zero |= d == 0;
+	    overflow |= d == -1 && x[i].i == INT64_MIN;
+	  }
+	if (zero)
+	  xsignal0 (Qarith_error);
+      }
+      break;
+    }
+  if (overflow)
+    xsignal0 (Qoverflow_error);
+
+  switch (op)
+    {
+    case NV_ADD:
+      for (EMACS_INT i = 0; i < n; i++)
+	r[i].i = x[i].i + (vec ? y[i].i : s);
+      break;
+    case NV_SUB:
+      for (EMACS_INT i = 0; i < n; i++)
+	r[i].i = x[i].i - (vec ? y[i].i : s);
+      break;
+    case NV_MUL:
+      for (EMACS_INT i = 0; i < n; i++)
+	r[i].i = x[i].i * (vec ? y[i].i : s);
+      break;
+    case NV_DIV:
+      for (EMACS_INT i = 0; i < n; i++)
+	r[i].i = x[i].i / (vec ? y[i].i : s);
+      break;
+    }
+  return dest;
+}
+
+DEFUN ("numeric-vector-add", Fnumeric_vector_add, Snumeric_vector_add,
+       2, 3, 0,
+       doc: /* Return the elementwise sum of numeric vector A and B.
+B is either a numeric vector of the same type and length as A, or a
+number that is added to each element of A.  If DEST is non-nil, it
+must be a numeric vector of the same type and length as A; store the
+result there and return it.  DEST may be A or B itself.  Otherwise
+return a new vector.  For an i64vector, signal an `overflow-error' if
+a result does not fit in 64 bits.  DEST is left unchanged if an error
+is signaled.  */)
+  (Lisp_Object a, Lisp_Object b, Lisp_Object dest)
+{
+  return numeric_vector_arith (NV_ADD, a, b, dest);
+}
+
+DEFUN ("numeric-vector-sub", Fnumeric_vector_sub, Snumeric_vector_sub,
+       2, 3, 0,
+       doc: /* Return the elementwise difference of numeric vector A and B.
+B and DEST are as for `numeric-vector-add'.  */)
+  (Lisp_Object a, Lisp_Object b, Lisp_Object dest)
+{
+  return numeric_vector_arith (NV_SUB, a, b, dest);
+}
+
+DEFUN ("numeric-vector-mul", Fnumeric_vector_mul, Snumeric_vector_mul,
+       2, 3, 0,
+       doc: /* Return the elementwise product of numeric vector A and B.
+B and DEST are as for `numeric-vector-add'.  */)
+  (Lisp_Object a, Lisp_Object b, Lisp_Object dest)
+{
+  return numeric_vector_arith (NV_MUL, a, b, dest);
+}
+
+DEFUN ("numeric-vector-div", Fnumeric_vector_div, Snumeric_vector_div,
+       2, 3, 0,
+       doc: /* Return the elementwise quotient of numeric vector A and B.
+B and DEST are as for `numeric-vector-add'.  For an i64vector, the
+quotients are truncated toward zero as with `/', and dividing by zero
+signals an `arith-error'.  */)
+  (Lisp_Object a, Lisp_Object b, Lisp_Object dest)
+{
+  return numeric_vector_arith (NV_DIV, a, b, dest);
+}
+
+DEFUN ("numeric-vector-sum", Fnumeric_vector_sum, Snumeric_vector_sum,
+       1, 1, 0,
+       doc: /* Return the sum of the elements of numeric vector VEC.
+For an f64vector the additions may be done in a different order than
+a left-to-right fold, so the result can differ in its last bits from
+that of `+'.  For an i64vector the result is exact.  */)
+  (Lisp_Object vec)
+{
+  CHECK_NUMERIC_VECTOR (vec);
+  EMACS_INT n = numeric_vector_size (vec);
+  union numeric_vector_elt *x = numeric_vector_data (vec);
+
+  if (F64VECTORP (vec))
+    {
+      /* Several independent accumulators let the additions overlap.  */
+      double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+      EMACS_INT i = 0;
+      for (; i + 4 <= n; i += 4)
+	{
+	  s0 += x[i].f;
+	  s1 += x[i + 1].f;
+	  s2 += x[i + 2].f;
+	  s3 += x[i + 3].f;
+	}
+      for (; i < n; i++)
+	s0 += x[i].f;
+      return make_float ((s0 + s1) + (s2 + s3));
+    }
+
+  int64_t s = 0;
+  bool overflow = false;
+  for (EMACS_INT i = 0; i < n; i++)
+    overflow |= INT_ADD_WRAPV (s, x[i].i, &s);
+  if (!overflow)
+    return make_int (s);
+
+  Lisp_Object sum = make_fixnum (0);
+  for (EMACS_INT i = 0; i < n; i++)
+    sum = CALLN (Fplus, sum, make_int (x[i].i));
+  return sum;
+}
+
+DEFUN ("numeric-vector-dot", Fnumeric_vector_dot, Snumeric_vector_dot,
+       2, 2, 0,
+       doc: /* Return the dot product of numeric vectors A and B.
+A and B must have the same type and length.  As with
+`numeric-vector-sum', the result for f64vectors may differ in its last
+bits from a left-to-right fold, and the result for i64vectors is
+exact.  */)
+  (Lisp_Object a, Lisp_Object b)
+{
+  CHECK_NUMERIC_VECTOR (a);
+  CHECK_NUMERIC_VECTOR (b);
+  check_numeric_operand (a, b);
+  EMACS_INT n = numeric_vector_size (a);
+  union numeric_vector_elt *x = numeric_vector_data (a);
+  union numeric_vector_elt *y = numeric_vector_data (b);
+
+  if (F64VECTORP (a))
+    {
+      double s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+      EMACS_INT i = 0;
+      for (; i + 4 <= n; i += 4)
+	{
+	  s0 += x[i].f * y[i].f;
+	  s1 += x[i + 1].f * y[i + 1].f;
+	  s2 += x[i + 2].f * y[i + 2].f;
+	  s3 += x[i + 3].f * y[i + 3].f;
+	}
+      for (; i < n; i++)
+	s0 += x[i].f * y[i].f;
+      return make_float ((s0 + s1) + (s2 + s3));
+    }
+
+  int64_t s = 0;
+  bool overflow = false;
+  for (EMACS_INT i = 0; i < n; i++)
+    {
+      int64_t p;
+      overflow |= INT_MULTIPLY_WRAPV (x[i].i, y[i].i, &p);
+      overflow |= INT_ADD_WRAPV (s, p, &s);
+    }
+  if (!overflow)
+    return make_int (s);
+
+  Lisp_Object sum = make_fixnum (0);
+  for (EMACS_INT i = 0; i < n; i++)
+    sum = CALLN (Fplus, sum,
+		 CALLN (Ftimes, make_int (x[i].i), make_int (y[i].i)));
+  return sum;
+}
+
+/* Return the minimum (if MAX is false) or maximum element of the
+   numeric vector VEC.  */
+
+static Lisp_Object
+numeric_vector_minmax (Lisp_Object vec, bool max)
+{
+  CHECK_NUMERIC_VECTOR (vec);
+  EMACS_INT n = numeric_vector_size (vec);
+  union numeric_vector_elt *x = numeric_vector_data (vec);
+  if (n == 0)
+    args_out_of_range (vec, make_fixnum (0));
+
+  if (F64VECTORP (vec))
+    {
+      /* As with 'min' and 'max', a NaN anywhere makes the result NaN.  */
+      double m = x[0].f;
+      bool nan = false;
+      for (EMACS_INT i = 0; i < n; i++)
+	{
+	  double v = x[i].f;
+	  nan |= isnan (v);
+	  m = (max ? v > m : v < m) ? v : m;
+	}
+      if (nan)
+	for (EMACS_INT i = 0; ; i++)
+	  if (isnan (x[i].f))
+	    return make_float (x[i].f);
+      return make_float (m);
+    }
+
+  int64_t m = x[0].i;
+  for (EMACS_INT i = 1; i < n; i++)
+    {
+      int64_t v = x[i].i;
+      m = (max ? v > m : v < m) ? v : m;
+    }
+  return make_int (m);
+}
+
+DEFUN ("numeric-vector-min", Fnumeric_vector_min, Snumeric_vector_min,
+       1, 1, 0,
+       doc: /* Return the smallest element of the numeric vector VEC.
+If VEC is an f64vector containing a NaN, return a NaN.  Signal an
+error if VEC is empty.  */)
+  (Lisp_Object vec)
+{
+  return numeric_vector_minmax (vec, false);
+}
+
+DEFUN ("numeric-vector-max", Fnumeric_vector_max, Snumeric_vector_max,
+       1, 1, 0,
+       doc: /* Return the largest element of the numeric vector VEC.
+If VEC is an f64vector containing a NaN, return a NaN.  Signal an
+error if VEC is empty.  */)
+  (Lisp_Object vec)
+{
+  return numeric_vector_minmax (vec, true);
+}
+
+/* Comparison functions for sorting numeric vectors with qsort.  NaNs
+   sort after all other doubles.  */
+
+static int
+compare_f64 (void const *a, void const *b)
+{
+  double x = ((union numeric_vector_elt const *) a)->f;
+  double y = ((union numeric_vector_elt const *) b)->f;
+  if (isnan (x) || isnan (y))
+    return isnan (x) - isnan (y);
+  return (x > y) - (x < y);
+}
+
+static int
+compare_i64 (void const *a, void const *b)
+{
+  int64_t x = ((union numeric_vector_elt const *) a)->i;
+  int64_t y = ((union numeric_vector_elt const *) b)->i;
+  return (x > y) - (x < y);
+}
+
+DEFUN ("numeric-vector-sort", Fnumeric_vector_sort, Snumeric_vector_sort,
+       1, 1, 0,
+       doc: /* Sort the numeric vector VEC in place into ascending order.
+In an f64vector, NaNs are moved to the end.  Return VEC.  */)
+  (Lisp_Object vec)
+{
+  CHECK_NUMERIC_VECTOR (vec);
+  qsort (numeric_vector_data (vec), numeric_vector_size (vec),
+	 sizeof (union numeric_vector_elt),
+	 F64VECTORP (vec) ? compare_f64 : compare_i64);
+  return vec;
+}
+
+DEFUN ("numeric-vector-search", Fnumeric_vector_search,
+       Snumeric_vector_search, 2, 2, 0,
+       doc: /* Search the sorted numeric vector VEC for VALUE.
+Return the index of the first element that is not less than VALUE, or
+the length of VEC if there is none.  VEC must be in the order produced
+by `numeric-vector-sort'.  */)
+  (Lisp_Object vec, Lisp_Object value)
+{
+  CHECK_NUMERIC_VECTOR (vec);
+  CHECK_NUMBER (value);
+  union numeric_vector_elt *x = numeric_vector_data (vec);
+  EMACS_INT lo = 0, hi = numeric_vector_size (vec);
+
+  if (F64VECTORP (vec))
+    {
+      union numeric_vector_elt key = { .f = XFLOATINT (value) };
+      while (lo < hi)
+	{
+	  EMACS_INT mid = lo + (hi - lo) / 2;
+	  if (compare_f64 (&x[mid], &key) < 0)
+	    lo = mid + 1;
+	  else
+	    hi = mid;
+	}
+    }
+  else
+    {
+      /* Compare as Lisp numbers would, so that a float or an
+	 out-of-range integer VALUE finds the right position.  */
+      while (lo < hi)
+	{
+	  EMACS_INT mid = lo + (hi - lo) / 2;
+	  if (FIXNUMP (value)
+	      ? x[mid].i < XFIXNUM (value)
+	      : !NILP (arithcompare (make_int (x[mid].i), value, ARITH_LESS)))
+	    lo = mid + 1;
+	  else
+	    hi = mid;
+	}
+    }
+  return make_fixnum (lo);
+}
+
 void
 syms_of_floatfns (void)
 {
@@ -639,4 +1061,15 @@ syms_of_floatfns (void)
   defsubr (&Sfloor);
   defsubr (&Sround);
   defsubr (&Struncate);
+
+  defsubr (&Snumeric_vector_add);
+  defsubr (&Snumeric_vector_sub);
+  defsubr (&Snumeric_vector_mul);
+  defsubr (&Snumeric_vector_div);
+  defsubr (&Snumeric_vector_sum);
+  defsubr (&Snumeric_vector_dot);
+  defsubr (&Snumeric_vector_min);
+  defsubr (&Snumeric_vector_max);
+  defsubr (&Snumeric_vector_sort);
+  defsubr (&Snumeric_vector_search);
 }
@@ -125,6 +125,8 @@ DEFUN ("length", Flength, Slength, 1, 1, 0,
     val = MAX_CHAR;
   else if (BOOL_VECTOR_P (sequence))
     val = bool_vector_size (sequence);
+  else if (NUMERIC_VECTOR_P (sequence))
+    val = numeric_vector_size (sequence);
   else if (COMPILEDP (sequence) || RECORDP (sequence))
     val = PVSIZE (sequence);
   else if (CONSP (sequence))
@@ -666,6 +668,16 @@ DEFUN ("copy-sequence", Fcopy_sequence, Scopy_sequence, 1, 1, 0,
       return val;
     }
 
+  if (NUMERIC_VECTOR_P (arg))
+    {
+      EMACS_INT size = numeric_vector_size (arg);
+      Lisp_Object val
+	= make_uninit_numeric_vector (PSEUDOVECTOR_TYPE (XVECTOR (arg)), size);
+      memcpy (numeric_vector_data (val), numeric_vector_data (arg),
+	      size * sizeof (union numeric_vector_elt));
+      return val;
+    }
+
   if (!CONSP (arg) && !VECTORP (arg) && !STRINGP (arg))
     wrong_type_argument (Qsequencep, arg);
 
@@ -722,7 +734,8 @@ concat (ptrdiff_t nargs, Lisp_Object *args,
     {
       this = args[argnum];
       if (!(CONSP (this) || NILP (this) || VECTORP (this) || STRINGP (this)
-	    || COMPILEDP (this) || BOOL_VECTOR_P (this)))
+	    || COMPILEDP (this) || BOOL_VECTOR_P (this)
+	    || NUMERIC_VECTOR_P (this)))
 	wrong_type_argument (Qsequencep, this);
     }
 
@@ -747,10 +760,11 @@ concat (ptrdiff_t nargs, Lisp_Object *args,
 	  int c;
 	  ptrdiff_t this_len_byte;
 
-	  if (VECTORP (this) || COMPILEDP (this))
+	  if (VECTORP (this) || COMPILEDP (this) || NUMERIC_VECTOR_P (this))
 	    for (i = 0; i < len; i++)
 	      {
-		ch = AREF (this, i);
+		ch = (NUMERIC_VECTOR_P (this)
+		      ? numeric_vector_ref (this, i) : AREF (this, i));
 		CHECK_CHARACTER (ch);
 		c = XFIXNAT (ch);
 		this_len_byte = CHAR_BYTES (c);
@@ -896,6 +910,11 @@ concat (ptrdiff_t nargs, Lisp_Object *args,
 		elt = bool_vector_ref (this, thisindex);
 		thisindex++;
 	      }
+	    else if (NUMERIC_VECTOR_P (this))
+	      {
+		elt = numeric_vector_ref (this, thisindex);
+		thisindex++;
+	      }
 	    else
 	      {
 		elt = AREF (this, thisindex);
@@ -1978,6 +1997,18 @@ DEFUN ("nreverse", Fnreverse, Snreverse, 1, 1, 0,
 	  bool_vector_set (seq, size - i - 1, tem);
 	}
     }
+  else if (NUMERIC_VECTOR_P (seq))
+    {
+      union numeric_vector_elt *data = numeric_vector_data (seq);
+      ptrdiff_t i, size = numeric_vector_size (seq);
+
+      for (i = 0; i < size / 2; i++)
+	{
+	  union numeric_vector_elt tem = data[i];
+	  data[i] = data[size - i - 1];
+	  data[size - i - 1] = tem;
+	}
+    }
   else
     wrong_type_argument (Qarrayp, seq);
   return seq;
@@ -2016,6 +2047,15 @@ DEFUN ("reverse", Freverse, Sreverse, 1, 1, 0,
       for (i = 0; i < nbits; i++)
 	bool_vector_set (new, i, bool_vector_bitref (seq, nbits - i - 1));
     }
+  else if (NUMERIC_VECTOR_P (seq))
+    {
+      ptrdiff_t i, size = numeric_vector_size (seq);
+
+      new = make_uninit_numeric_vector (PSEUDOVECTOR_TYPE (XVECTOR (seq)),
+					size);
+      for (i = 0; i < size; i++)
+	numeric_vector_data (new)[i] = numeric_vector_data (seq)[size - i - 1];
+    }
   else if (STRINGP (seq))
     {
       ptrdiff_t size = SCHARS (seq), bytes = SBYTES (seq);
@@ -2509,8 +2549,8 @@ internal_equal (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 	if (ASIZE (o2) != size)
 	  return false;
 
-	/* Compare bignums, overlays, markers, and boolvectors
-	   specially, by comparing their values.  */
+	/* Compare bignums, overlays, markers, boolvectors and numeric
+	   vectors specially, by comparing their values.  */
 	if (BIGNUMP (o1))
 	  return mpz_cmp (*xbignum_val (o1), *xbignum_val (o2)) == 0;
 	if (OVERLAYP (o1))
@@ -2538,6 +2578,14 @@ internal_equal (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 		    && !memcmp (bool_vector_data (o1), bool_vector_data (o2),
 			        bool_vector_bytes (size)));
 	  }
+	if (NUMERIC_VECTOR_P (o1))
+	  {
+	    EMACS_INT size = numeric_vector_size (o1);
+	    return (size == numeric_vector_size (o2)
+		    && !memcmp (numeric_vector_data (o1),
+				numeric_vector_data (o2),
+				size * sizeof (union numeric_vector_elt)));
+	  }
 
 	/* Aside from them, only true vectors, char-tables, compiled
 	   functions, and fonts (font-spec, font-entity, font-object)
@@ -2578,7 +2626,8 @@ internal_equal (Lisp_Object o1, Lisp_Object o2, enum equal_kind equal_kind,
 
 DEFUN ("fillarray", Ffillarray, Sfillarray, 2, 2, 0,
        doc: /* Store each element of ARRAY with ITEM.
-ARRAY is a vector, string, char-table, or bool-vector.  */)
+ARRAY is a vector, string, char-table, bool-vector, f64vector or
+i64vector.  */)
   (Lisp_Object array, Lisp_Object item)
 {
   register ptrdiff_t size, idx;
@@ -2629,6 +2678,17 @@ DEFUN ("fillarray", Ffillarray, Sfillarray, 2, 2, 0,
     }
   else if (BOOL_VECTOR_P (array))
     return bool_vector_fill (array, item);
+  else if (NUMERIC_VECTOR_P (array))
+    {
+      size = numeric_vector_size (array);
+      if (size != 0)
+	{
+	  union numeric_vector_elt *data = numeric_vector_data (array);
+	  numeric_vector_set (array, 0, item);
+	  for (idx = 1; idx < size; idx++)
+	    data[idx] = data[0];
+	}
+    }
   else
     wrong_type_argument (Qarrayp, array);
   return array;
@@ -2719,6 +2779,15 @@ mapcar1 (EMACS_INT leni, Lisp_Object *vals, Lisp_Object fn, Lisp_Object seq)
 	    vals[i] = dummy;
 	}
     }
+  else if (NUMERIC_VECTOR_P (seq))
+    {
+      for (EMACS_INT i = 0; i < leni; i++)
+	{
+	  Lisp_Object dummy = call1 (fn, numeric_vector_ref (seq, i));
+	  if (vals)
+	    vals[i] = dummy;
+	}
+    }
   else if (STRINGP (seq))
     {
       ptrdiff_t i_byte = 0;
@@ -4359,11 +4428,20 @@ hash_table_rehash (Lisp_Object hash)
 ptrdiff_t
 hash_lookup (struct Lisp_Hash_Table *h, Lisp_Object key, Lisp_Object *hash)
 {
-  ptrdiff_t start_of_bucket, i;
-
   Lisp_Object hash_code = h->test.hashfn (key, h);
   if (hash)
     *hash = hash_code;
+  return hash_lookup_with_hash (h, key, hash_code);
+}
+
+/* Like hash_lookup, but use HASH_CODE as the hash code of KEY instead
+   of computing it, for callers that already know it.  */
+
+ptrdiff_t
+hash_lookup_with_hash (struct Lisp_Hash_Table *h, Lisp_Object key,
+		       Lisp_Object hash_code)
+{
+  ptrdiff_t start_of_bucket, i;
 
   start_of_bucket = XUFIXNUM (hash_code) % ASIZE (h->index);
 
@@ -4712,6 +4790,24 @@ sxhash_bool_vector (Lisp_Object vec)
   return SXHASH_REDUCE (hash);
 }
 
+/* Return a hash for f64vector or i64vector VEC.  Elements are hashed
+   by their bit patterns, matching the memcmp done by 'equal'.  */
+
+static EMACS_UINT
+sxhash_numeric_vector (Lisp_Object vec)
+{
+  EMACS_INT size = numeric_vector_size (vec);
+  union numeric_vector_elt *data = numeric_vector_data (vec);
+  EMACS_UINT hash = size;
+  int i, n;
+
+  n = min (SXHASH_MAX_LEN, size);
+  for (i = 0; i < n; ++i)
+    hash = sxhash_combine (hash, data[i].i);
+
+  return SXHASH_REDUCE (hash);
+}
+
 /* Return a hash for a bignum.  */
 
 static EMACS_UINT
@@ -4782,6 +4878,8 @@ sxhash_obj (Lisp_Object obj, int depth)
 	  }
 	else if (pvec_type == PVEC_BOOL_VECTOR)
 	  return sxhash_bool_vector (obj);
+	else if (pvec_type == PVEC_F64VECTOR || pvec_type == PVEC_I64VECTOR)
+	  return sxhash_numeric_vector (obj);
 	else if (pvec_type == PVEC_OVERLAY)
 	  {
 	    EMACS_UINT hash = sxhash_obj (OVERLAY_START (obj), depth);
@@ -64,6 +64,12 @@
 #  define HAVE_GNUTLS_EXT_GET_NAME
 # endif
 
+/* TLS 1.3, and the flag telling whether a session ticket for it has
+   arrived, are known only to newer versions.  */
+# if GNUTLS_VERSION_NUMBER >= 0x030605
+#  define HAVE_GNUTLS_TLS1_3
+# endif
+
 /* Although AEAD support started in GnuTLS 3.4.0 and works in 3.5.14,
    it was broken through at least GnuTLS 3.4.10; see:
    https://lists.gnu.org/r/emacs-devel/2017-07/msg00992.html
@@ -228,6 +234,14 @@ DEF_DLL_FN (const char *, gnutls_compression_get_name,
             (gnutls_compression_method_t));
 #  endif
 DEF_DLL_FN (unsigned, gnutls_safe_renegotiation_status, (gnutls_session_t));
+DEF_DLL_FN (int, gnutls_session_get_data2,
+	    (gnutls_session_t, gnutls_datum_t *));
+DEF_DLL_FN (int, gnutls_session_set_data,
+	    (gnutls_session_t, const void *, size_t));
+DEF_DLL_FN (int, gnutls_session_is_resumed, (gnutls_session_t));
+#  ifdef HAVE_GNUTLS_TLS1_3
+DEF_DLL_FN (unsigned, gnutls_session_get_flags, (gnutls_session_t));
+#  endif
 
 #  ifdef HAVE_GNUTLS3
 DEF_DLL_FN (const gnutls_mac_algorithm_t *, gnutls_mac_list, (void));
@@ -379,6 +393,12 @@ init_gnutls_functions (void)
   LOAD_DLL_FN (library, gnutls_compression_get_name);
 #  endif
   LOAD_DLL_FN (library, gnutls_safe_renegotiation_status);
+  LOAD_DLL_FN (library, gnutls_session_get_data2);
+  LOAD_DLL_FN (library, gnutls_session_set_data);
+  LOAD_DLL_FN (library, gnutls_session_is_resumed);
+#  ifdef HAVE_GNUTLS_TLS1_3
+  LOAD_DLL_FN (library, gnutls_session_get_flags);
+#  endif
 #  ifdef HAVE_GNUTLS3
   LOAD_DLL_FN (library, gnutls_mac_list);
 #   ifdef HAVE_GNUTLS_MAC_GET_NONCE_SIZE
@@ -491,6 +511,10 @@ init_gnutls_functions (void)
 #  define gnutls_record_send fn_gnutls_record_send
 #  define gnutls_sec_param_get_name fn_gnutls_sec_param_get_name
 #  define gnutls_server_name_set fn_gnutls_server_name_set
+#  define gnutls_session_get_data2 fn_gnutls_session_get_data2
+#  define gnutls_session_get_flags fn_gnutls_session_get_flags
+#  define gnutls_session_is_resumed fn_gnutls_session_is_resumed
+#  define gnutls_session_set_data fn_gnutls_session_set_data
 #  define gnutls_sign_get_name fn_gnutls_sign_get_name
 #  define gnutls_strerror fn_gnutls_strerror
 #  define gnutls_transport_set_errno fn_gnutls_transport_set_errno
@@ -780,6 +804,13 @@ emacs_gnutls_read (struct Lisp_Process *proc, char *buf, ptrdiff_t nbyte)
   else if (rtnval == GNUTLS_E_UNEXPECTED_PACKET_LENGTH)
     /* The peer closed the connection. */
     return 0;
+  else if (rtnval == GNUTLS_E_AGAIN)
+    {
+      /* Nothing more to read for now.  This is normal when draining
+	 the records that have arrived, so don't log it.  */
+      errno = EAGAIN;
+      return -1;
+    }
   else
     return emacs_gnutls_handle_error (state, rtnval);
 }
@@ -918,6 +949,49 @@ gnutls_deinit_certificates (struct Lisp_Process *p)
   p->gnutls_certificates = NULL;
 }
 
+/* Hash table mapping session keys (see Fgnutls_boot) to the data of
+   the latest TLS session with that peer, so that reconnecting to it
+   can resume the session instead of doing a full handshake.  Nil
+   until the first session is saved.  */
+static Lisp_Object gnutls_session_cache;
+
+/* The number of sessions after which the cache is emptied.  */
+enum { GNUTLS_SESSION_CACHE_SIZE = 256 };
+
+/* Remember the session of P for resumption, if it can be resumed.  */
+static void
+gnutls_save_session (struct Lisp_Process *p)
+{
+  gnutls_session_t state = p->gnutls_state;
+  gnutls_datum_t data;
+
+  if (NILP (p->gnutls_session_key) || !state
+      || p->gnutls_initstage != GNUTLS_STAGE_READY)
+    return;
+
+# ifdef HAVE_GNUTLS_TLS1_3
+  /* A TLS 1.3 session can only be resumed with a ticket, which the
+     server sends some time after the handshake.  */
+  if (gnutls_protocol_get_version (state) == GNUTLS_TLS1_3
+      && ! (gnutls_session_get_flags (state) & GNUTLS_SFLAGS_SESSION_TICKET))
+    return;
+# endif
+
+  if (gnutls_session_get_data2 (state, &data) < GNUTLS_E_SUCCESS)
+    return;
+
+  if (NILP (gnutls_session_cache))
+    gnutls_session_cache = CALLN (Fmake_hash_table, QCtest, Qequal);
+  else if (XHASH_TABLE (gnutls_session_cache)->count
+	   >= GNUTLS_SESSION_CACHE_SIZE)
+    Fclrhash (gnutls_session_cache);
+
+  Lisp_Object session = make_unibyte_string ((char *) data.data, data.size);
+  gnutls_free (data.data);
+  Fputhash (p->gnutls_session_key, session, gnutls_session_cache);
+  GNUTLS_LOG (2, p->gnutls_log_level, "saved the session for resumption");
+}
+
 Lisp_Object
 emacs_gnutls_deinit (Lisp_Object proc)
 {
@@ -946,6 +1020,9 @@ emacs_gnutls_deinit (Lisp_Object proc)
 
   if (XPROCESS (proc)->gnutls_state)
     {
+      /* The ticket of a TLS 1.3 session may have arrived only after
+	 the session was first saved.  */
+      gnutls_save_session (XPROCESS (proc));
       gnutls_deinit (XPROCESS (proc)->gnutls_state);
       XPROCESS (proc)->gnutls_state = NULL;
       if (GNUTLS_INITSTAGE (proc) >= GNUTLS_STAGE_INIT)
@@ -1514,6 +1591,11 @@ DEFUN ("gnutls-peer-status", Fgnutls_peer_status, Sgnutls_peer_status, 1, 1, 0,
       (result, list2 (intern (":safe-renegotiation"),
 		      gnutls_safe_renegotiation_status (state) ? Qt : Qnil));
 
+  /* Session resumption.  */
+  result = nconc2
+    (result, list2 (intern (":resumed"),
+		    gnutls_session_is_resumed (state) ? Qt : Qnil));
+
   return result;
 }
 
@@ -1770,6 +1852,8 @@ gnutls_verify_boot (Lisp_Object proc, Lisp_Object proplist)
   /* Set this flag only if the whole initialization succeeded.  */
   p->gnutls_p = true;
 
+  gnutls_save_session (p);
+
   return gnutls_make_error (ret);
 }
 
@@ -2107,6 +2191,34 @@ DEFUN ("gnutls-boot", Fgnutls_boot, Sgnutls_boot, 3, 3, 0,
 	return gnutls_make_error (ret);
     }
 
+  /* Resume the last session with the same peer, if any.  Sessions
+     that authenticate with a client certificate are not reused, since
+     the certificate might have changed.  */
+  Lisp_Object service = Fplist_get (p->childp, QCservice);
+  Lisp_Object session_key = Qnil;
+  if (gnutls_resume_sessions && NILP (keylist) && !NILP (service))
+    {
+      AUTO_STRING (format, "%s:%s:%s:%s");
+      session_key = CALLN (Fformat, format, hostname, service, type,
+			   priority_string);
+      Lisp_Object session = (NILP (gnutls_session_cache) ? Qnil
+			     : Fgethash (session_key, gnutls_session_cache,
+					 Qnil));
+      if (STRINGP (session))
+	{
+	  GNUTLS_LOG (1, max_log_level, "resuming the previous session");
+	  ret = gnutls_session_set_data (state, SDATA (session),
+					 SBYTES (session));
+	  if (ret < GNUTLS_E_SUCCESS)
+	    {
+	      GNUTLS_LOG2i (1, max_log_level,
+			    "resuming the session failed with code ", ret);
+	      Fremhash (session_key, gnutls_session_cache);
+	    }
+	}
+    }
+  pset_gnutls_session_key (p, session_key);
+
   XPROCESS (proc)->gnutls_complete_negotiation_p =
     !NILP (Fplist_get (proplist, QCcomplete_negotiation));
   GNUTLS_INITSTAGE (proc) = GNUTLS_STAGE_CRED_SET;
@@ -2923,6 +3035,18 @@ syms_of_gnutls (void)
   staticpro (&cipher_cache);
 #endif
 
+  gnutls_session_cache = Qnil;
+  staticpro (&gnutls_session_cache);
+
+  DEFVAR_BOOL ("gnutls-resume-sessions", gnutls_resume_sessions,
+	       doc: /* Non-nil means resume TLS sessions when reconnecting.
+When this is non-nil, `gnutls-boot' remembers the session of each TLS
+connection, and a later connection to the same host and service
+offers to resume it, which avoids most of the cost of a full
+handshake.  The peer's certificate is verified as usual either way.
+The sessions are only kept in memory.  */);
+  gnutls_resume_sessions = true;
+
   DEFVAR_INT ("gnutls-log-level", global_gnutls_log_level,
 	      doc: /* Logging level used by the GnuTLS functions.
 Set this larger than 0 to get debug output in the *Messages* buffer.
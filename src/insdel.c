@@ -470,7 +470,13 @@ make_gap_larger (ptrdiff_t nbytes_added)
   nbytes_added = min (nbytes_added + GAP_BYTES_DFL,
 		      BUF_BYTES_MAX - current_size);
 
-  enlarge_buffer_text (current_buffer, nbytes_added);
+  /* Any end slack becomes part of the new gap.  */
+  if (current_buffer->text->end_slack < nbytes_added)
+    enlarge_buffer_text (current_buffer,
+			 nbytes_added - current_buffer->text->end_slack);
+  else
+    nbytes_added = current_buffer->text->end_slack;
+  current_buffer->text->end_slack = 0;
 
   /* Prevent quitting in gap_left.  We cannot allow a quit there,
      because that would leave the buffer text in an inconsistent
@@ -546,7 +552,10 @@ make_gap_smaller (ptrdiff_t nbytes_removed)
   /* Move the unwanted pretend gap to the end of the buffer.  */
   gap_right (Z, Z_BYTE);
 
-  enlarge_buffer_text (current_buffer, -nbytes_removed);
+  /* Give back any end slack as well.  */
+  enlarge_buffer_text (current_buffer,
+		       -nbytes_removed - current_buffer->text->end_slack);
+  current_buffer->text->end_slack = 0;
 
   /* Now restore the desired gap.  */
   GAP_SIZE = new_gap_size;
@@ -603,6 +612,102 @@ make_gap_1 (struct buffer *b, ptrdiff_t nbytes)
   current_buffer = oldb;
 }
 
+/* An edit less than END_EDIT_MAX bytes before the end of the text,
+   when the gap is more than 16 times as far away, shifts the text after
+   it through free space kept after the anchor at Z, the "end slack",
+   instead of moving the gap there.  This way, edits that alternate
+   between the start and the end of a large buffer each copy a little
+   text, not all the text between them.  The gap stays put, so the text
+   remains an ordinary gap buffer to everything else.
+
+   This helps only edits near Z.  Edits scattered through the middle
+   of a large buffer still move the gap to each of them; avoiding that
+   would take a piece table or rope, and a regex engine that searches
+   text split into any number of segments rather than two.  */
+
+enum { END_EDIT_MAX = 64 * 1024 };
+
+/* Return true if an edit at byte position BYTEPOS should shift the
+   text after it instead of moving the gap.  */
+
+static bool
+end_edit_p (ptrdiff_t bytepos)
+{
+  return (GPT_BYTE < bytepos
+	  && Z_BYTE - bytepos < END_EDIT_MAX
+	  && bytepos - GPT_BYTE > 16 * END_EDIT_MAX
+	  /* decode_coding_object needs the old gap contents.  */
+	  && !current_buffer->text->inhibit_shrinking);
+}
+
+/* Make room for NBYTES bytes of text at point, and return the address
+   at which to store them.  Usually this moves the gap to point.  Call
+   finish_insert_at_point once the text is there.  */
+
+static unsigned char *
+make_room_at_point (ptrdiff_t nbytes)
+{
+  if (end_edit_p (PT_BYTE))
+    {
+      ptrdiff_t slack = current_buffer->text->end_slack;
+      unsigned char *addr;
+
+      if (slack < nbytes)
+	{
+	  ptrdiff_t current_size = Z_BYTE - BEG_BYTE + GAP_SIZE + slack;
+	  ptrdiff_t added;
+
+	  if (BUF_BYTES_MAX - current_size < nbytes)
+	    buffer_overflow ();
+	  /* Like make_gap, get enough to last a while.  */
+	  added = min (max (nbytes, (Z_BYTE - BEG_BYTE) / 64) + GAP_BYTES_DFL,
+		       BUF_BYTES_MAX - current_size);
+	  enlarge_buffer_text (current_buffer, added);
+	  current_buffer->text->end_slack += added;
+	}
+
+      BUF_COMPUTE_UNCHANGED (current_buffer, PT, PT);
+      addr = PT_ADDR;
+      /* Move the anchor too.  */
+      memmove (addr + nbytes, addr, Z_BYTE - PT_BYTE + 1);
+      current_buffer->text->end_slack -= nbytes;
+      return addr;
+    }
+
+  if (PT != GPT)
+    move_gap_both (PT, PT_BYTE);
+  if (GAP_SIZE < nbytes)
+    make_gap (nbytes - GAP_SIZE);
+  return GPT_ADDR;
+}
+
+/* Account for NCHARS chars (NBYTES bytes) stored at the address that
+   make_room_at_point returned.  Point is not changed.  */
+
+static void
+finish_insert_at_point (ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  /* If the text was not stored in the gap, it shifted the text after
+     point instead.  */
+  if (PT == GPT)
+    {
+      GAP_SIZE -= nbytes;
+      GPT += nchars;
+      GPT_BYTE += nbytes;
+    }
+  ZV += nchars;
+  Z += nchars;
+  ZV_BYTE += nbytes;
+  Z_BYTE += nbytes;
+  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
+
+  eassert (GPT <= GPT_BYTE);
+
+  /* The insert may have been in the unchanged region, so check again.  */
+  if (Z - (PT + nchars) < END_UNCHANGED)
+    END_UNCHANGED = Z - (PT + nchars);
+}
+
 /* Copy NBYTES bytes of text from FROM_ADDR to TO_ADDR.
    FROM_MULTIBYTE says whether the incoming text is multibyte.
    TO_MULTIBYTE says whether to store the text as multibyte.
@@ -894,10 +999,7 @@ insert_1_both (const char *string,
        or make it smaller.  */
     prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < nbytes)
-    make_gap (nbytes - GAP_SIZE);
+  unsigned char *addr = make_room_at_point (nbytes);
 
 #ifdef BYTE_COMBINING_DEBUG
   if (count_combining_before (string, nbytes, PT, PT_BYTE)
@@ -912,22 +1014,9 @@ insert_1_both (const char *string,
   modiff_incr (&MODIFF);
   CHARS_MODIFF = MODIFF;
 
-  memcpy (GPT_ADDR, string, nbytes);
+  memcpy (addr, string, nbytes);
 
-  GAP_SIZE -= nbytes;
-  GPT += nchars;
-  ZV += nchars;
-  Z += nchars;
-  GPT_BYTE += nbytes;
-  ZV_BYTE += nbytes;
-  Z_BYTE += nbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
-
-  /* The insert may have been in the unchanged region, so check again.  */
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
+  finish_insert_at_point (nchars, nbytes);
 
   adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE,
@@ -1014,25 +1103,22 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
-    move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < outgoing_nbytes)
-    make_gap (outgoing_nbytes - GAP_SIZE);
+  unsigned char *addr = make_room_at_point (outgoing_nbytes);
 
   /* Copy the string text into the buffer, perhaps converting
      between single-byte and multibyte.  */
-  copy_text (SDATA (string) + pos_byte, GPT_ADDR, nbytes,
+  copy_text (SDATA (string) + pos_byte, addr, nbytes,
 	     STRING_MULTIBYTE (string),
 	     ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
 
 #ifdef BYTE_COMBINING_DEBUG
-  /* We have copied text into the gap, but we have not altered
+  /* We have copied text into the buffer, but we have not altered
      PT or PT_BYTE yet.  So we can pass PT and PT_BYTE
      to these functions and get the same results as we would
-     have got earlier on.  Meanwhile, PT_ADDR does point to
+     have got earlier on.  Meanwhile, ADDR does point to
      the text that has been stored by copy_text.  */
-  if (count_combining_before (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE)
-      || count_combining_after (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE))
+  if (count_combining_before (addr, outgoing_nbytes, PT, PT_BYTE)
+      || count_combining_after (addr, outgoing_nbytes, PT, PT_BYTE))
     emacs_abort ();
 #endif
 
@@ -1040,20 +1126,7 @@ insert_from_string_1 (Lisp_Object string, ptrdiff_t pos, ptrdiff_t pos_byte,
   modiff_incr (&MODIFF);
   CHARS_MODIFF = MODIFF;
 
-  GAP_SIZE -= outgoing_nbytes;
-  GPT += nchars;
-  ZV += nchars;
-  Z += nchars;
-  GPT_BYTE += outgoing_nbytes;
-  ZV_BYTE += outgoing_nbytes;
-  Z_BYTE += outgoing_nbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
-
-  /* The insert may have been in the unchanged region, so check again.  */
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
+  finish_insert_at_point (nchars, outgoing_nbytes);
 
   adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE, PT + nchars,
@@ -1211,10 +1284,11 @@ insert_from_buffer_1 (struct buffer *buf,
      or make it smaller.  */
   prepare_to_modify_buffer (PT, PT, NULL);
 
-  if (PT != GPT)
+  /* Text copied from this very buffer must stay where BUF's gap says
+     it is, so only the gap can make room for it.  */
+  if (buf->text == current_buffer->text && PT != GPT)
     move_gap_both (PT, PT_BYTE);
-  if (GAP_SIZE < outgoing_nbytes)
-    make_gap (outgoing_nbytes - GAP_SIZE);
+  unsigned char *addr = make_room_at_point (outgoing_nbytes);
 
   if (from < BUF_GPT (buf))
     {
@@ -1225,7 +1299,7 @@ insert_from_buffer_1 (struct buffer *buf,
 	 to put the output from the second copy_text.  */
       chunk_expanded
 	= copy_text (BUF_BYTE_ADDRESS (buf, from_byte),
-		     GPT_ADDR, chunk,
+		     addr, chunk,
 		     ! NILP (BVAR (buf, enable_multibyte_characters)),
 		     ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
     }
@@ -1234,18 +1308,18 @@ insert_from_buffer_1 (struct buffer *buf,
 
   if (chunk < incoming_nbytes)
     copy_text (BUF_BYTE_ADDRESS (buf, from_byte + chunk),
-	       GPT_ADDR + chunk_expanded, incoming_nbytes - chunk,
+	       addr + chunk_expanded, incoming_nbytes - chunk,
 	       ! NILP (BVAR (buf, enable_multibyte_characters)),
 	       ! NILP (BVAR (current_buffer, enable_multibyte_characters)));
 
 #ifdef BYTE_COMBINING_DEBUG
-  /* We have copied text into the gap, but we have not altered
+  /* We have copied text into the buffer, but we have not altered
      PT or PT_BYTE yet.  So we can pass PT and PT_BYTE
      to these functions and get the same results as we would
-     have got earlier on.  Meanwhile, GPT_ADDR does point to
+     have got earlier on.  Meanwhile, ADDR does point to
      the text that has been stored by copy_text.  */
-  if (count_combining_before (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE)
-      || count_combining_after (GPT_ADDR, outgoing_nbytes, PT, PT_BYTE))
+  if (count_combining_before (addr, outgoing_nbytes, PT, PT_BYTE)
+      || count_combining_after (addr, outgoing_nbytes, PT, PT_BYTE))
     emacs_abort ();
 #endif
 
@@ -1253,20 +1327,7 @@ insert_from_buffer_1 (struct buffer *buf,
   modiff_incr (&MODIFF);
   CHARS_MODIFF = MODIFF;
 
-  GAP_SIZE -= outgoing_nbytes;
-  GPT += nchars;
-  ZV += nchars;
-  Z += nchars;
-  GPT_BYTE += outgoing_nbytes;
-  ZV_BYTE += outgoing_nbytes;
-  Z_BYTE += outgoing_nbytes;
-  if (GAP_SIZE > 0) *(GPT_ADDR) = 0; /* Put an anchor.  */
-
-  eassert (GPT <= GPT_BYTE);
-
-  /* The insert may have been in the unchanged region, so check again.  */
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
+  finish_insert_at_point (nchars, outgoing_nbytes);
 
   adjust_overlays_for_insert (PT, nchars);
   adjust_markers_for_insert (PT, PT_BYTE, PT + nchars,
@@ -1821,17 +1882,25 @@ del_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 {
   ptrdiff_t nbytes_del, nchars_del;
   Lisp_Object deletion;
+  bool at_end;
 
   check_markers ();
 
   nchars_del = to - from;
   nbytes_del = to_byte - from_byte;
 
-  /* Make sure the gap is somewhere in or next to what we are deleting.  */
-  if (from > GPT)
-    gap_right (from, from_byte);
-  if (to < GPT)
-    gap_left (to, to_byte, 0);
+  /* Make sure the gap is somewhere in or next to what we are deleting,
+     unless we will close up the text after it instead.  */
+  at_end = end_edit_p (from_byte);
+  if (at_end)
+    BUF_COMPUTE_UNCHANGED (current_buffer, from, to);
+  else
+    {
+      if (from > GPT)
+	gap_right (from, from_byte);
+      if (to < GPT)
+	gap_left (to, to_byte, 0);
+    }
 
 #ifdef BYTE_COMBINING_DEBUG
   if (count_combining_before (BUF_BYTE_ADDRESS (current_buffer, to_byte),
@@ -1866,13 +1935,23 @@ del_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
      adjusting the markers that bound the overlays.  */
   adjust_overlays_for_delete (from, nchars_del);
 
-  GAP_SIZE += nbytes_del;
+  if (at_end)
+    {
+      /* Move the anchor too.  */
+      memmove (BYTE_POS_ADDR (from_byte), BYTE_POS_ADDR (to_byte),
+	       Z_BYTE - to_byte + 1);
+      current_buffer->text->end_slack += nbytes_del;
+    }
+  else
+    {
+      GAP_SIZE += nbytes_del;
+      GPT = from;
+      GPT_BYTE = from_byte;
+    }
   ZV_BYTE -= nbytes_del;
   Z_BYTE -= nbytes_del;
   ZV -= nchars_del;
   Z -= nchars_del;
-  GPT = from;
-  GPT_BYTE = from_byte;
   if (GAP_SIZE > 0 && !current_buffer->text->inhibit_shrinking)
     /* Put an anchor, unless called from decode_coding_object which
        needs to access the previous gap contents.  */
@@ -1880,10 +1959,10 @@ del_range_2 (ptrdiff_t from, ptrdiff_t from_byte,
 
   eassert (GPT <= GPT_BYTE);
 
-  if (GPT - BEG < BEG_UNCHANGED)
-    BEG_UNCHANGED = GPT - BEG;
-  if (Z - GPT < END_UNCHANGED)
-    END_UNCHANGED = Z - GPT;
+  if (from - BEG < BEG_UNCHANGED)
+    BEG_UNCHANGED = from - BEG;
+  if (Z - from < END_UNCHANGED)
+    END_UNCHANGED = Z - from;
 
   check_markers ();
 
@@ -1950,14 +2029,6 @@ prepare_to_modify_buffer_1 (ptrdiff_t start, ptrdiff_t end,
   if (!NILP (BVAR (current_buffer, read_only)))
     Fbarf_if_buffer_read_only (temp);
 
-  /* If we're about to modify a buffer the contents of which come from
-     a dump file, copy the contents to private storage first so we
-     don't take a COW fault on the buffer text and keep it around
-     forever.  */
-  if (pdumper_object_p (BEG_ADDR))
-    enlarge_buffer_text (current_buffer, 0);
-  eassert (!pdumper_object_p (BEG_ADDR));
-
   run_undoable_change();
 
   bset_redisplay (current_buffer);
@@ -2014,7 +2085,22 @@ prepare_to_modify_buffer_1 (ptrdiff_t start, ptrdiff_t end,
 prepare_to_modify_buffer (ptrdiff_t start, ptrdiff_t end,
 			  ptrdiff_t *preserve_ptr)
 {
+  /* Don't change text mapped from a file that has been changed since
+     without saying so first.  */
+  report_changed_mapped_text (current_buffer);
+
   prepare_to_modify_buffer_1 (start, end, preserve_ptr);
+
+  /* If we're about to modify a buffer the contents of which come from
+     a dump file, copy the contents to private storage first so we
+     don't take a COW fault on the buffer text and keep it around
+     forever.  Likewise for text mapped from a file, which should not
+     change along with the file once the user has edited it.  Changes
+     to text properties alone don't get here, and don't need a copy.  */
+  if (pdumper_object_p (BEG_ADDR) || current_buffer->text->mapped)
+    enlarge_buffer_text (current_buffer, 0);
+  eassert (!pdumper_object_p (BEG_ADDR) && !current_buffer->text->mapped);
+
   invalidate_buffer_caches (current_buffer, start, end);
 }
 
@@ -19,204 +19,27 @@ Copyright (C) 2017-2021 Free Software Foundation, Inc.
 
 #include <config.h>
 
-#include <errno.h>
+#include <math.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 
-#include <jansson.h>
+#include <ftoastr.h>
 
 #include "lisp.h"
 #include "buffer.h"
+#include "character.h"
 #include "coding.h"
 
-#define JSON_HAS_ERROR_CODE (JANSSON_VERSION_HEX >= 0x020B00)
-
-#ifdef WINDOWSNT
-# include <windows.h>
-# include "w32common.h"
-# include "w32.h"
-
-DEF_DLL_FN (void, json_set_alloc_funcs,
-	    (json_malloc_t malloc_fn, json_free_t free_fn));
-DEF_DLL_FN (void, json_delete, (json_t *json));
-DEF_DLL_FN (json_t *, json_array, (void));
-DEF_DLL_FN (int, json_array_append_new, (json_t *array, json_t *value));
-DEF_DLL_FN (size_t, json_array_size, (const json_t *array));
-DEF_DLL_FN (json_t *, json_object, (void));
-DEF_DLL_FN (int, json_object_set_new,
-	    (json_t *object, const char *key, json_t *value));
-DEF_DLL_FN (json_t *, json_null, (void));
-DEF_DLL_FN (json_t *, json_true, (void));
-DEF_DLL_FN (json_t *, json_false, (void));
-DEF_DLL_FN (json_t *, json_integer, (json_int_t value));
-DEF_DLL_FN (json_t *, json_real, (double value));
-DEF_DLL_FN (json_t *, json_stringn, (const char *value, size_t len));
-DEF_DLL_FN (char *, json_dumps, (const json_t *json, size_t flags));
-DEF_DLL_FN (int, json_dump_callback,
-	    (const json_t *json, json_dump_callback_t callback, void *data,
-	     size_t flags));
-DEF_DLL_FN (json_int_t, json_integer_value, (const json_t *integer));
-DEF_DLL_FN (double, json_real_value, (const json_t *real));
-DEF_DLL_FN (const char *, json_string_value, (const json_t *string));
-DEF_DLL_FN (size_t, json_string_length, (const json_t *string));
-DEF_DLL_FN (json_t *, json_array_get, (const json_t *array, size_t index));
-DEF_DLL_FN (json_t *, json_object_get, (const json_t *object, const char *key));
-DEF_DLL_FN (size_t, json_object_size, (const json_t *object));
-DEF_DLL_FN (const char *, json_object_iter_key, (void *iter));
-DEF_DLL_FN (void *, json_object_iter, (json_t *object));
-DEF_DLL_FN (json_t *, json_object_iter_value, (void *iter));
-DEF_DLL_FN (void *, json_object_key_to_iter, (const char *key));
-DEF_DLL_FN (void *, json_object_iter_next, (json_t *object, void *iter));
-DEF_DLL_FN (json_t *, json_loads,
-	    (const char *input, size_t flags, json_error_t *error));
-DEF_DLL_FN (json_t *, json_load_callback,
-	    (json_load_callback_t callback, void *data, size_t flags,
-	     json_error_t *error));
-
-/* This is called by json_decref, which is an inline function.  */
-void json_delete(json_t *json)
-{
-  fn_json_delete (json);
-}
-
-static bool json_initialized;
-
-static bool
-init_json_functions (void)
-{
-  HMODULE library = w32_delayed_load (Qjson);
-
-  if (!library)
-    return false;
-
-  LOAD_DLL_FN (library, json_set_alloc_funcs);
-  LOAD_DLL_FN (library, json_delete);
-  LOAD_DLL_FN (library, json_array);
-  LOAD_DLL_FN (library, json_array_append_new);
-  LOAD_DLL_FN (library, json_array_size);
-  LOAD_DLL_FN (library, json_object);
-  LOAD_DLL_FN (library, json_object_set_new);
-  LOAD_DLL_FN (library, json_null);
-  LOAD_DLL_FN (library, json_true);
-  LOAD_DLL_FN (library, json_false);
-  LOAD_DLL_FN (library, json_integer);
-  LOAD_DLL_FN (library, json_real);
-  LOAD_DLL_FN (library, json_stringn);
-  LOAD_DLL_FN (library, json_dumps);
-  LOAD_DLL_FN (library, json_dump_callback);
-  LOAD_DLL_FN (library, json_integer_value);
-  LOAD_DLL_FN (library, json_real_value);
-  LOAD_DLL_FN (library, json_string_value);
-  LOAD_DLL_FN (library, json_string_length);
-  LOAD_DLL_FN (library, json_array_get);
-  LOAD_DLL_FN (library, json_object_get);
-  LOAD_DLL_FN (library, json_object_size);
-  LOAD_DLL_FN (library, json_object_iter_key);
-  LOAD_DLL_FN (library, json_object_iter);
-  LOAD_DLL_FN (library, json_object_iter_value);
-  LOAD_DLL_FN (library, json_object_key_to_iter);
-  LOAD_DLL_FN (library, json_object_iter_next);
-  LOAD_DLL_FN (library, json_loads);
-  LOAD_DLL_FN (library, json_load_callback);
-
-  init_json ();
-
-  return true;
-}
-
-#define json_set_alloc_funcs fn_json_set_alloc_funcs
-#define json_array fn_json_array
-#define json_array_append_new fn_json_array_append_new
-#define json_array_size fn_json_array_size
-#define json_object fn_json_object
-#define json_object_set_new fn_json_object_set_new
-#define json_null fn_json_null
-#define json_true fn_json_true
-#define json_false fn_json_false
-#define json_integer fn_json_integer
-#define json_real fn_json_real
-#define json_stringn fn_json_stringn
-#define json_dumps fn_json_dumps
-#define json_dump_callback fn_json_dump_callback
-#define json_integer_value fn_json_integer_value
-#define json_real_value fn_json_real_value
-#define json_string_value fn_json_string_value
-#define json_string_length fn_json_string_length
-#define json_array_get fn_json_array_get
-#define json_object_get fn_json_object_get
-#define json_object_size fn_json_object_size
-#define json_object_iter_key fn_json_object_iter_key
-#define json_object_iter fn_json_object_iter
-#define json_object_iter_value fn_json_object_iter_value
-#define json_object_key_to_iter fn_json_object_key_to_iter
-#define json_object_iter_next fn_json_object_iter_next
-#define json_loads fn_json_loads
-#define json_load_callback fn_json_load_callback
-
-#endif	/* WINDOWSNT */
-
-/* We install a custom allocator so that we can avoid objects larger
-   than PTRDIFF_MAX.  Such objects wouldn't play well with the rest of
-   Emacs's codebase, which generally uses ptrdiff_t for sizes and
-   indices.  The other functions in this file also generally assume
-   that size_t values never exceed PTRDIFF_MAX.
-
-   In addition, we need to use a custom allocator because on
-   MS-Windows we replace malloc/free with our own functions, see
-   w32heap.c, so we must force the library to use our allocator, or
-   else we won't be able to free storage allocated by the library.  */
-
-static void *
-json_malloc (size_t size)
-{
-  if (size > PTRDIFF_MAX)
-    {
-      errno = ENOMEM;
-      return NULL;
-    }
-  return malloc (size);
-}
-
-static void
-json_free (void *ptr)
-{
-  free (ptr);
-}
-
-void
-init_json (void)
-{
-  json_set_alloc_funcs (json_malloc, json_free);
-}
-
-#if !JSON_HAS_ERROR_CODE
-
-/* Return whether STRING starts with PREFIX.  */
-
-static bool
-json_has_prefix (const char *string, const char *prefix)
-{
-  return strncmp (string, prefix, strlen (prefix)) == 0;
-}
-
-/* Return whether STRING ends with SUFFIX.  */
-
-static bool
-json_has_suffix (const char *string, const char *suffix)
-{
-  size_t string_len = strlen (string);
-  size_t suffix_len = strlen (suffix);
-  return string_len >= suffix_len
-    && memcmp (string + string_len - suffix_len, suffix, suffix_len) == 0;
-}
-
-#endif
-
-/* Note that all callers of make_string_from_utf8 and build_string_from_utf8
-   below either pass only value UTF-8 strings or use the functionf for
-   formatting error messages; in the latter case correctness isn't
-   critical.  */
+/* Both the parser and the serializer work directly on bytes: the
+   parser builds Lisp objects as it reads its input, and the
+   serializer appends to a single output buffer.  Neither calls Lisp
+   code or maybe_quit, so no garbage collection can happen while they
+   run; the parser relies on this, because it keeps the elements of
+   arrays and objects that are being parsed, and the object keys it
+   has made, in memory that the garbage collector does not know
+   about.  */
 
 /* Return a unibyte string containing the sequence of UTF-8 encoding
    units of the UTF-8 representation of STRING.  If STRING does not
@@ -231,53 +54,6 @@ json_encode (Lisp_Object string)
   return encode_string_utf_8 (string, Qnil, false, Qt, Qt);
 }
 
-static AVOID
-json_out_of_memory (void)
-{
-  xsignal0 (Qjson_out_of_memory);
-}
-
-/* Signal a Lisp error corresponding to the JSON ERROR.  */
-
-static AVOID
-json_parse_error (const json_error_t *error)
-{
-  Lisp_Object symbol;
-#if JSON_HAS_ERROR_CODE
-  switch (json_error_code (error))
-    {
-    case json_error_premature_end_of_input:
-      symbol = Qjson_end_of_file;
-      break;
-    case json_error_end_of_input_expected:
-      symbol = Qjson_trailing_content;
-      break;
-    default:
-      symbol = Qjson_parse_error;
-      break;
-    }
-#else
-  if (json_has_suffix (error->text, "expected near end of file"))
-    symbol = Qjson_end_of_file;
-  else if (json_has_prefix (error->text, "end of file expected"))
-    symbol = Qjson_trailing_content;
-  else
-    symbol = Qjson_parse_error;
-#endif
-  xsignal (symbol,
-           list5 (build_string_from_utf8 (error->text),
-                  build_string_from_utf8 (error->source),
-		  INT_TO_INTEGER (error->line),
-                  INT_TO_INTEGER (error->column),
-		  INT_TO_INTEGER (error->position)));
-}
-
-static void
-json_release_object (void *object)
-{
-  json_decref (object);
-}
-
 /* Signal an error if OBJECT is not a string, or if OBJECT contains
    embedded null characters.  */
 
@@ -289,24 +65,61 @@ check_string_without_embedded_nulls (Lisp_Object object)
               Qstring_without_embedded_nulls_p, object);
 }
 
-/* Signal an error of type `json-out-of-memory' if OBJECT is
-   NULL.  */
+/* Strings are scanned a word at a time where possible.  A word is
+   "plain" if none of its bytes is a control character, a double
+   quote, a backslash or a non-ASCII byte, so that it can be copied
+   as is.  */
+
+typedef uint64_t json_word;
+#define JSON_WORD_ONES ((json_word) -1 / 0xff)
+
+static json_word
+json_load_word (const unsigned char *p)
+{
+  json_word w;
+  memcpy (&w, p, sizeof w);
+  return w;
+}
 
-static json_t *
-json_check (json_t *object)
+static bool
+json_word_plain_p (json_word w)
 {
-  if (object == NULL)
-    json_out_of_memory ();
-  return object;
+  /* Subtracting 1 from a byte sets its high bit only if the byte was
+     zero, and subtracting 0x20 does so only if it was below 0x20, as
+     long as no byte has its high bit set already; and in that case
+     the word is not plain anyway.  */
+  json_word quote = w ^ (JSON_WORD_ONES * '"');
+  json_word backslash = w ^ (JSON_WORD_ONES * '\\');
+  return !((w | (w - JSON_WORD_ONES * 0x20)
+	    | (quote - JSON_WORD_ONES) | (backslash - JSON_WORD_ONES))
+	   & (JSON_WORD_ONES * 0x80));
 }
 
-/* If STRING is not a valid UTF-8 string, signal an error of type
-   `wrong-type-argument'.  STRING must be a unibyte string.  */
+/* Return the length of the UTF-8 sequence for a single Unicode
+   scalar value at P, which is followed by at least AVAIL - 1 more
+   bytes.  Return 0 if there is no valid sequence: overlong forms,
+   surrogates and values beyond U+10FFFF are invalid.  P[0] must not
+   be an ASCII byte.  */
 
-static void
-json_check_utf8 (Lisp_Object string)
+static int
+json_utf8_length (const unsigned char *p, ptrdiff_t avail)
 {
-  CHECK_TYPE (utf8_string_p (string), Qutf_8_string_p, string);
+  unsigned char c = p[0];
+  if (c < 0xc2 || 0xf4 < c)
+    return 0;
+  if (c < 0xe0)
+    return 2 <= avail && (p[1] & 0xc0) == 0x80 ? 2 : 0;
+  if (c < 0xf0)
+    {
+      unsigned char lo = c == 0xe0 ? 0xa0 : 0x80;
+      unsigned char hi = c == 0xed ? 0x9f : 0xbf;
+      return (3 <= avail && lo <= p[1] && p[1] <= hi
+	      && (p[2] & 0xc0) == 0x80) ? 3 : 0;
+    }
+  unsigned char lo = c == 0xf0 ? 0x90 : 0x80;
+  unsigned char hi = c == 0xf4 ? 0x8f : 0xbf;
+  return (4 <= avail && lo <= p[1] && p[1] <= hi
+	  && (p[2] & 0xc0) == 0x80 && (p[3] & 0xc0) == 0x80) ? 4 : 0;
 }
 
 enum json_object_type {
@@ -327,179 +140,413 @@ json_check_utf8 (Lisp_Object string)
   Lisp_Object false_object;
 };
 
-static json_t *lisp_to_json (Lisp_Object, struct json_configuration *conf);
+/* State of a serialization.  The output is UTF-8 text in BUF.  */
+
+struct json_out
+{
+  char *buf;
+  ptrdiff_t size;
+  ptrdiff_t capacity;
+
+  /* Number of UTF-8 continuation bytes in BUF, so that BUF holds
+     SIZE - CONTINUATION_BYTES characters.  */
+  ptrdiff_t continuation_bytes;
+
+  struct json_configuration conf;
+
+  /* Keys of the alists and plists being serialized, used to skip
+     duplicate keys.  Each object uses the elements from the index
+     where it started to KEYS_SIZE.  */
+  Lisp_Object *keys;
+  ptrdiff_t keys_size;
+  ptrdiff_t keys_capacity;
+};
+
+/* Objects with more keys than this use a hash table to find
+   duplicate keys instead of searching linearly, both when
+   serializing and when parsing.  */
+enum { JSON_SMALL_OBJECT = 16 };
+
+static void
+json_out_done (void *data)
+{
+  struct json_out *jo = data;
+  xfree (jo->buf);
+  xfree (jo->keys);
+}
+
+/* Make room for at least BYTES more bytes of output.  */
+
+static void
+json_out_reserve (struct json_out *jo, ptrdiff_t bytes)
+{
+  if (jo->capacity - jo->size < bytes)
+    jo->buf = xpalloc (jo->buf, &jo->capacity,
+		       bytes - (jo->capacity - jo->size), -1, 1);
+}
 
-/* Convert a Lisp object to a toplevel JSON object (array or object).  */
+static void
+json_out_byte (struct json_out *jo, unsigned char c)
+{
+  json_out_reserve (jo, 1);
+  jo->buf[jo->size++] = c;
+}
 
-static json_t *
-lisp_to_json_toplevel_1 (Lisp_Object lisp,
-                         struct json_configuration *conf)
+static void
+json_out_ascii (struct json_out *jo, const char *s, ptrdiff_t len)
 {
-  json_t *json;
-  ptrdiff_t count;
+  json_out_reserve (jo, len);
+  memcpy (jo->buf + jo->size, s, len);
+  jo->size += len;
+}
+
+/* Append a JSON string containing the NBYTES bytes at P.  Return
+   false and leave the output unchanged if the bytes are not valid
+   UTF-8.  */
 
-  if (VECTORP (lisp))
+static bool
+json_out_string_bytes (struct json_out *jo, const unsigned char *p,
+		       ptrdiff_t nbytes)
+{
+  static char const hexdigit[] = "0123456789ABCDEF";
+  ptrdiff_t size = jo->size;
+  ptrdiff_t continuation_bytes = jo->continuation_bytes;
+  const unsigned char *end = p + nbytes;
+
+  /* There is always room for the rest of the input copied verbatim
+     and the closing quote; escapes make more room as needed.  */
+  json_out_reserve (jo, nbytes + 2);
+  jo->buf[jo->size++] = '"';
+  while (p < end)
     {
-      ptrdiff_t size = ASIZE (lisp);
-      json = json_check (json_array ());
-      count = SPECPDL_INDEX ();
-      record_unwind_protect_ptr (json_release_object, json);
-      for (ptrdiff_t i = 0; i < size; ++i)
-        {
-          int status
-            = json_array_append_new (json, lisp_to_json (AREF (lisp, i),
-                                                         conf));
-          if (status == -1)
-            json_out_of_memory ();
-        }
-      eassert (json_array_size (json) == size);
+      while (end - p >= sizeof (json_word)
+	     && json_word_plain_p (json_load_word (p)))
+	{
+	  memcpy (jo->buf + jo->size, p, sizeof (json_word));
+	  jo->size += sizeof (json_word);
+	  p += sizeof (json_word);
+	}
+      if (p == end)
+	break;
+
+      unsigned char c = *p;
+      if (c >= 0x80)
+	{
+	  int len = json_utf8_length (p, end - p);
+	  if (!len)
+	    {
+	      jo->size = size;
+	      jo->continuation_bytes = continuation_bytes;
+	      return false;
+	    }
+	  memcpy (jo->buf + jo->size, p, len);
+	  jo->size += len;
+	  jo->continuation_bytes += len - 1;
+	  p += len;
+	}
+      else if (c < 0x20 || c == '"' || c == '\\')
+	{
+	  json_out_reserve (jo, (end - p) + 6 + 1);
+	  char *q = jo->buf + jo->size;
+	  *q++ = '\\';
+	  switch (c)
+	    {
+	    case '"': case '\\': *q++ = c; break;
+	    case '\b': *q++ = 'b'; break;
+	    case '\f': *q++ = 'f'; break;
+	    case '\n': *q++ = 'n'; break;
+	    case '\r': *q++ = 'r'; break;
+	    case '\t': *q++ = 't'; break;
+	    default:
+	      *q++ = 'u';
+	      *q++ = '0';
+	      *q++ = '0';
+	      *q++ = hexdigit[c >> 4];
+	      *q++ = hexdigit[c & 0xf];
+	      break;
+	    }
+	  jo->size = q - jo->buf;
+	  p++;
+	}
+      else
+	jo->buf[jo->size++] = *p++;
     }
-  else if (HASH_TABLE_P (lisp))
+  jo->buf[jo->size++] = '"';
+  return true;
+}
+
+/* Append STRING as a JSON string.  Signal an error of type
+   `wrong-type-argument' if it doesn't represent a sequence of
+   Unicode scalar values.  */
+
+static void
+json_out_string (struct json_out *jo, Lisp_Object string)
+{
+  /* The internal representation of multibyte text is UTF-8 unless it
+     contains raw bytes or characters beyond Unicode, so most strings
+     can be copied directly.  */
+  if (!json_out_string_bytes (jo, SDATA (string), SBYTES (string)))
     {
-      struct Lisp_Hash_Table *h = XHASH_TABLE (lisp);
-      json = json_check (json_object ());
-      count = SPECPDL_INDEX ();
-      record_unwind_protect_ptr (json_release_object, json);
-      for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); ++i)
-        {
-          Lisp_Object key = HASH_KEY (h, i);
-          if (!EQ (key, Qunbound))
-            {
-              CHECK_STRING (key);
-              Lisp_Object ekey = json_encode (key);
-              /* We can't specify the length, so the string must be
-		 null-terminated.  */
-              check_string_without_embedded_nulls (ekey);
-              const char *key_str = SSDATA (ekey);
-              /* Reject duplicate keys.  These are possible if the hash
-		 table test is not `equal'.  */
-              if (json_object_get (json, key_str) != NULL)
-                wrong_type_argument (Qjson_value_p, lisp);
-              int status
-                = json_object_set_new (json, key_str,
-                                       lisp_to_json (HASH_VALUE (h, i), conf));
-              if (status == -1)
-                {
-                  /* A failure can be caused either by an invalid key or
-                   by low memory.  */
-                  json_check_utf8 (ekey);
-                  json_out_of_memory ();
-                }
-            }
-        }
+      Lisp_Object encoded = json_encode (string);
+      if (!json_out_string_bytes (jo, SDATA (encoded), SBYTES (encoded)))
+	wrong_type_argument (Qutf_8_string_p, encoded);
     }
-  else if (NILP (lisp))
-    return json_check (json_object ());
-  else if (CONSP (lisp))
+}
+
+static void
+json_out_integer (struct json_out *jo, Lisp_Object n)
+{
+  if (FIXNUMP (n))
     {
-      Lisp_Object tail = lisp;
-      json = json_check (json_object ());
-      count = SPECPDL_INDEX ();
-      record_unwind_protect_ptr (json_release_object, json);
-      bool is_plist = !CONSP (XCAR (tail));
-      FOR_EACH_TAIL (tail)
-        {
-          const char *key_str;
-          Lisp_Object value;
-          Lisp_Object key_symbol;
-          if (is_plist)
-            {
-              key_symbol = XCAR (tail);
-              tail = XCDR (tail);
-              CHECK_CONS (tail);
-              value = XCAR (tail);
-            }
-          else
-            {
-              Lisp_Object pair = XCAR (tail);
-              CHECK_CONS (pair);
-              key_symbol = XCAR (pair);
-              value = XCDR (pair);
-            }
-          CHECK_SYMBOL (key_symbol);
-          Lisp_Object key = SYMBOL_NAME (key_symbol);
-          /* We can't specify the length, so the string must be
-             null-terminated.  */
-          check_string_without_embedded_nulls (key);
-          key_str = SSDATA (key);
-          /* In plists, ensure leading ":" in keys is stripped.  It
-             will be reconstructed later in `json_to_lisp'.*/
-          if (is_plist && ':' == key_str[0] && key_str[1])
-            {
-              key_str = &key_str[1];
-            }
-          /* Only add element if key is not already present.  */
-          if (json_object_get (json, key_str) == NULL)
-            {
-              int status
-                = json_object_set_new (json, key_str, lisp_to_json (value,
-                                                                    conf));
-              if (status == -1)
-                json_out_of_memory ();
-            }
-        }
-      CHECK_LIST_END (tail, lisp);
+      char buf[INT_BUFSIZE_BOUND (EMACS_INT)];
+      json_out_ascii (jo, buf, sprintf (buf, "%"pI"d", XFIXNUM (n)));
     }
   else
-    wrong_type_argument (Qjson_value_p, lisp);
+    {
+      ptrdiff_t size = bignum_bufsize (n, 10);
+      json_out_reserve (jo, size);
+      jo->size += bignum_to_c_string (jo->buf + jo->size, size, n, 10);
+    }
+}
+
+static void
+json_out_float (struct json_out *jo, Lisp_Object f)
+{
+  double x = XFLOAT_DATA (f);
+  if (!isfinite (x))
+    wrong_type_argument (Qjson_value_p, f);
+  char buf[DBL_BUFSIZE_BOUND + 2];
+  int len = dtoastr (buf, sizeof buf - 2, 0, 0, x);
+  /* Make the number read back as a float.  */
+  if (!strpbrk (buf, ".e"))
+    {
+      strcpy (buf + len, ".0");
+      len += 2;
+    }
+  json_out_ascii (jo, buf, len);
+}
 
-  clear_unwind_protect (count);
-  unbind_to (count, Qnil);
-  return json;
+/* Return the name of KEY, a symbol used as key in an alist or a
+   plist, as it appears in the output; set *SKIP to the number of
+   leading bytes of the name to omit.  In plists, the leading colon
+   of keywords is omitted.  */
+
+static Lisp_Object
+json_out_key_name (Lisp_Object key, bool is_plist, ptrdiff_t *skip)
+{
+  CHECK_SYMBOL (key);
+  Lisp_Object name = SYMBOL_NAME (key);
+  check_string_without_embedded_nulls (name);
+  *skip = (is_plist && SBYTES (name) > 1 && SREF (name, 0) == ':');
+  return name;
 }
 
-/* Convert LISP to a toplevel JSON object (array or object).  Signal
-   an error of type `wrong-type-argument' if LISP is not a vector,
-   hashtable, alist, or plist.  */
+/* Return true if an alist or plist key with the same output name as
+   KEY was already output in the current object, whose keys start at
+   index BASE of JO->keys.  Otherwise, remember KEY.  *SEEN is nil or
+   a hash table of the output names used by large objects.  */
 
-static json_t *
-lisp_to_json_toplevel (Lisp_Object lisp, struct json_configuration *conf)
+static bool
+json_out_key_seen_p (struct json_out *jo, ptrdiff_t base, Lisp_Object *seen,
+		     Lisp_Object key, bool is_plist)
 {
-  if (++lisp_eval_depth > max_lisp_eval_depth)
-    xsignal0 (Qjson_object_too_deep);
-  json_t *json = lisp_to_json_toplevel_1 (lisp, conf);
-  --lisp_eval_depth;
-  return json;
+  ptrdiff_t skip;
+  Lisp_Object name = json_out_key_name (key, is_plist, &skip);
+  ptrdiff_t nbytes = SBYTES (name) - skip;
+
+  if (NILP (*seen))
+    {
+      for (ptrdiff_t i = base; i < jo->keys_size; i++)
+	{
+	  if (EQ (jo->keys[i], key))
+	    return true;
+	  ptrdiff_t other_skip;
+	  Lisp_Object other = json_out_key_name (jo->keys[i], is_plist,
+						 &other_skip);
+	  if (SBYTES (other) - other_skip == nbytes
+	      && !memcmp (SDATA (other) + other_skip, SDATA (name) + skip,
+			  nbytes))
+	    return true;
+	}
+      if (jo->keys_size - base < JSON_SMALL_OBJECT)
+	{
+	  if (jo->keys_size == jo->keys_capacity)
+	    jo->keys = xpalloc (jo->keys, &jo->keys_capacity, 1, -1,
+				sizeof *jo->keys);
+	  jo->keys[jo->keys_size++] = key;
+	  return false;
+	}
+
+      /* Switch to a hash table.  */
+      *seen = make_hash_table (hashtest_equal, 2 * JSON_SMALL_OBJECT,
+			       DEFAULT_REHASH_SIZE, DEFAULT_REHASH_THRESHOLD,
+			       Qnil, false);
+      for (ptrdiff_t i = base; i < jo->keys_size; i++)
+	{
+	  ptrdiff_t other_skip;
+	  Lisp_Object other = json_out_key_name (jo->keys[i], is_plist,
+						 &other_skip);
+	  Fputhash (Fsubstring (other, make_fixnum (other_skip), Qnil), Qt,
+		    *seen);
+	}
+    }
+
+  Lisp_Object hash, string = skip ? Fsubstring (name, make_fixnum (skip), Qnil)
+				   : name;
+  struct Lisp_Hash_Table *h = XHASH_TABLE (*seen);
+  if (hash_lookup (h, string, &hash) >= 0)
+    return true;
+  hash_put (h, string, Qt, hash);
+  return false;
 }
 
-/* Convert LISP to any JSON object.  Signal an error of type
-   `wrong-type-argument' if the type of LISP can't be converted to a
-   JSON object.  */
+static void json_out_something (struct json_out *jo, Lisp_Object obj);
+
+static void
+json_out_hash_table (struct json_out *jo, Lisp_Object obj)
+{
+  struct Lisp_Hash_Table *h = XHASH_TABLE (obj);
+  /* Keys are unique under `equal' only if that is the test; for other
+     tests, look for duplicates, which are an error.  */
+  Lisp_Object seen = Qnil;
+  if (!EQ (h->test.name, Qequal))
+    seen = make_hash_table (hashtest_equal, HASH_TABLE_SIZE (h),
+			    DEFAULT_REHASH_SIZE, DEFAULT_REHASH_THRESHOLD,
+			    Qnil, false);
+  bool first = true;
+  json_out_byte (jo, '{');
+  for (ptrdiff_t i = 0; i < HASH_TABLE_SIZE (h); ++i)
+    {
+      Lisp_Object key = HASH_KEY (h, i);
+      if (EQ (key, Qunbound))
+	continue;
+      check_string_without_embedded_nulls (key);
+      if (!NILP (seen))
+	{
+	  Lisp_Object hash;
+	  struct Lisp_Hash_Table *s = XHASH_TABLE (seen);
+	  if (hash_lookup (s, key, &hash) >= 0)
+	    wrong_type_argument (Qjson_value_p, obj);
+	  hash_put (s, key, Qt, hash);
+	}
+      if (!first)
+	json_out_byte (jo, ',');
+      first = false;
+      json_out_string (jo, key);
+      json_out_byte (jo, ':');
+      json_out_something (jo, HASH_VALUE (h, i));
+    }
+  json_out_byte (jo, '}');
+}
 
-static json_t *
-lisp_to_json (Lisp_Object lisp, struct json_configuration *conf)
+static void
+json_out_alist_or_plist (struct json_out *jo, Lisp_Object obj)
 {
-  if (EQ (lisp, conf->null_object))
-    return json_check (json_null ());
-  else if (EQ (lisp, conf->false_object))
-    return json_check (json_false ());
-  else if (EQ (lisp, Qt))
-    return json_check (json_true ());
-  else if (INTEGERP (lisp))
+  ptrdiff_t base = jo->keys_size;
+  Lisp_Object seen = Qnil;
+  Lisp_Object tail = obj;
+  bool is_plist = !CONSP (XCAR (tail));
+  bool first = true;
+  json_out_byte (jo, '{');
+  FOR_EACH_TAIL (tail)
     {
-      intmax_t low = TYPE_MINIMUM (json_int_t);
-      intmax_t high = TYPE_MAXIMUM (json_int_t);
-      intmax_t value = check_integer_range (lisp, low, high);
-      return json_check (json_integer (value));
+      Lisp_Object key, value;
+      if (is_plist)
+	{
+	  key = XCAR (tail);
+	  tail = XCDR (tail);
+	  CHECK_CONS (tail);
+	  value = XCAR (tail);
+	}
+      else
+	{
+	  Lisp_Object pair = XCAR (tail);
+	  CHECK_CONS (pair);
+	  key = XCAR (pair);
+	  value = XCDR (pair);
+	}
+      /* Only output the first instance of a key.  */
+      if (json_out_key_seen_p (jo, base, &seen, key, is_plist))
+	continue;
+      if (!first)
+	json_out_byte (jo, ',');
+      first = false;
+      ptrdiff_t skip;
+      Lisp_Object name = json_out_key_name (key, is_plist, &skip);
+      if (!json_out_string_bytes (jo, SDATA (name) + skip,
+				  SBYTES (name) - skip))
+	json_out_string (jo, Fsubstring (name, make_fixnum (skip), Qnil));
+      json_out_byte (jo, ':');
+      json_out_something (jo, value);
     }
-  else if (FLOATP (lisp))
-    return json_check (json_real (XFLOAT_DATA (lisp)));
-  else if (STRINGP (lisp))
+  CHECK_LIST_END (tail, obj);
+  json_out_byte (jo, '}');
+  jo->keys_size = base;
+}
+
+/* Output LISP as a toplevel JSON value (array or object).  Signal an
+   error of type `wrong-type-argument' if LISP is not a vector,
+   hashtable, alist, or plist.  */
+
+static void
+json_out_toplevel (struct json_out *jo, Lisp_Object obj)
+{
+  if (++lisp_eval_depth > max_lisp_eval_depth)
+    xsignal0 (Qjson_object_too_deep);
+  if (VECTORP (obj))
     {
-      Lisp_Object encoded = json_encode (lisp);
-      json_t *json = json_stringn (SSDATA (encoded), SBYTES (encoded));
-      if (json == NULL)
-        {
-          /* A failure can be caused either by an invalid string or by
-             low memory.  */
-          json_check_utf8 (encoded);
-          json_out_of_memory ();
-        }
-      return json;
+      ptrdiff_t size = ASIZE (obj);
+      json_out_byte (jo, '[');
+      for (ptrdiff_t i = 0; i < size; ++i)
+	{
+	  if (i > 0)
+	    json_out_byte (jo, ',');
+	  json_out_something (jo, AREF (obj, i));
+	}
+      json_out_byte (jo, ']');
     }
+  else if (HASH_TABLE_P (obj))
+    json_out_hash_table (jo, obj);
+  else if (NILP (obj))
+    json_out_ascii (jo, "{}", 2);
+  else if (CONSP (obj))
+    json_out_alist_or_plist (jo, obj);
+  else
+    wrong_type_argument (Qjson_value_p, obj);
+  --lisp_eval_depth;
+}
+
+/* Output any Lisp object OBJ that can be represented in JSON.  */
+
+static void
+json_out_something (struct json_out *jo, Lisp_Object obj)
+{
+  if (EQ (obj, jo->conf.null_object))
+    json_out_ascii (jo, "null", 4);
+  else if (EQ (obj, jo->conf.false_object))
+    json_out_ascii (jo, "false", 5);
+  else if (EQ (obj, Qt))
+    json_out_ascii (jo, "true", 4);
+  else if (INTEGERP (obj))
+    json_out_integer (jo, obj);
+  else if (FLOATP (obj))
+    json_out_float (jo, obj);
+  else if (STRINGP (obj))
+    json_out_string (jo, obj);
+  else
+    /* OBJ now must be a vector, hashtable, alist, or plist.  */
+    json_out_toplevel (jo, obj);
+}
 
-  /* LISP now must be a vector, hashtable, alist, or plist.  */
-  return lisp_to_json_toplevel (lisp, conf);
+static void
+json_out_init (struct json_out *jo, struct json_configuration conf)
+{
+  jo->buf = NULL;
+  jo->size = jo->capacity = 0;
+  jo->continuation_bytes = 0;
+  jo->conf = conf;
+  jo->keys = NULL;
+  jo->keys_size = jo->keys_capacity = 0;
 }
 
 static void
@@ -583,363 +630,946 @@ DEFUN ("json-serialize", Fjson_serialize, Sjson_serialize, 1, MANY,
      (ptrdiff_t nargs, Lisp_Object *args)
 {
   ptrdiff_t count = SPECPDL_INDEX ();
+  struct json_configuration conf =
+    {json_object_hashtable, json_array_array, QCnull, QCfalse};
+  json_parse_args (nargs - 1, args + 1, &conf, false);
 
-#ifdef WINDOWSNT
-  if (!json_initialized)
-    {
-      Lisp_Object status;
-      json_initialized = init_json_functions ();
-      status = json_initialized ? Qt : Qnil;
-      Vlibrary_cache = Fcons (Fcons (Qjson, status), Vlibrary_cache);
-    }
-  if (!json_initialized)
-    {
-      message1 ("jansson library not found");
-      return Qnil;
-    }
-#endif
+  struct json_out jo;
+  json_out_init (&jo, conf);
+  record_unwind_protect_ptr (json_out_done, &jo);
+  json_out_toplevel (&jo, args[0]);
+
+  /* The output is valid UTF-8, which is also the internal
+     representation of its characters.  */
+  Lisp_Object result = make_specified_string (jo.buf,
+					      jo.size - jo.continuation_bytes,
+					      jo.size, true);
+  return unbind_to (count, result);
+}
 
+DEFUN ("json-insert", Fjson_insert, Sjson_insert, 1, MANY,
+       NULL,
+       doc: /* Insert the JSON representation of OBJECT before point.
+This is the same as (insert (json-serialize OBJECT)), but potentially
+faster.  See the function `json-serialize' for allowed values of
+OBJECT.
+usage: (json-insert OBJECT &rest ARGS)  */)
+     (ptrdiff_t nargs, Lisp_Object *args)
+{
+  ptrdiff_t count = SPECPDL_INDEX ();
   struct json_configuration conf =
     {json_object_hashtable, json_array_array, QCnull, QCfalse};
   json_parse_args (nargs - 1, args + 1, &conf, false);
 
-  json_t *json = lisp_to_json_toplevel (args[0], &conf);
-  record_unwind_protect_ptr (json_release_object, json);
+  struct json_out jo;
+  json_out_init (&jo, conf);
+  record_unwind_protect_ptr (json_out_done, &jo);
+  json_out_something (&jo, args[0]);
 
-  /* If desired, we might want to add the following flags:
-     JSON_DECODE_ANY, JSON_ALLOW_NUL.  */
-  char *string = json_dumps (json, JSON_COMPACT);
-  if (string == NULL)
-    json_out_of_memory ();
-  record_unwind_protect_ptr (json_free, string);
+  /* In a multibyte buffer, the UTF-8 output is already in the
+     internal representation; a unibyte buffer gets its bytes.  */
+  ptrdiff_t opoint = PT;
+  insert_1_both (jo.buf, jo.size - jo.continuation_bytes, jo.size,
+		 false, true, false);
+  signal_after_change (opoint, 0, PT - opoint);
+  update_compositions (opoint, PT, CHECK_BORDER);
 
-  return unbind_to (count, build_string_from_utf8 (string));
+  return unbind_to (count, Qnil);
 }
 
-struct json_buffer_and_size
-{
-  const char *buffer;
-  ptrdiff_t size;
-  /* This tracks how many bytes were inserted by the callback since
-     json_dump_callback was called.  */
-  ptrdiff_t inserted_bytes;
-};
+/* An entry of the key cache of a parser.  */
 
-static Lisp_Object
-json_insert (void *data)
+struct json_key
 {
-  struct json_buffer_and_size *buffer_and_size = data;
-  ptrdiff_t len = buffer_and_size->size;
-  ptrdiff_t inserted_bytes = buffer_and_size->inserted_bytes;
-  ptrdiff_t gap_size = GAP_SIZE - inserted_bytes;
+  /* The key as returned by json_parse_object_key.  */
+  Lisp_Object key;
 
-  /* Enlarge the gap if necessary.  */
-  if (gap_size < len)
-    make_gap (len - gap_size);
+  /* hash_string of the bytes of the key.  */
+  EMACS_UINT hash;
 
-  /* Copy this chunk of data into the gap.  */
-  memcpy ((char *) BEG_ADDR + PT_BYTE - BEG_BYTE + inserted_bytes,
-	  buffer_and_size->buffer, len);
-  buffer_and_size->inserted_bytes += len;
-  return Qnil;
-}
+  /* Where the bytes of the key are in the parser's KEY_BYTES, if
+     USED.  */
+  ptrdiff_t offset;
+  ptrdiff_t nbytes;
+  bool used;
+};
 
-static Lisp_Object
-json_handle_nonlocal_exit (enum nonlocal_exit type, Lisp_Object data)
-{
-  switch (type)
-    {
-    case NONLOCAL_EXIT_SIGNAL:
-      return data;
-    case NONLOCAL_EXIT_THROW:
-      return Fcons (Qno_catch, data);
-    default:
-      eassume (false);
-    }
-}
+/* Keys longer than this many bytes are not cached, and no more than
+   this many keys are cached in a parse.  Real-world JSON uses a
+   small set of short keys over and over; larger or more varied keys
+   are more likely to be data that does not repeat.  */
+enum { JSON_KEY_CACHE_MAX_BYTES = 64, JSON_KEY_CACHE_MAX = 4096 };
+
+/* State of a parse.  The input is the bytes from INPUT_BEGIN to
+   INPUT_END, followed by those from SECONDARY_INPUT_BEGIN to
+   SECONDARY_INPUT_END; the second part is only used for buffer text
+   after the gap.  */
 
-struct json_insert_data
+struct json_parser
 {
-  /* This tracks how many bytes were inserted by the callback since
-     json_dump_callback was called.  */
-  ptrdiff_t inserted_bytes;
-  /* nil if json_insert succeeded, otherwise the symbol
-     Qcatch_all_memory_full or a cons (ERROR-SYMBOL . ERROR-DATA).  */
-  Lisp_Object error;
+  const unsigned char *input_begin;
+  const unsigned char *input_end;
+  const unsigned char *secondary_input_begin;
+  const unsigned char *secondary_input_end;
+
+  /* The next byte to read, and the end of the part it is in.  */
+  const unsigned char *current;
+  const unsigned char *end;
+
+  struct json_configuration conf;
+
+  /* Name of the input for error messages.  */
+  const char *source;
+
+  /* Elements of the arrays and objects being parsed, innermost last.
+     Each array or object uses the elements from the index where it
+     started to OBJECT_WORKSPACE_CURRENT.  */
+  Lisp_Object *object_workspace;
+  ptrdiff_t object_workspace_size;
+  ptrdiff_t object_workspace_current;
+
+  /* Bytes of the string or number being parsed, when they can't be
+     used in place.  */
+  unsigned char *byte_workspace;
+  ptrdiff_t byte_workspace_size;
+  ptrdiff_t byte_workspace_current;
+
+  /* The keys of the objects parsed so far, so that each distinct key
+     is turned into a string or symbol only once in a parse and all
+     objects share it.  KEY_CACHE is an open-addressing hash table of
+     KEY_CACHE_SIZE entries, a power of 2, of which KEY_CACHE_COUNT are
+     used.  The bytes of the keys are in KEY_BYTES.  */
+  struct json_key *key_cache;
+  ptrdiff_t key_cache_size;
+  ptrdiff_t key_cache_count;
+  unsigned char *key_bytes;
+  ptrdiff_t key_bytes_size;
+  ptrdiff_t key_bytes_current;
 };
 
-/* Callback for json_dump_callback that inserts a JSON representation
-   as a unibyte string into the gap.  DATA must point to a structure
-   of type json_insert_data.  This function may not exit nonlocally.
-   It catches all nonlocal exits and stores them in data->error for
-   reraising.  */
-
-static int
-json_insert_callback (const char *buffer, size_t size, void *data)
+static void
+json_parser_init (struct json_parser *parser,
+		  struct json_configuration conf, const char *source,
+		  const unsigned char *input,
+		  const unsigned char *input_end,
+		  const unsigned char *secondary_input,
+		  const unsigned char *secondary_input_end)
 {
-  struct json_insert_data *d = data;
-  struct json_buffer_and_size buffer_and_size
-    = {.buffer = buffer, .size = size, .inserted_bytes = d->inserted_bytes};
-  d->error = internal_catch_all (json_insert, &buffer_and_size,
-                                 json_handle_nonlocal_exit);
-  d->inserted_bytes = buffer_and_size.inserted_bytes;
-  return NILP (d->error) ? 0 : -1;
+  parser->input_begin = parser->current = input;
+  parser->input_end = parser->end = input_end;
+  parser->secondary_input_begin = secondary_input;
+  parser->secondary_input_end = secondary_input_end;
+  parser->conf = conf;
+  parser->source = source;
+  parser->object_workspace = NULL;
+  parser->object_workspace_size = parser->object_workspace_current = 0;
+  parser->byte_workspace = NULL;
+  parser->byte_workspace_size = parser->byte_workspace_current = 0;
+  parser->key_cache = NULL;
+  parser->key_cache_size = parser->key_cache_count = 0;
+  parser->key_bytes = NULL;
+  parser->key_bytes_size = parser->key_bytes_current = 0;
 }
 
-DEFUN ("json-insert", Fjson_insert, Sjson_insert, 1, MANY,
-       NULL,
-       doc: /* Insert the JSON representation of OBJECT before point.
-This is the same as (insert (json-serialize OBJECT)), but potentially
-faster.  See the function `json-serialize' for allowed values of
-OBJECT.
-usage: (json-insert OBJECT &rest ARGS)  */)
-     (ptrdiff_t nargs, Lisp_Object *args)
+static void
+json_parser_done (void *data)
 {
-  ptrdiff_t count = SPECPDL_INDEX ();
+  struct json_parser *parser = data;
+  xfree (parser->object_workspace);
+  xfree (parser->byte_workspace);
+  xfree (parser->key_cache);
+  xfree (parser->key_bytes);
+}
 
-#ifdef WINDOWSNT
-  if (!json_initialized)
-    {
-      Lisp_Object status;
-      json_initialized = init_json_functions ();
-      status = json_initialized ? Qt : Qnil;
-      Vlibrary_cache = Fcons (Fcons (Qjson, status), Vlibrary_cache);
-    }
-  if (!json_initialized)
-    {
-      message1 ("jansson library not found");
-      return Qnil;
-    }
-#endif
+/* Return the number of bytes of input consumed so far.  */
 
-  struct json_configuration conf =
-    {json_object_hashtable, json_array_array, QCnull, QCfalse};
-  json_parse_args (nargs - 1, args + 1, &conf, false);
+static ptrdiff_t
+json_parser_position (struct json_parser *parser)
+{
+  if (parser->end == parser->input_end)
+    return parser->current - parser->input_begin;
+  return ((parser->input_end - parser->input_begin)
+	  + (parser->current - parser->secondary_input_begin));
+}
 
-  json_t *json = lisp_to_json (args[0], &conf);
-  record_unwind_protect_ptr (json_release_object, json);
-
-  prepare_to_modify_buffer (PT, PT, NULL);
-  move_gap_both (PT, PT_BYTE);
-  struct json_insert_data data;
-  data.inserted_bytes = 0;
-  /* If desired, we might want to add the following flags:
-     JSON_DECODE_ANY, JSON_ALLOW_NUL.  */
-  int status
-    /* Could have used json_dumpb, but that became available only in
-       Jansson 2.10, whereas we want to support 2.7 and upward.  */
-    = json_dump_callback (json, json_insert_callback, &data, JSON_COMPACT);
-  if (status == -1)
-    {
-      if (CONSP (data.error))
-        xsignal (XCAR (data.error), XCDR (data.error));
-      else
-        json_out_of_memory ();
-    }
+/* Signal an error of type ERROR with MESSAGE at the current
+   position.  The error data are the message, the name of the input,
+   and the line, column and byte position of the error.  */
 
-  ptrdiff_t inserted = 0;
-  ptrdiff_t inserted_bytes = data.inserted_bytes;
-  if (inserted_bytes > 0)
+static AVOID
+json_signal_error (struct json_parser *parser, Lisp_Object error,
+		   const char *message)
+{
+  ptrdiff_t position = json_parser_position (parser);
+  ptrdiff_t line = 1, column = 0, seen = 0;
+  const unsigned char *p = parser->input_begin;
+  const unsigned char *end = parser->input_end;
+  for (; seen < position; seen++, p++)
     {
-      /* If required, decode the stuff we've read into the gap.  */
-      struct coding_system coding;
-      /* JSON strings are UTF-8 encoded strings.  If for some reason
-	 the text returned by the Jansson library includes invalid
-	 byte sequences, they will be represented by raw bytes in the
-	 buffer text.  */
-      setup_coding_system (Qutf_8_unix, &coding);
-      coding.dst_multibyte =
-	!NILP (BVAR (current_buffer, enable_multibyte_characters));
-      if (CODING_MAY_REQUIRE_DECODING (&coding))
+      if (p == end)
 	{
-          /* Now we have all the new bytes at the beginning of the gap,
-             but `decode_coding_gap` needs them at the end of the gap, so
-             we need to move them.  */
-          memmove (GAP_END_ADDR - inserted_bytes, GPT_ADDR, inserted_bytes);
-	  decode_coding_gap (&coding, inserted_bytes);
-	  inserted = coding.produced_char;
+	  p = parser->secondary_input_begin;
+	  end = parser->secondary_input_end;
 	}
-      else
+      if (*p == '\n')
 	{
-          /* Make the inserted text part of the buffer, as unibyte text.  */
-          eassert (NILP (BVAR (current_buffer, enable_multibyte_characters)));
-          insert_from_gap_1 (inserted_bytes, inserted_bytes, false);
-
-	  /* The target buffer is unibyte, so we don't need to decode.  */
-	  invalidate_buffer_caches (current_buffer,
-				    PT, PT + inserted_bytes);
-	  adjust_after_insert (PT, PT_BYTE,
-			       PT + inserted_bytes,
-			       PT_BYTE + inserted_bytes,
-			       inserted_bytes);
-	  inserted = inserted_bytes;
+	  line++;
+	  column = 0;
 	}
+      else if ((*p & 0xc0) != 0x80)
+	column++;
     }
+  xsignal (error, list5 (build_string (message),
+			 build_string (parser->source),
+			 INT_TO_INTEGER (line), INT_TO_INTEGER (column),
+			 INT_TO_INTEGER (position)));
+}
 
-  /* Call after-change hooks.  */
-  signal_after_change (PT, 0, inserted);
-  if (inserted > 0)
-    {
-      update_compositions (PT, PT, CHECK_BORDER);
-      /* Move point to after the inserted text.  */
-      SET_PT_BOTH (PT + inserted, PT_BYTE + inserted_bytes);
-    }
+/* Signal a parse error about the unexpected byte C, or about the end
+   of the input if C is negative.  */
 
-  return unbind_to (count, Qnil);
+static AVOID
+json_signal_unexpected (struct json_parser *parser, int c,
+			const char *message)
+{
+  json_signal_error (parser,
+		     c < 0 ? Qjson_end_of_file : Qjson_parse_error, message);
 }
 
-/* Convert a JSON object to a Lisp object.  */
+/* Switch to the secondary input if the primary input is exhausted.
+   Return false at the end of all input.  */
 
-static Lisp_Object ARG_NONNULL ((1))
-json_to_lisp (json_t *json, struct json_configuration *conf)
+static bool
+json_input_switch (struct json_parser *parser)
 {
-  switch (json_typeof (json))
+  if (parser->end == parser->input_end
+      && parser->secondary_input_begin < parser->secondary_input_end)
     {
-    case JSON_NULL:
-      return conf->null_object;
-    case JSON_FALSE:
-      return conf->false_object;
-    case JSON_TRUE:
-      return Qt;
-    case JSON_INTEGER:
-      {
-	json_int_t i = json_integer_value (json);
-	return INT_TO_INTEGER (i);
-      }
-    case JSON_REAL:
-      return make_float (json_real_value (json));
-    case JSON_STRING:
-      return make_string_from_utf8 (json_string_value (json),
-				    json_string_length (json));
-    case JSON_ARRAY:
-      {
-        if (++lisp_eval_depth > max_lisp_eval_depth)
-          xsignal0 (Qjson_object_too_deep);
-        size_t size = json_array_size (json);
-        if (PTRDIFF_MAX < size)
-          overflow_error ();
-        Lisp_Object result;
-        switch (conf->array_type)
-          {
-          case json_array_array:
-            {
-              result = make_vector (size, Qunbound);
-              for (ptrdiff_t i = 0; i < size; ++i)
-                {
-                  rarely_quit (i);
-                  ASET (result, i,
-                        json_to_lisp (json_array_get (json, i), conf));
-                }
-              break;
-            }
-          case json_array_list:
-            {
-              result = Qnil;
-              for (ptrdiff_t i = size - 1; i >= 0; --i)
-                {
-                  rarely_quit (i);
-                  result = Fcons (json_to_lisp (json_array_get (json, i), conf),
-                                  result);
-                }
-              break;
-            }
-          default:
-            /* Can't get here.  */
-            emacs_abort ();
-          }
-        --lisp_eval_depth;
-        return result;
-      }
-    case JSON_OBJECT:
-      {
-        if (++lisp_eval_depth > max_lisp_eval_depth)
-          xsignal0 (Qjson_object_too_deep);
-        Lisp_Object result;
-        switch (conf->object_type)
-          {
-          case json_object_hashtable:
-            {
-              size_t size = json_object_size (json);
-              if (FIXNUM_OVERFLOW_P (size))
-                overflow_error ();
-              result = CALLN (Fmake_hash_table, QCtest, Qequal, QCsize,
-                              make_fixed_natnum (size));
-              struct Lisp_Hash_Table *h = XHASH_TABLE (result);
-              const char *key_str;
-              json_t *value;
-              json_object_foreach (json, key_str, value)
-                {
-		  Lisp_Object key = build_string_from_utf8 (key_str), hash;
-                  ptrdiff_t i = hash_lookup (h, key, &hash);
-                  /* Keys in JSON objects are unique, so the key can't
-                     be present yet.  */
-                  eassert (i < 0);
-                  hash_put (h, key, json_to_lisp (value, conf), hash);
-                }
-              break;
-            }
-          case json_object_alist:
-            {
-              result = Qnil;
-              const char *key_str;
-              json_t *value;
-              json_object_foreach (json, key_str, value)
-                {
-                  Lisp_Object key
-		    = Fintern (build_string_from_utf8 (key_str), Qnil);
-                  result
-                    = Fcons (Fcons (key, json_to_lisp (value, conf)),
-                             result);
-                }
-              result = Fnreverse (result);
-              break;
-            }
-          case json_object_plist:
-            {
-              result = Qnil;
-              const char *key_str;
-              json_t *value;
-              json_object_foreach (json, key_str, value)
-                {
-                  USE_SAFE_ALLOCA;
-                  ptrdiff_t key_str_len = strlen (key_str);
-                  char *keyword_key_str = SAFE_ALLOCA (1 + key_str_len + 1);
-                  keyword_key_str[0] = ':';
-                  strcpy (&keyword_key_str[1], key_str);
-                  Lisp_Object key = intern_1 (keyword_key_str, key_str_len + 1);
-                  /* Build the plist as value-key since we're going to
-                     reverse it in the end.*/
-                  result = Fcons (key, result);
-                  result = Fcons (json_to_lisp (value, conf), result);
-                  SAFE_FREE ();
-                }
-              result = Fnreverse (result);
-              break;
-            }
-          default:
-            /* Can't get here.  */
-            emacs_abort ();
-          }
-        --lisp_eval_depth;
-        return result;
-      }
+      parser->current = parser->secondary_input_begin;
+      parser->end = parser->secondary_input_end;
+      return true;
     }
-  /* Can't get here.  */
-  emacs_abort ();
+  return false;
 }
 
-DEFUN ("json-parse-string", Fjson_parse_string, Sjson_parse_string, 1, MANY,
-       NULL,
-       doc: /* Parse the JSON STRING into a Lisp object.
-This is essentially the reverse operation of `json-serialize', which
-see.  The returned object will be a vector, list, hashtable, alist, or
-plist.  Its elements will be the JSON null value, the JSON false
-value, t, numbers, strings, or further vectors, hashtables, alists, or
-plists.  If there are duplicate keys in an object, all but the last
-one are ignored.  If STRING doesn't contain a valid JSON object, this
-function signals an error of type `json-parse-error'.
+/* Return the next byte of input, or -1 at its end.  */
 
-The arguments ARGS are a list of keyword/argument pairs:
+static int
+json_input_get (struct json_parser *parser)
+{
+  if (parser->current < parser->end || json_input_switch (parser))
+    return *parser->current++;
+  return -1;
+}
+
+/* Unread the byte last returned by json_input_get.  */
+
+static void
+json_input_put_back (struct json_parser *parser)
+{
+  parser->current--;
+}
+
+/* Skip whitespace and return the next byte, or -1 at the end of
+   input.  */
+
+static int
+json_skip_whitespace (struct json_parser *parser)
+{
+  for (;;)
+    {
+      int c = json_input_get (parser);
+      if (!(c == ' ' || c == '\n' || c == '\t' || c == '\r'))
+	return c;
+    }
+}
+
+static void
+json_byte_workspace_append (struct json_parser *parser,
+			    const unsigned char *p, ptrdiff_t nbytes)
+{
+  ptrdiff_t avail = (parser->byte_workspace_size
+		     - parser->byte_workspace_current);
+  if (avail < nbytes)
+    parser->byte_workspace = xpalloc (parser->byte_workspace,
+				      &parser->byte_workspace_size,
+				      nbytes - avail, -1, 1);
+  memcpy (parser->byte_workspace + parser->byte_workspace_current, p,
+	  nbytes);
+  parser->byte_workspace_current += nbytes;
+}
+
+static void
+json_byte_workspace_put (struct json_parser *parser, unsigned char c)
+{
+  json_byte_workspace_append (parser, &c, 1);
+}
+
+static void
+json_object_workspace_push (struct json_parser *parser, Lisp_Object obj)
+{
+  if (parser->object_workspace_current == parser->object_workspace_size)
+    parser->object_workspace = xpalloc (parser->object_workspace,
+					&parser->object_workspace_size, 1,
+					-1, sizeof *parser->object_workspace);
+  parser->object_workspace[parser->object_workspace_current++] = obj;
+}
+
+/* Return the end of the longest run of bytes from P to END that can
+   be part of a string without escaping: printable ASCII characters
+   other than '"' and '\\', and valid UTF-8 sequences.  Add the number
+   of UTF-8 continuation bytes in the run to *CONTINUATION_BYTES.  */
+
+static const unsigned char *
+json_scan_string_run (const unsigned char *p, const unsigned char *end,
+		      ptrdiff_t *continuation_bytes)
+{
+  for (;;)
+    {
+      while (end - p >= sizeof (json_word)
+	     && json_word_plain_p (json_load_word (p)))
+	p += sizeof (json_word);
+      if (p == end)
+	return p;
+      unsigned char c = *p;
+      if (c < 0x80)
+	{
+	  if (c < 0x20 || c == '"' || c == '\\')
+	    return p;
+	  p++;
+	}
+      else
+	{
+	  int len = json_utf8_length (p, end - p);
+	  if (!len)
+	    return p;
+	  p += len;
+	  *continuation_bytes += len - 1;
+	}
+    }
+}
+
+/* Parse four hexadecimal digits of a \u escape.  */
+
+static int
+json_parse_hex4 (struct json_parser *parser)
+{
+  int value = 0;
+  for (int i = 0; i < 4; i++)
+    {
+      int c = json_input_get (parser);
+      int digit = ('0' <= c && c <= '9' ? c - '0'
+		   : 'a' <= c && c <= 'f' ? c - 'a' + 10
+		   : 'A' <= c && c <= 'F' ? c - 'A' + 10
+		   : -1);
+      if (digit < 0)
+	json_signal_unexpected (parser, c, "invalid escape");
+      value = (value << 4) + digit;
+    }
+  return value;
+}
+
+/* Parse the escape sequence after a backslash in a string, and
+   append the character it stands for to the byte workspace.  */
+
+static void
+json_parse_escape (struct json_parser *parser, ptrdiff_t *continuation_bytes)
+{
+  int c = json_input_get (parser);
+  switch (c)
+    {
+    case '"': case '\\': case '/':
+      break;
+    case 'b': c = '\b'; break;
+    case 'f': c = '\f'; break;
+    case 'n': c = '\n'; break;
+    case 'r': c = '\r'; break;
+    case 't': c = '\t'; break;
+    case 'u':
+      {
+	c = json_parse_hex4 (parser);
+	if (0xdc00 <= c && c <= 0xdfff)
+	  json_signal_error (parser, Qjson_parse_error,
+			     "invalid Unicode escape");
+	if (0xd800 <= c && c <= 0xdbff)
+	  {
+	    int c1 = json_input_get (parser);
+	    if (c1 != '\\')
+	      json_signal_unexpected (parser, c1, "invalid Unicode escape");
+	    c1 = json_input_get (parser);
+	    if (c1 != 'u')
+	      json_signal_unexpected (parser, c1, "invalid Unicode escape");
+	    int low = json_parse_hex4 (parser);
+	    if (!(0xdc00 <= low && low <= 0xdfff))
+	      json_signal_error (parser, Qjson_parse_error,
+				 "invalid Unicode escape");
+	    c = 0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00);
+	  }
+	if (c == 0)
+	  json_signal_error (parser, Qjson_parse_error,
+			     "\\u0000 is not allowed");
+	unsigned char str[MAX_MULTIBYTE_LENGTH];
+	int len = CHAR_STRING (c, str);
+	json_byte_workspace_append (parser, str, len);
+	*continuation_bytes += len - 1;
+	return;
+      }
+    default:
+      json_signal_unexpected (parser, c, "invalid escape");
+    }
+  json_byte_workspace_put (parser, c);
+}
+
+/* Parse a UTF-8 sequence in a string starting with byte C, which has
+   already been read, and append it to the byte workspace.  */
+
+static void
+json_parse_utf8_sequence (struct json_parser *parser, int c,
+			  ptrdiff_t *continuation_bytes)
+{
+  unsigned char seq[4];
+  int len = c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4;
+  seq[0] = c;
+  for (int i = 1; i < len; i++)
+    {
+      int c1 = json_input_get (parser);
+      if (c1 < 0)
+	json_signal_error (parser, Qjson_end_of_file,
+			   "unexpected end of input in string");
+      seq[i] = c1;
+    }
+  if (json_utf8_length (seq, len) != len)
+    json_signal_error (parser, Qjson_parse_error, "invalid UTF-8");
+  json_byte_workspace_append (parser, seq, len);
+  *continuation_bytes += len - 1;
+}
+
+/* Parse a string whose opening quote has been read.  Set *DATA,
+   *NBYTES and *NCHARS to its contents in UTF-8, which is either part
+   of the input or in the byte workspace, and to its length in bytes
+   and in characters.  */
+
+static void
+json_parse_string (struct json_parser *parser, const unsigned char **data,
+		   ptrdiff_t *nbytes, ptrdiff_t *nchars)
+{
+  ptrdiff_t continuation_bytes = 0;
+  const unsigned char *start = parser->current;
+  const unsigned char *p = json_scan_string_run (start, parser->end,
+						 &continuation_bytes);
+
+  /* Most strings contain no escapes, so they can be used in
+     place.  */
+  if (p < parser->end && *p == '"')
+    {
+      parser->current = p + 1;
+      *data = start;
+      *nbytes = p - start;
+      *nchars = *nbytes - continuation_bytes;
+      return;
+    }
+
+  parser->byte_workspace_current = 0;
+  for (;;)
+    {
+      json_byte_workspace_append (parser, start, p - start);
+      parser->current = p;
+      int c = json_input_get (parser);
+      if (c == '"')
+	break;
+      if (c == '\\')
+	json_parse_escape (parser, &continuation_bytes);
+      else if (c < 0)
+	json_signal_error (parser, Qjson_end_of_file,
+			   "unexpected end of input in string");
+      else if (c < 0x20)
+	json_signal_error (parser, Qjson_parse_error,
+			   "control character in string");
+      else if (c < 0x80)
+	json_byte_workspace_put (parser, c);
+      else if (c < 0xc2 || 0xf4 < c)
+	json_signal_error (parser, Qjson_parse_error, "invalid UTF-8");
+      else
+	json_parse_utf8_sequence (parser, c, &continuation_bytes);
+      start = parser->current;
+      p = json_scan_string_run (start, parser->end, &continuation_bytes);
+    }
+  *data = parser->byte_workspace;
+  *nbytes = parser->byte_workspace_current;
+  *nchars = *nbytes - continuation_bytes;
+}
+
+/* Parse a number whose first byte C has been read.  */
+
+static Lisp_Object
+json_parse_number (struct json_parser *parser, int c)
+{
+  parser->byte_workspace_current = 0;
+  bool negative = c == '-';
+  bool is_float = false;
+  intmax_t value = 0;
+  int ndigits = 0;
+
+  if (negative)
+    {
+      json_byte_workspace_put (parser, c);
+      c = json_input_get (parser);
+    }
+  if (c == '0')
+    {
+      json_byte_workspace_put (parser, c);
+      c = json_input_get (parser);
+      ndigits = 1;
+    }
+  else if ('1' <= c && c <= '9')
+    do
+      {
+	json_byte_workspace_put (parser, c);
+	/* Integers with up to 18 digits fit into intmax_t.  */
+	if (ndigits++ < 18)
+	  value = value * 10 + (c - '0');
+	c = json_input_get (parser);
+      }
+    while ('0' <= c && c <= '9');
+  else
+    json_signal_unexpected (parser, c, "invalid number");
+
+  if (c == '.')
+    {
+      is_float = true;
+      json_byte_workspace_put (parser, c);
+      c = json_input_get (parser);
+      if (!('0' <= c && c <= '9'))
+	json_signal_unexpected (parser, c, "invalid number");
+      do
+	{
+	  json_byte_workspace_put (parser, c);
+	  c = json_input_get (parser);
+	}
+      while ('0' <= c && c <= '9');
+    }
+  if (c == 'e' || c == 'E')
+    {
+      is_float = true;
+      json_byte_workspace_put (parser, c);
+      c = json_input_get (parser);
+      if (c == '+' || c == '-')
+	{
+	  json_byte_workspace_put (parser, c);
+	  c = json_input_get (parser);
+	}
+      if (!('0' <= c && c <= '9'))
+	json_signal_unexpected (parser, c, "invalid number");
+      do
+	{
+	  json_byte_workspace_put (parser, c);
+	  c = json_input_get (parser);
+	}
+      while ('0' <= c && c <= '9');
+    }
+  if (c >= 0)
+    json_input_put_back (parser);
+
+  if (!is_float && ndigits <= 18)
+    return make_int (negative ? -value : value);
+
+  json_byte_workspace_put (parser, '\0');
+  char *text = (char *) parser->byte_workspace;
+  if (!is_float)
+    return string_to_number (text, 10, NULL);
+  double d = strtod (text, NULL);
+  if (isinf (d))
+    json_signal_error (parser, Qjson_parse_error, "real number overflow");
+  return make_float (d);
+}
+
+/* Parse the rest of the literal whose first byte has been read, and
+   return VALUE.  */
+
+static Lisp_Object
+json_parse_literal (struct json_parser *parser, const char *rest,
+		    Lisp_Object value)
+{
+  for (; *rest; rest++)
+    {
+      int c = json_input_get (parser);
+      if (c != *rest)
+	json_signal_unexpected (parser, c, "invalid token");
+    }
+  return value;
+}
+
+static Lisp_Object json_parse_value (struct json_parser *parser, int c);
+
+static Lisp_Object
+json_parse_array (struct json_parser *parser)
+{
+  if (++lisp_eval_depth > max_lisp_eval_depth)
+    xsignal0 (Qjson_object_too_deep);
+
+  ptrdiff_t first = parser->object_workspace_current;
+  int c = json_skip_whitespace (parser);
+  if (c != ']')
+    for (;;)
+      {
+	json_object_workspace_push (parser, json_parse_value (parser, c));
+	c = json_skip_whitespace (parser);
+	if (c == ']')
+	  break;
+	if (c != ',')
+	  json_signal_unexpected (parser, c, "',' or ']' expected");
+	c = json_skip_whitespace (parser);
+      }
+
+  ptrdiff_t size = parser->object_workspace_current - first;
+  Lisp_Object *elements = parser->object_workspace + first;
+  Lisp_Object result;
+  switch (parser->conf.array_type)
+    {
+    case json_array_array:
+      result = make_uninit_vector (size);
+      memcpy (XVECTOR (result)->contents, elements, size * word_size);
+      break;
+    case json_array_list:
+      result = Qnil;
+      for (ptrdiff_t i = size - 1; i >= 0; --i)
+	result = Fcons (elements[i], result);
+      break;
+    default:
+      /* Can't get here.  */
+      emacs_abort ();
+    }
+  parser->object_workspace_current = first;
+  --lisp_eval_depth;
+  return result;
+}
+
+/* Return the entry of the key cache of PARSER for the NBYTES bytes
+   at DATA, whose hash_string is HASH.  If the key is not cached, return
+   an unused entry to store it in, or NULL if it should not be
+   cached.  */
+
+static struct json_key *
+json_key_cache_lookup (struct json_parser *parser, const unsigned char *data,
+		       ptrdiff_t nbytes, EMACS_UINT hash)
+{
+  if (nbytes > JSON_KEY_CACHE_MAX_BYTES)
+    return NULL;
+  if (parser->key_cache_size < 2 * JSON_KEY_CACHE_MAX
+      && parser->key_cache_count >= parser->key_cache_size / 2)
+    {
+      /* Grow the table, keeping it at most half full.  */
+      struct json_key *old = parser->key_cache;
+      ptrdiff_t old_size = parser->key_cache_size;
+      ptrdiff_t size = old_size ? 2 * old_size : 64;
+      struct json_key *new = xzalloc (size * sizeof *new);
+      for (ptrdiff_t i = 0; i < old_size; i++)
+	if (old[i].used)
+	  {
+	    ptrdiff_t j = old[i].hash & (size - 1);
+	    while (new[j].used)
+	      j = (j + 1) & (size - 1);
+	    new[j] = old[i];
+	  }
+      xfree (old);
+      parser->key_cache = new;
+      parser->key_cache_size = size;
+    }
+
+  ptrdiff_t mask = parser->key_cache_size - 1;
+  for (ptrdiff_t i = hash & mask; ; i = (i + 1) & mask)
+    {
+      struct json_key *entry = &parser->key_cache[i];
+      if (!entry->used)
+	return (parser->key_cache_count < JSON_KEY_CACHE_MAX
+		? entry : NULL);
+      if (entry->hash == hash && entry->nbytes == nbytes
+	  && memcmp (parser->key_bytes + entry->offset, data, nbytes) == 0)
+	return entry;
+    }
+}
+
+/* Store KEY, made from the NBYTES bytes at DATA whose hash_string is
+   HASH, in ENTRY of the key cache of PARSER.  */
+
+static void
+json_key_cache_add (struct json_parser *parser, struct json_key *entry,
+		    const unsigned char *data, ptrdiff_t nbytes,
+		    EMACS_UINT hash, Lisp_Object key)
+{
+  if (parser->key_bytes_size - parser->key_bytes_current < nbytes)
+    parser->key_bytes
+      = xpalloc (parser->key_bytes, &parser->key_bytes_size,
+		 nbytes - (parser->key_bytes_size
+			   - parser->key_bytes_current),
+		 -1, 1);
+  memcpy (parser->key_bytes + parser->key_bytes_current, data, nbytes);
+  entry->key = key;
+  entry->hash = hash;
+  entry->offset = parser->key_bytes_current;
+  entry->nbytes = nbytes;
+  entry->used = true;
+  parser->key_bytes_current += nbytes;
+  parser->key_cache_count++;
+}
+
+/* Make the Lisp key for the NCHARS characters and NBYTES bytes at
+   DATA.  */
+
+static Lisp_Object
+json_make_object_key (struct json_parser *parser, const unsigned char *data,
+		      ptrdiff_t nchars, ptrdiff_t nbytes)
+{
+  switch (parser->conf.object_type)
+    {
+    case json_object_hashtable:
+      return make_specified_string ((const char *) data, nchars, nbytes,
+				    true);
+    case json_object_alist:
+      return Fintern (make_specified_string ((const char *) data, nchars,
+					     nbytes, true),
+		      Qnil);
+    case json_object_plist:
+      {
+	Lisp_Object name = make_uninit_multibyte_string (nchars + 1,
+							 nbytes + 1);
+	SSET (name, 0, ':');
+	memcpy (SDATA (name) + 1, data, nbytes);
+	return Fintern (name, Qnil);
+      }
+    default:
+      /* Can't get here.  */
+      emacs_abort ();
+    }
+}
+
+/* Parse an object key and return it as a Lisp object.  Store in
+   *HASH the hash_string of its bytes.  Keys with the same bytes
+   yield the same object within a parse, even for hash tables.  */
+
+static Lisp_Object
+json_parse_object_key (struct json_parser *parser, EMACS_UINT *hash)
+{
+  const unsigned char *data;
+  ptrdiff_t nbytes, nchars;
+  json_parse_string (parser, &data, &nbytes, &nchars);
+  *hash = hash_string ((const char *) data, nbytes);
+  struct json_key *entry = json_key_cache_lookup (parser, data, nbytes,
+						  *hash);
+  if (entry && entry->used)
+    return entry->key;
+  Lisp_Object key = json_make_object_key (parser, data, nchars, nbytes);
+  if (entry)
+    json_key_cache_add (parser, entry, data, nbytes, *hash, key);
+  return key;
+}
+
+/* Remove duplicate keys from the SIZE key/value pairs at MEMBERS,
+   whose keys are symbols.  The first instance of a key stays where
+   it is and gets the last value.  Return the number of pairs
+   left.  */
+
+static ptrdiff_t
+json_remove_duplicate_keys (Lisp_Object *members, ptrdiff_t size)
+{
+  ptrdiff_t kept = 0;
+  if (size <= JSON_SMALL_OBJECT)
+    {
+      for (ptrdiff_t i = 0; i < size; i++)
+	{
+	  ptrdiff_t j;
+	  for (j = 0; j < kept; j++)
+	    if (EQ (members[2 * j], members[2 * i]))
+	      break;
+	  if (j == kept)
+	    members[2 * kept++] = members[2 * i];
+	  members[2 * j + 1] = members[2 * i + 1];
+	}
+      return kept;
+    }
+
+  Lisp_Object table = make_hash_table (hashtest_eq, size,
+				       DEFAULT_REHASH_SIZE,
+				       DEFAULT_REHASH_THRESHOLD, Qnil, false);
+  struct Lisp_Hash_Table *h = XHASH_TABLE (table);
+  for (ptrdiff_t i = 0; i < size; i++)
+    {
+      Lisp_Object hash;
+      ptrdiff_t k = hash_lookup (h, members[2 * i], &hash);
+      ptrdiff_t j;
+      if (k >= 0)
+	j = XFIXNUM (HASH_VALUE (h, k));
+      else
+	{
+	  j = kept++;
+	  hash_put (h, members[2 * i], make_fixnum (j), hash);
+	  members[2 * j] = members[2 * i];
+	}
+      members[2 * j + 1] = members[2 * i + 1];
+    }
+  return kept;
+}
+
+static Lisp_Object
+json_parse_object (struct json_parser *parser)
+{
+  if (++lisp_eval_depth > max_lisp_eval_depth)
+    xsignal0 (Qjson_object_too_deep);
+
+  ptrdiff_t first = parser->object_workspace_current;
+  int c = json_skip_whitespace (parser);
+  if (c != '}')
+    for (;;)
+      {
+	if (c != '"')
+	  json_signal_unexpected (parser, c, "string or '}' expected");
+	EMACS_UINT hash;
+	json_object_workspace_push (parser,
+				    json_parse_object_key (parser, &hash));
+	/* For hash tables, also keep the hash code of the key, so
+	   that it is computed only once.  */
+	if (parser->conf.object_type == json_object_hashtable)
+	  json_object_workspace_push (parser,
+				      make_ufixnum (SXHASH_REDUCE (hash)));
+	c = json_skip_whitespace (parser);
+	if (c != ':')
+	  json_signal_unexpected (parser, c, "':' expected");
+	c = json_skip_whitespace (parser);
+	json_object_workspace_push (parser, json_parse_value (parser, c));
+	c = json_skip_whitespace (parser);
+	if (c == '}')
+	  break;
+	if (c != ',')
+	  json_signal_unexpected (parser, c, "',' or '}' expected");
+	c = json_skip_whitespace (parser);
+      }
+
+  ptrdiff_t nmembers = parser->object_workspace_current - first;
+  Lisp_Object *members = parser->object_workspace + first;
+  ptrdiff_t size = nmembers / 2;
+  Lisp_Object result;
+  switch (parser->conf.object_type)
+    {
+    case json_object_hashtable:
+      {
+	/* The members are triples of key, hash code and value.  */
+	size = nmembers / 3;
+	result = make_hash_table (hashtest_equal, size, DEFAULT_REHASH_SIZE,
+				  DEFAULT_REHASH_THRESHOLD, Qnil, false);
+	struct Lisp_Hash_Table *h = XHASH_TABLE (result);
+	for (ptrdiff_t i = 0; i < size; i++)
+	  {
+	    Lisp_Object key = members[3 * i];
+	    Lisp_Object hash = members[3 * i + 1];
+	    Lisp_Object value = members[3 * i + 2];
+	    ptrdiff_t j = hash_lookup_with_hash (h, key, hash);
+	    if (j >= 0)
+	      set_hash_value_slot (h, j, value);
+	    else
+	      hash_put (h, key, value, hash);
+	  }
+	break;
+      }
+    case json_object_alist:
+      size = json_remove_duplicate_keys (members, size);
+      result = Qnil;
+      for (ptrdiff_t i = size - 1; i >= 0; --i)
+	result = Fcons (Fcons (members[2 * i], members[2 * i + 1]), result);
+      break;
+    case json_object_plist:
+      size = json_remove_duplicate_keys (members, size);
+      result = Qnil;
+      for (ptrdiff_t i = size - 1; i >= 0; --i)
+	result = Fcons (members[2 * i], Fcons (members[2 * i + 1], result));
+      break;
+    default:
+      /* Can't get here.  */
+      emacs_abort ();
+    }
+  parser->object_workspace_current = first;
+  --lisp_eval_depth;
+  return result;
+}
+
+/* Parse a value whose first byte C has been read.  */
+
+static Lisp_Object
+json_parse_value (struct json_parser *parser, int c)
+{
+  switch (c)
+    {
+    case '{':
+      return json_parse_object (parser);
+    case '[':
+      return json_parse_array (parser);
+    case '"':
+      {
+	const unsigned char *data;
+	ptrdiff_t nbytes, nchars;
+	json_parse_string (parser, &data, &nbytes, &nchars);
+	return make_specified_string ((const char *) data, nchars, nbytes,
+				      true);
+      }
+    case '-': case '0': case '1': case '2': case '3': case '4':
+    case '5': case '6': case '7': case '8': case '9':
+      return json_parse_number (parser, c);
+    case 't':
+      return json_parse_literal (parser, "rue", Qt);
+    case 'f':
+      return json_parse_literal (parser, "alse", parser->conf.false_object);
+    case 'n':
+      return json_parse_literal (parser, "ull", parser->conf.null_object);
+    default:
+      json_signal_unexpected (parser, c, "invalid token");
+    }
+}
+
+/* Parse a toplevel value, which must be an array or object.  If
+   CHECK_EOF, signal an error unless only whitespace follows it.  */
+
+static Lisp_Object
+json_parse_toplevel (struct json_parser *parser, bool check_eof)
+{
+  int c = json_skip_whitespace (parser);
+  if (c != '[' && c != '{')
+    json_signal_unexpected (parser, c, "'[' or '{' expected");
+  Lisp_Object result = json_parse_value (parser, c);
+  if (check_eof && json_skip_whitespace (parser) >= 0)
+    json_signal_error (parser, Qjson_trailing_content,
+		       "end of file expected");
+  return result;
+}
+
+/* Return STRING, or its UTF-8 encoding if its bytes differ from it.
+   Multibyte strings are UTF-8 unless they contain raw bytes or
+   characters beyond Unicode, whose internal representation starts
+   with one of the bytes checked for here.  */
+
+static Lisp_Object
+json_parse_input (Lisp_Object string)
+{
+  if (STRING_MULTIBYTE (string) && SCHARS (string) < SBYTES (string))
+    for (ptrdiff_t i = 0; i < SBYTES (string); i++)
+      {
+	unsigned char b = SREF (string, i);
+	if (b == 0xc0 || b == 0xc1 || b == 0xf8)
+	  return json_encode (string);
+      }
+  return string;
+}
+
+DEFUN ("json-parse-string", Fjson_parse_string, Sjson_parse_string, 1, MANY,
+       NULL,
+       doc: /* Parse the JSON STRING into a Lisp object.
+This is essentially the reverse operation of `json-serialize', which
+see.  The returned object will be a vector, list, hashtable, alist, or
+plist.  Its elements will be the JSON null value, the JSON false
+value, t, numbers, strings, or further vectors, hashtables, alists, or
+plists.  If there are duplicate keys in an object, all but the last
+one are ignored.  If STRING doesn't contain a valid JSON object, this
+function signals an error of type `json-parse-error'.
+
+The arguments ARGS are a list of keyword/argument pairs:
 
 The keyword argument `:object-type' specifies which Lisp type is used
 to represent objects; it can be `hash-table', `alist' or `plist'.  It
@@ -958,68 +1588,69 @@ DEFUN ("json-parse-string", Fjson_parse_string, Sjson_parse_string, 1, MANY,
 {
   ptrdiff_t count = SPECPDL_INDEX ();
 
-#ifdef WINDOWSNT
-  if (!json_initialized)
-    {
-      Lisp_Object status;
-      json_initialized = init_json_functions ();
-      status = json_initialized ? Qt : Qnil;
-      Vlibrary_cache = Fcons (Fcons (Qjson, status), Vlibrary_cache);
-    }
-  if (!json_initialized)
-    {
-      message1 ("jansson library not found");
-      return Qnil;
-    }
-#endif
-
   Lisp_Object string = args[0];
   CHECK_STRING (string);
-  Lisp_Object encoded = json_encode (string);
+  Lisp_Object encoded = json_parse_input (string);
   check_string_without_embedded_nulls (encoded);
   struct json_configuration conf =
     {json_object_hashtable, json_array_array, QCnull, QCfalse};
   json_parse_args (nargs - 1, args + 1, &conf, true);
 
-  json_error_t error;
-  json_t *object = json_loads (SSDATA (encoded), 0, &error);
-  if (object == NULL)
-    json_parse_error (&error);
+  struct json_parser parser;
+  json_parser_init (&parser, conf, "<string>", SDATA (encoded),
+		    SDATA (encoded) + SBYTES (encoded), NULL, NULL);
+  record_unwind_protect_ptr (json_parser_done, &parser);
 
-  /* Avoid leaking the object in case of further errors.  */
-  if (object != NULL)
-    record_unwind_protect_ptr (json_release_object, object);
+  return unbind_to (count, json_parse_toplevel (&parser, true));
+}
+
+/* Store in CONF the parser configuration described by ARGS, a list
+   of keyword arguments as for `json-parse-string'.  */
 
-  return unbind_to (count, json_to_lisp (object, &conf));
+static void
+json_parse_args_list (Lisp_Object args, struct json_configuration *conf)
+{
+  ptrdiff_t nargs = list_length (args);
+  Lisp_Object *argv;
+  USE_SAFE_ALLOCA;
+  SAFE_ALLOCA_LISP (argv, nargs);
+  for (ptrdiff_t i = 0; i < nargs; i++, args = XCDR (args))
+    argv[i] = XCAR (args);
+  json_parse_args (nargs, argv, conf, true);
+  SAFE_FREE ();
 }
 
-struct json_read_buffer_data
+/* Signal an error unless ARGS is a valid list of keyword arguments
+   for `json-parse-string'.  */
+
+void
+json_check_parse_args (Lisp_Object args)
 {
-  /* Byte position of position to read the next chunk from.  */
-  ptrdiff_t point;
-};
+  struct json_configuration conf =
+    {json_object_hashtable, json_array_array, QCnull, QCfalse};
+  json_parse_args_list (args, &conf);
+}
 
-/* Callback for json_load_callback that reads from the current buffer.
-   DATA must point to a structure of type json_read_buffer_data.
-   data->point must point to the byte position to read from; after
-   reading, data->point is advanced accordingly.  The buffer point
-   itself is ignored.  This function may not exit nonlocally.  */
+/* Parse the NBYTES bytes of JSON at DATA, a message read from a
+   process whose framing is `jsonrpc'.  ARGS are keyword arguments as
+   for `json-parse-string'.  Unlike `json-parse-string', this parses
+   the bytes in place, without making a Lisp string first.  */
 
-static size_t
-json_read_buffer_callback (void *buffer, size_t buflen, void *data)
+Lisp_Object
+json_parse_rpc_message (const char *data, ptrdiff_t nbytes, Lisp_Object args)
 {
-  struct json_read_buffer_data *d = data;
+  ptrdiff_t count = SPECPDL_INDEX ();
+  struct json_configuration conf =
+    {json_object_hashtable, json_array_array, QCnull, QCfalse};
+  json_parse_args_list (args, &conf);
 
-  /* First, parse from point to the gap or the end of the accessible
-     portion, whatever is closer.  */
-  ptrdiff_t point = d->point;
-  ptrdiff_t end = BUFFER_CEILING_OF (point) + 1;
-  ptrdiff_t count = end - point;
-  if (buflen < count)
-    count = buflen;
-  memcpy (buffer, BYTE_POS_ADDR (point), count);
-  d->point += count;
-  return count;
+  struct json_parser parser;
+  json_parser_init (&parser, conf, "<message>",
+		    (const unsigned char *) data,
+		    (const unsigned char *) data + nbytes, NULL, NULL);
+  record_unwind_protect_ptr (json_parser_done, &parser);
+
+  return unbind_to (count, json_parse_toplevel (&parser, true));
 }
 
 DEFUN ("json-parse-buffer", Fjson_parse_buffer, Sjson_parse_buffer,
@@ -1056,45 +1687,322 @@ DEFUN ("json-parse-buffer", Fjson_parse_buffer, Sjson_parse_buffer,
 {
   ptrdiff_t count = SPECPDL_INDEX ();
 
-#ifdef WINDOWSNT
-  if (!json_initialized)
+  struct json_configuration conf =
+    {json_object_hashtable, json_array_array, QCnull, QCfalse};
+  json_parse_args (nargs, args, &conf, true);
+
+  /* Parse the text from point to the end of the accessible portion
+     in place, in two parts if the gap is in between.  */
+  ptrdiff_t point = PT_BYTE;
+  ptrdiff_t end = ZV_BYTE;
+  const unsigned char *begin = BYTE_POS_ADDR (point);
+  struct json_parser parser;
+  if (point < GPT_BYTE && GPT_BYTE < end)
+    json_parser_init (&parser, conf, "<buffer>", begin, GPT_ADDR,
+		      GAP_END_ADDR, GAP_END_ADDR + (end - GPT_BYTE));
+  else
+    json_parser_init (&parser, conf, "<buffer>", begin,
+		      begin + (end - point), NULL, NULL);
+  record_unwind_protect_ptr (json_parser_done, &parser);
+#ifdef REL_ALLOC
+  /* Prevent ralloc.c from relocating the buffer text while the parser
+     reads it.  */
+  r_alloc_inhibit_buffer_relocation (1);
+  record_unwind_protect_int (r_alloc_inhibit_buffer_relocation, 0);
+#endif
+
+  Lisp_Object lisp = json_parse_toplevel (&parser, false);
+
+  /* Move point only if everything succeeded.  */
+  point += json_parser_position (&parser);
+  SET_PT_BOTH (BYTE_TO_CHAR (point), point);
+
+  return unbind_to (count, lisp);
+}
+
+/* An incremental parser, made by `json-make-parser'.  PENDING holds
+   the input fed to it that has not been consumed yet, from START to
+   PENDING_SIZE.  Between values, START is where the next value may
+   begin; inside a value, START is where the value begins and the
+   bytes from there to SCANNED have been scanned for its structure,
+   so that feeding more input never scans the same bytes twice.  */
+
+struct Lisp_JSON_Parser
+{
+  union vectorlike_header header;
+
+  Lisp_Object null_object;
+  Lisp_Object false_object;
+
+  /* Values parsed but not returned yet, most recent first.  */
+  Lisp_Object ready;
+
+  enum json_object_type object_type;
+  enum json_array_type array_type;
+
+  unsigned char *pending;
+  ptrdiff_t pending_size;
+  ptrdiff_t pending_capacity;
+  ptrdiff_t start;
+  ptrdiff_t scanned;
+
+  /* Nesting depth of the value being scanned, or zero between
+     values.  */
+  ptrdiff_t depth;
+
+  /* True if the scan is inside a string, and right after a
+     backslash in it.  */
+  bool_bf in_string : 1;
+  bool_bf escape : 1;
+
+  /* True if the rest of the current line is being skipped after an
+     error between values.  */
+  bool_bf discarding : 1;
+} GCALIGNED_STRUCT;
+
+static bool
+JSON_PARSERP (Lisp_Object x)
+{
+  return PSEUDOVECTORP (x, PVEC_JSON_PARSER);
+}
+
+static void
+CHECK_JSON_PARSER (Lisp_Object x)
+{
+  CHECK_TYPE (JSON_PARSERP (x), Qjson_parser_p, x);
+}
+
+static struct Lisp_JSON_Parser *
+XJSON_PARSER (Lisp_Object a)
+{
+  eassert (JSON_PARSERP (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_JSON_Parser);
+}
+
+void
+finalize_json_parser (struct Lisp_Vector *v)
+{
+  struct Lisp_JSON_Parser *p = (struct Lisp_JSON_Parser *) v;
+  xfree (p->pending);
+  p->pending = NULL;
+}
+
+/* Append the NBYTES bytes at DATA to the pending input of P.  Drop
+   the consumed input first if that is at least as large as the rest,
+   so that each byte is moved only a bounded number of times.  */
+
+static void
+json_stream_append (struct Lisp_JSON_Parser *p, const unsigned char *data,
+		    ptrdiff_t nbytes)
+{
+  if (p->start > 0 && p->start >= p->pending_size - p->start)
     {
-      Lisp_Object status;
-      json_initialized = init_json_functions ();
-      status = json_initialized ? Qt : Qnil;
-      Vlibrary_cache = Fcons (Fcons (Qjson, status), Vlibrary_cache);
+      memmove (p->pending, p->pending + p->start,
+	       p->pending_size - p->start);
+      p->pending_size -= p->start;
+      p->scanned -= p->start;
+      p->start = 0;
     }
-  if (!json_initialized)
+  if (p->pending_capacity - p->pending_size < nbytes)
+    p->pending = xpalloc (p->pending, &p->pending_capacity,
+			  nbytes - (p->pending_capacity - p->pending_size),
+			  -1, 1);
+  memcpy (p->pending + p->pending_size, data, nbytes);
+  p->pending_size += nbytes;
+}
+
+/* Parse the complete value from BEGIN to END, which was fed to P.  */
+
+static Lisp_Object
+json_stream_parse (struct Lisp_JSON_Parser *p, const unsigned char *begin,
+		   const unsigned char *end)
+{
+  ptrdiff_t count = SPECPDL_INDEX ();
+  struct json_configuration conf =
+    {p->object_type, p->array_type, p->null_object, p->false_object};
+  struct json_parser parser;
+  json_parser_init (&parser, conf, "<stream>", begin, end, NULL, NULL);
+  record_unwind_protect_ptr (json_parser_done, &parser);
+  return unbind_to (count, json_parse_toplevel (&parser, true));
+}
+
+/* Signal a parse error about the junk at BEGIN, which was fed to P
+   outside of any value and ends at END.  */
+
+static AVOID
+json_stream_signal_junk (struct Lisp_JSON_Parser *p,
+			 const unsigned char *begin, const unsigned char *end)
+{
+  struct json_configuration conf =
+    {p->object_type, p->array_type, p->null_object, p->false_object};
+  struct json_parser parser;
+  json_parser_init (&parser, conf, "<stream>", begin, end, NULL, NULL);
+  int c = json_skip_whitespace (&parser);
+  json_signal_unexpected (&parser, c, "'[' or '{' expected");
+}
+
+/* Return true if none of the bytes of W is a double quote or a
+   backslash.  */
+
+static bool
+json_word_unquoted_p (json_word w)
+{
+  json_word quote = w ^ (JSON_WORD_ONES * '"');
+  json_word backslash = w ^ (JSON_WORD_ONES * '\\');
+  return !((((quote - JSON_WORD_ONES) & ~quote)
+	    | ((backslash - JSON_WORD_ONES) & ~backslash))
+	   & (JSON_WORD_ONES * 0x80));
+}
+
+/* Scan the pending input of P for complete values and parse them,
+   adding them to the values that are ready.  Update the state of P
+   before parsing each value, so that a parse error in one value
+   leaves P ready to continue after it.  */
+
+static void
+json_stream_scan (struct Lisp_JSON_Parser *p)
+{
+  while (p->scanned < p->pending_size)
     {
-      message1 ("jansson library not found");
-      return Qnil;
+      const unsigned char *s = p->pending;
+      ptrdiff_t i = p->scanned;
+      ptrdiff_t end = p->pending_size;
+
+      if (p->depth == 0)
+	{
+	  unsigned char c = s[i];
+	  p->start = p->scanned = i + 1;
+	  if (p->discarding)
+	    p->discarding = c != '\n';
+	  else if (c == '[' || c == '{')
+	    {
+	      p->start = i;
+	      p->depth = 1;
+	    }
+	  else if (! (c == ' ' || c == '\t' || c == '\n' || c == '\r'))
+	    {
+	      /* Skip the rest of the line, so that a stream of
+		 newline-delimited values can recover from a bad
+		 line.  */
+	      p->discarding = true;
+	      json_stream_signal_junk (p, s + i, s + end);
+	    }
+	  continue;
+	}
+
+      ptrdiff_t depth = p->depth;
+      bool in_string = p->in_string;
+      bool escape = p->escape;
+      while (i < end)
+	{
+	  if (in_string)
+	    {
+	      if (escape)
+		{
+		  escape = false;
+		  i++;
+		  continue;
+		}
+	      while (end - i >= sizeof (json_word)
+		     && json_word_unquoted_p (json_load_word (s + i)))
+		i += sizeof (json_word);
+	      if (i == end)
+		break;
+	      unsigned char c = s[i++];
+	      if (c == '\\')
+		escape = true;
+	      else if (c == '"')
+		in_string = false;
+	    }
+	  else
+	    {
+	      unsigned char c = s[i++];
+	      if (c == '"')
+		in_string = true;
+	      else if (c == '[' || c == '{')
+		depth++;
+	      else if ((c == ']' || c == '}') && --depth == 0)
+		break;
+	    }
+	}
+      p->depth = depth;
+      p->in_string = in_string;
+      p->escape = escape;
+      p->scanned = i;
+
+      if (depth == 0)
+	{
+	  ptrdiff_t value_start = p->start;
+	  p->start = i;
+	  Lisp_Object value = json_stream_parse (p, s + value_start, s + i);
+	  p->ready = Fcons (value, p->ready);
+	}
     }
-#endif
+}
 
+DEFUN ("json-make-parser", Fjson_make_parser, Sjson_make_parser,
+       0, MANY, NULL,
+       doc: /* Return a new incremental JSON parser.
+Feed input to it with `json-parser-feed', in chunks split anywhere,
+to get the values in the input as they are completed.  This is
+useful to parse a stream of values, such as the output of a process
+that writes one JSON value per line, as it arrives.
+
+The arguments ARGS are keyword/argument pairs as for
+`json-parse-string', which see.  They specify how the parser
+represents the values it returns.
+usage: (json-make-parser &rest ARGS) */)
+     (ptrdiff_t nargs, Lisp_Object *args)
+{
   struct json_configuration conf =
     {json_object_hashtable, json_array_array, QCnull, QCfalse};
   json_parse_args (nargs, args, &conf, true);
 
-  ptrdiff_t point = PT_BYTE;
-  struct json_read_buffer_data data = {.point = point};
-  json_error_t error;
-  json_t *object = json_load_callback (json_read_buffer_callback, &data,
-                                       JSON_DISABLE_EOF_CHECK, &error);
-
-  if (object == NULL)
-    json_parse_error (&error);
-
-  /* Avoid leaking the object in case of further errors.  */
-  record_unwind_protect_ptr (json_release_object, object);
-
-  /* Convert and then move point only if everything succeeded.  */
-  Lisp_Object lisp = json_to_lisp (object, &conf);
+  struct Lisp_JSON_Parser *p
+    = ALLOCATE_ZEROED_PSEUDOVECTOR (struct Lisp_JSON_Parser, ready,
+				    PVEC_JSON_PARSER);
+  p->null_object = conf.null_object;
+  p->false_object = conf.false_object;
+  p->ready = Qnil;
+  p->object_type = conf.object_type;
+  p->array_type = conf.array_type;
+  Lisp_Object parser;
+  XSETPSEUDOVECTOR (parser, p, PVEC_JSON_PARSER);
+  return parser;
+}
 
-  /* Adjust point by how much we just read.  */
-  point += error.position;
-  SET_PT_BOTH (BYTE_TO_CHAR (point), point);
+DEFUN ("json-parser-p", Fjson_parser_p, Sjson_parser_p, 1, 1, 0,
+       doc: /* Return t if OBJECT is an incremental JSON parser.  */)
+  (Lisp_Object object)
+{
+  return JSON_PARSERP (object) ? Qt : Qnil;
+}
 
-  return unbind_to (count, lisp);
+DEFUN ("json-parser-feed", Fjson_parser_feed, Sjson_parser_feed, 2, 2, 0,
+       doc: /* Feed STRING to the incremental JSON parser PARSER.
+STRING is the next chunk of the input; it need not end at the end of
+a value, or even of a character.  Return the list of values that
+STRING completes, in the order they appear in the input, or nil if
+it completes none.  As for `json-parse-string', each value must be an
+array or an object.  Whitespace between values is ignored.
+
+If a value can't be parsed, signal a `json-parse-error'; the error
+data describe the position of the error within that value.  Input
+between values that doesn't start one is an error too, and the rest
+of the line it is on is skipped.  Either way, PARSER is left ready
+to continue with the input after the error, and the values already
+completed by STRING are returned by the next call.  */)
+  (Lisp_Object parser, Lisp_Object string)
+{
+  CHECK_JSON_PARSER (parser);
+  CHECK_STRING (string);
+  struct Lisp_JSON_Parser *p = XJSON_PARSER (parser);
+  Lisp_Object encoded = json_parse_input (string);
+  json_stream_append (p, SDATA (encoded), SBYTES (encoded));
+  json_stream_scan (p);
+  Lisp_Object values = Fnreverse (p->ready);
+  p->ready = Qnil;
+  return values;
 }
 
 /* Simplified version of 'define-error' that works with pure
@@ -1121,6 +2029,7 @@ syms_of_json (void)
 
   DEFSYM (Qstring_without_embedded_nulls_p, "string-without-embedded-nulls-p");
   DEFSYM (Qjson_value_p, "json-value-p");
+  DEFSYM (Qjson_parser_p, "json-parser-p");
 
   DEFSYM (Qjson_error, "json-error");
   DEFSYM (Qjson_out_of_memory, "json-out-of-memory");
@@ -1161,4 +2070,7 @@ syms_of_json (void)
   defsubr (&Sjson_insert);
   defsubr (&Sjson_parse_string);
   defsubr (&Sjson_parse_buffer);
+  defsubr (&Sjson_make_parser);
+  defsubr (&Sjson_parser_p);
+  defsubr (&Sjson_parser_feed);
 }
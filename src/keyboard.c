@@ -1294,6 +1294,11 @@ command_loop_1 (void)
       while (pending_malloc_warning)
 	display_malloc_warning ();
 
+      /* Say if text mapped from a file was lost or may have changed,
+	 in case nothing has said so yet.  */
+      report_lost_mapped_text ();
+      report_changed_mapped_text (current_buffer);
+
       Vdeactivate_mark = Qnil;
 
       /* Don't ignore mouse movements for more than a single command
@@ -1056,6 +1056,8 @@ DEFINE_GDB_SYMBOL_END (PSEUDOVECTOR_FLAG)
   PVEC_FRAME,
   PVEC_WINDOW,
   PVEC_BOOL_VECTOR,
+  PVEC_F64VECTOR,
+  PVEC_I64VECTOR,
   PVEC_BUFFER,
   PVEC_HASH_TABLE,
   PVEC_TERMINAL,
@@ -1068,6 +1070,7 @@ DEFINE_GDB_SYMBOL_END (PSEUDOVECTOR_FLAG)
   PVEC_MUTEX,
   PVEC_CONDVAR,
   PVEC_MODULE_FUNCTION,
+  PVEC_JSON_PARSER,
 
   /* These should be last, for internal_equal and sxhash_obj.  */
   PVEC_COMPILED,
@@ -1719,6 +1722,27 @@ PSEUDOVECTORP (Lisp_Object a, int code)
     bits_word data[FLEXIBLE_ARRAY_MEMBER];
   } GCALIGNED_STRUCT;
 
+/* A numeric vector is a kind of vectorlike holding unboxed numbers:
+   doubles in an f64vector (PVEC_F64VECTOR), and 64-bit integers in an
+   i64vector (PVEC_I64VECTOR).  Like a bool vector it contains no Lisp
+   objects, so the GC never looks inside it.  */
+
+union numeric_vector_elt
+{
+  double f;
+  int64_t i;
+};
+
+struct Lisp_Numeric_Vector
+  {
+    /* HEADER.SIZE is the vector's size field.  It doesn't have the real size,
+       just the subtype information.  */
+    union vectorlike_header header;
+    /* This is the number of elements.  */
+    EMACS_INT size;
+    union numeric_vector_elt data[FLEXIBLE_ARRAY_MEMBER];
+  } GCALIGNED_STRUCT;
+
 /* Some handy constants for calculating sizes
    and offsets, mostly of vectorlike objects.
 
@@ -1735,6 +1759,7 @@ PSEUDOVECTORP (Lisp_Object a, int code)
   {
     header_size = offsetof (struct Lisp_Vector, contents),
     bool_header_size = offsetof (struct Lisp_Bool_Vector, data),
+    numeric_vector_header_size = offsetof (struct Lisp_Numeric_Vector, data),
     word_size = sizeof (Lisp_Object)
   };
 
@@ -1826,6 +1851,51 @@ bool_vector_set (Lisp_Object a, EMACS_INT i, bool b)
     *addr &= ~ (1 << (i % BOOL_VECTOR_BITS_PER_CHAR));
 }
 
+INLINE bool
+F64VECTORP (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_F64VECTOR);
+}
+
+INLINE bool
+I64VECTORP (Lisp_Object a)
+{
+  return PSEUDOVECTORP (a, PVEC_I64VECTOR);
+}
+
+INLINE bool
+NUMERIC_VECTOR_P (Lisp_Object a)
+{
+  return F64VECTORP (a) || I64VECTORP (a);
+}
+
+INLINE void
+CHECK_NUMERIC_VECTOR (Lisp_Object x)
+{
+  CHECK_TYPE (NUMERIC_VECTOR_P (x), Qnumeric_vector_p, x);
+}
+
+INLINE struct Lisp_Numeric_Vector *
+XNUMERIC_VECTOR (Lisp_Object a)
+{
+  eassert (NUMERIC_VECTOR_P (a));
+  return XUNTAG (a, Lisp_Vectorlike, struct Lisp_Numeric_Vector);
+}
+
+INLINE EMACS_INT
+numeric_vector_size (Lisp_Object a)
+{
+  EMACS_INT size = XNUMERIC_VECTOR (a)->size;
+  eassume (0 <= size);
+  return size;
+}
+
+INLINE union numeric_vector_elt *
+numeric_vector_data (Lisp_Object a)
+{
+  return XNUMERIC_VECTOR (a)->data;
+}
+
 /* Conveniences for dealing with Lisp arrays.  */
 
 INLINE Lisp_Object
@@ -2906,7 +2976,8 @@ IMAGEP (Lisp_Object x)
 INLINE bool
 ARRAYP (Lisp_Object x)
 {
-  return VECTORP (x) || STRINGP (x) || CHAR_TABLE_P (x) || BOOL_VECTOR_P (x);
+  return (VECTORP (x) || STRINGP (x) || CHAR_TABLE_P (x) || BOOL_VECTOR_P (x)
+	  || NUMERIC_VECTOR_P (x));
 }
 
 INLINE void
@@ -3520,6 +3591,9 @@ modiff_to_integer (modiff_count a)
 				      Lisp_Object, Lisp_Object);
 extern Lisp_Object indirect_function (Lisp_Object);
 extern Lisp_Object find_symbol_value (Lisp_Object);
+extern Lisp_Object numeric_vector_ref (Lisp_Object, EMACS_INT);
+extern int64_t numeric_vector_i64 (Lisp_Object);
+extern void numeric_vector_set (Lisp_Object, EMACS_INT, Lisp_Object);
 enum Arith_Comparison {
   ARITH_EQUAL,
   ARITH_NOTEQUAL,
@@ -3555,6 +3629,9 @@ #define CONS_TO_INTEGER(cons, type, var)				\
                           enum Set_Internal_Bind);
 extern void set_default_internal (Lisp_Object, Lisp_Object,
                                   enum Set_Internal_Bind bindflag);
+extern Lisp_Object load_localized_binding (struct Lisp_Symbol *, bool *);
+extern void store_loaded_binding (struct Lisp_Symbol *, Lisp_Object,
+				  struct buffer *);
 extern Lisp_Object expt_integer (Lisp_Object, Lisp_Object);
 extern void syms_of_data (void);
 extern void swap_in_global_binding (struct Lisp_Symbol *);
@@ -3601,6 +3678,8 @@ #define CONS_TO_INTEGER(cons, type, var)				\
 Lisp_Object make_hash_table (struct hash_table_test, EMACS_INT, float, float,
                              Lisp_Object, bool);
 ptrdiff_t hash_lookup (struct Lisp_Hash_Table *, Lisp_Object, Lisp_Object *);
+ptrdiff_t hash_lookup_with_hash (struct Lisp_Hash_Table *, Lisp_Object,
+				 Lisp_Object);
 ptrdiff_t hash_put (struct Lisp_Hash_Table *, Lisp_Object, Lisp_Object,
 		    Lisp_Object);
 void hash_remove_from_table (struct Lisp_Hash_Table *, Lisp_Object);
@@ -3647,11 +3726,12 @@ verify (FLT_RADIX == 2 || FLT_RADIX == 16);
 extern int x_bitmap_mask (struct frame *, ptrdiff_t);
 extern void syms_of_image (void);
 
-#ifdef HAVE_JSON
 /* Defined in json.c.  */
-extern void init_json (void);
+extern void json_check_parse_args (Lisp_Object);
+extern void finalize_json_parser (struct Lisp_Vector *);
+extern Lisp_Object json_parse_rpc_message (const char *, ptrdiff_t,
+					   Lisp_Object);
 extern void syms_of_json (void);
-#endif
 
 /* Defined in insdel.c.  */
 extern void move_gap_both (ptrdiff_t, ptrdiff_t);
@@ -3862,6 +3942,7 @@ list4i (intmax_t a, intmax_t b, intmax_t c, intmax_t d)
 
 extern Lisp_Object make_uninit_bool_vector (EMACS_INT);
 extern Lisp_Object bool_vector_fill (Lisp_Object, Lisp_Object);
+extern Lisp_Object make_uninit_numeric_vector (enum pvec_type, EMACS_INT);
 extern AVOID string_overflow (void);
 extern Lisp_Object make_string (const char *, ptrdiff_t);
 extern Lisp_Object make_formatted_string (char *, const char *, ...)
@@ -4122,6 +4203,7 @@ xsignal (Lisp_Object error_symbol, Lisp_Object data)
 extern AVOID overflow_error (void);
 extern bool FUNCTIONP (Lisp_Object);
 extern Lisp_Object funcall_subr (struct Lisp_Subr *subr, ptrdiff_t numargs, Lisp_Object *arg_vector);
+extern Lisp_Object rest_args_list (ptrdiff_t, Lisp_Object *);
 extern Lisp_Object eval_sub (Lisp_Object form);
 extern Lisp_Object apply1 (Lisp_Object, Lisp_Object);
 extern Lisp_Object call0 (Lisp_Object);
@@ -4557,6 +4639,7 @@ maybe_disable_address_randomization (int argc, char **argv)
 }
 #endif
 extern int emacs_exec_file (char const *, char *const *, char *const *);
+extern bool emacs_exec_file_special_p (void);
 extern void init_standard_fds (void);
 extern char *emacs_get_current_dir_name (void);
 extern void stuff_char (char c);
@@ -4582,6 +4665,18 @@ maybe_disable_address_randomization (int argc, char **argv)
 extern int emacs_open_noquit (const char *, int, int);
 extern int emacs_pipe (int[2]);
 extern int emacs_close (int);
+
+/* Maximum number of bytes to read or write in a single system call.
+   This works around a serious bug in Linux kernels before 2.6.16; see
+   <https://bugzilla.redhat.com/show_bug.cgi?format=multiple&id=612839>.
+   It's likely to work around similar bugs in other operating systems, so do it
+   on all platforms.  Round INT_MAX down to a page size, with the conservative
+   assumption that page sizes are at most 2**18 bytes (any kernel with a
+   page size larger than that shouldn't have the bug).  */
+#ifndef MAX_RW_COUNT
+# define MAX_RW_COUNT (INT_MAX >> 18 << 18)
+#endif
+
 extern ptrdiff_t emacs_read (int, void *, ptrdiff_t);
 extern ptrdiff_t emacs_read_quit (int, void *, ptrdiff_t);
 extern ptrdiff_t emacs_write (int, void const *, ptrdiff_t);
@@ -647,6 +647,7 @@ read_emacs_mule_char (int c, int (*readbyte) (int, Lisp_Object), Lisp_Object rea
 
 static Lisp_Object read_list (bool, Lisp_Object);
 static Lisp_Object read_vector (Lisp_Object, bool);
+static Lisp_Object read_numeric_vector (Lisp_Object, bool);
 
 static Lisp_Object substitute_object_recurse (struct subst *, Lisp_Object);
 static void substitute_in_interval (INTERVAL, void *);
@@ -2926,6 +2927,14 @@ read1 (Lisp_Object readcharfun, int *pch, bool first_in_list)
 	  UNREAD (c);
 	  invalid_syntax ("#", readcharfun);
 	}
+      if (c == 'f' || c == 'i')
+	{
+	  /* Accept an f64vector #f64[1.0 2.0] or an i64vector #i64[1 2].  */
+	  bool f64 = c == 'f';
+	  if (READCHAR == '6' && READCHAR == '4' && READCHAR == '[')
+	    return read_numeric_vector (readcharfun, f64);
+	  invalid_syntax (f64 ? "#f" : "#i", readcharfun);
+	}
       if (c == '^')
 	{
 	  c = READCHAR;
@@ -3700,7 +3709,7 @@ substitute_object_recurse (struct subst *subst, Lisp_Object subtree)
     case Lisp_Vectorlike:
       {
 	ptrdiff_t i = 0, length = 0;
-	if (BOOL_VECTOR_P (subtree))
+	if (BOOL_VECTOR_P (subtree) || NUMERIC_VECTOR_P (subtree))
 	  return subtree;		/* No sub-objects anyway.  */
 	else if (CHAR_TABLE_P (subtree) || SUB_CHAR_TABLE_P (subtree)
 		 || COMPILEDP (subtree) || HASH_TABLE_P (subtree)
@@ -3894,6 +3903,27 @@ string_to_number (char const *string, int base, ptrdiff_t *plen)
 }
 
 
+/* Read the elements of an f64vector (if F64) or an i64vector, after
+   the opening '#f64[' or '#i64['.  */
+
+static Lisp_Object
+read_numeric_vector (Lisp_Object readcharfun, bool f64)
+{
+  Lisp_Object tem = read_list (1, readcharfun);
+  ptrdiff_t size = list_length (tem);
+  Lisp_Object vector
+    = make_uninit_numeric_vector (f64 ? PVEC_F64VECTOR : PVEC_I64VECTOR, size);
+
+  for (ptrdiff_t i = 0; i < size; i++)
+    {
+      numeric_vector_set (vector, i, XCAR (tem));
+      struct Lisp_Cons *otem = XCONS (tem);
+      tem = XCDR (tem);
+      free_cons (otem);
+    }
+  return vector;
+}
+
 static Lisp_Object
 read_vector (Lisp_Object readcharfun, bool bytecodeflag)
 {
@@ -67,6 +67,14 @@ Updated by Christian Limpach (chris@nice.ch)
 #include "process.h"
 #endif
 
+#ifdef HAVE_EPOLL
+#include "epollselect.h"
+/* GNUstep on GNU/Linux can wait with epoll.  */
+#define ns_select_func epoll_select
+#else
+#define ns_select_func pselect
+#endif
+
 #ifdef NS_IMPL_COCOA
 #include "macfont.h"
 #include <Carbon/Carbon.h>
@@ -4725,7 +4733,7 @@ in certain situations (rapid incoming events).
   if (NSApp == nil
       || ![NSThread isMainThread]
       || (timeout && timeout->tv_sec == 0 && timeout->tv_nsec == 0))
-    return thread_select(pselect, nfds, readfds, writefds,
+    return thread_select(ns_select_func, nfds, readfds, writefds,
                          exceptfds, timeout, sigmask);
   else
     {
@@ -5412,6 +5420,11 @@ static Lisp_Object ns_new_font (struct frame *f, Lisp_Object font_object,
         }
 
       fcntl (selfds[0], F_SETFL, O_NONBLOCK|fcntl (selfds[0], F_GETFL));
+#ifdef HAVE_EPOLL
+      /* fd_handler waits for this along with the descriptors of
+         process.c.  */
+      epoll_select_watch_aux (selfds[0], EPOLL_SELECT_READ);
+#endif
       FD_ZERO (&select_readfds);
       FD_ZERO (&select_writefds);
       pthread_mutex_init (&select_mutex, NULL);
@@ -6199,7 +6212,7 @@ - (void)fd_handler:(id)unused
           FD_SET (selfds[0], &readfds);
           if (selfds[0] >= nfds) nfds = selfds[0]+1;
 
-          result = pselect (nfds, &readfds, wfds, NULL, tmo, NULL);
+          result = ns_select_func (nfds, &readfds, wfds, NULL, tmo, NULL);
 
           if (result == 0)
             ns_send_appdefined (-2);
@@ -2882,7 +2882,7 @@ dump_vectorlike (struct dump_context *ctx,
                  Lisp_Object lv,
                  dump_off offset)
 {
-#if CHECK_STRUCTS && !defined HASH_pvec_type_A4A6E9984D
+#if CHECK_STRUCTS && !defined HASH_pvec_type_3B6CF96D55
 # error "pvec_type changed. See CHECK_STRUCTS comment in config.h."
 #endif
   const struct Lisp_Vector *v = XVECTOR (lv);
@@ -2906,6 +2906,8 @@ dump_vectorlike (struct dump_context *ctx,
       offset = dump_vectorlike_generic (ctx, &v->header);
       break;
     case PVEC_BOOL_VECTOR:
+    case PVEC_F64VECTOR:
+    case PVEC_I64VECTOR:
       offset = dump_bool_vector(ctx, v);
       break;
     case PVEC_HASH_TABLE:
@@ -2959,6 +2961,8 @@ dump_vectorlike (struct dump_context *ctx,
       error_unsupported_dump_object (ctx, lv, "condvar");
     case PVEC_MODULE_FUNCTION:
       error_unsupported_dump_object (ctx, lv, "module function");
+    case PVEC_JSON_PARSER:
+      error_unsupported_dump_object (ctx, lv, "JSON parser");
     default:
       error_unsupported_dump_object(ctx, lv, "weird pseudovector");
     }
@@ -2999,7 +3003,8 @@ dump_object (struct dump_context *ctx, Lisp_Object object)
   if (offset > 0)
     return offset;  /* Object already dumped.  */
 
-  bool cold = BOOL_VECTOR_P (object) || FLOATP (object);
+  bool cold = (BOOL_VECTOR_P (object) || NUMERIC_VECTOR_P (object)
+	       || FLOATP (object));
   if (cold && ctx->flags.defer_cold_objects)
     {
       if (offset != DUMP_OBJECT_ON_COLD_QUEUE)
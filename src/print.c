@@ -1511,6 +1511,39 @@ print_vectorlike (Lisp_Object obj, Lisp_Object printcharfun, bool escapeflag,
       }
       break;
 
+    case PVEC_F64VECTOR:
+    case PVEC_I64VECTOR:
+      {
+	EMACS_INT size = numeric_vector_size (obj);
+	EMACS_INT real_size = size;
+	union numeric_vector_elt *data = numeric_vector_data (obj);
+	bool f64 = F64VECTORP (obj);
+
+	print_c_string (f64 ? "#f64[" : "#i64[", printcharfun);
+
+	/* Don't print more elements than the specified maximum.  */
+	if (FIXNATP (Vprint_length)
+	    && XFIXNAT (Vprint_length) < size)
+	  size = XFIXNAT (Vprint_length);
+
+	for (EMACS_INT i = 0; i < size; i++)
+	  {
+	    maybe_quit ();
+	    char numbuf[max (FLOAT_TO_STRING_BUFSIZE,
+			     INT_STRLEN_BOUND (int64_t) + 1)];
+	    int len = (f64
+		       ? float_to_string (numbuf, data[i].f)
+		       : sprintf (numbuf, "%"PRId64, data[i].i));
+	    if (i)
+	      printchar (' ', printcharfun);
+	    strout (numbuf, len, len, printcharfun);
+	  }
+	if (size < real_size)
+	  print_c_string (" ...", printcharfun);
+	printchar (']', printcharfun);
+      }
+      break;
+
     case PVEC_SUBR:
       print_c_string ("#<subr ", printcharfun);
       print_c_string (XSUBR (obj)->symbol_name, printcharfun);
@@ -1729,6 +1762,15 @@ print_vectorlike (Lisp_Object obj, Lisp_Object printcharfun, bool escapeflag,
       printchar ('>', printcharfun);
       break;
 
+    case PVEC_JSON_PARSER:
+      {
+	print_c_string ("#<json-parser ", printcharfun);
+	int len = sprintf (buf, "%p", XVECTOR (obj));
+	strout (buf, len, len, printcharfun);
+	printchar ('>', printcharfun);
+      }
+      break;
+
     case PVEC_RECORD:
       {
 	ptrdiff_t size = PVSIZE (obj);
@@ -65,6 +65,9 @@ #define HAVE_LOCAL_SOCKETS
 #endif
 
 #include <sys/ioctl.h>
+#ifdef HAVE_WRITEV
+#include <sys/uio.h>
+#endif
 #if defined (HAVE_NET_IF_H)
 #include <net/if.h>
 #endif /* HAVE_NET_IF_H */
@@ -89,6 +92,7 @@ #define HAVE_LOCAL_SOCKETS
 #endif
 
 #include <c-ctype.h>
+#include <c-strcase.h>
 #include <flexmember.h>
 #include <sig2str.h>
 #include <verify.h>
@@ -126,6 +130,14 @@ #define HAVE_LOCAL_SOCKETS
 #endif
 #endif
 
+#ifdef HAVE_EPOLL
+#include "epollselect.h"
+/* Wait with epoll_select where pselect would otherwise do.  */
+#define process_select epoll_select
+#else
+#define process_select pselect
+#endif
+
 #if defined HAVE_GETADDRINFO_A || defined HAVE_GNUTLS
 /* This is 0.1s in nanoseconds. */
 #define ASYNC_RETRY_NSEC 100000000
@@ -417,6 +429,16 @@ pset_write_queue (struct Lisp_Process *p, Lisp_Object val)
   p->write_queue = val;
 }
 static void
+pset_framing (struct Lisp_Process *p, Lisp_Object val)
+{
+  p->framing = val;
+}
+static void
+pset_framing_buf (struct Lisp_Process *p, Lisp_Object val)
+{
+  p->framing_buf = val;
+}
+static void
 pset_stderrproc (struct Lisp_Process *p, Lisp_Object val)
 {
   p->stderrproc = val;
@@ -459,6 +481,18 @@ make_lisp_proc (struct Lisp_Process *p)
   struct thread_state *waiting_thread;
 } fd_callback_info[FD_SETSIZE];
 
+/* Tell epoll_select how FD is monitored now.  */
+
+static void
+update_epoll_watch (int fd)
+{
+#ifdef HAVE_EPOLL
+  int flags = fd_callback_info[fd].flags;
+  epoll_select_watch (fd, ((flags & FOR_READ ? EPOLL_SELECT_READ : 0)
+			   | (flags & FOR_WRITE ? EPOLL_SELECT_WRITE : 0)));
+#endif
+}
+
 
 /* Add a file descriptor FD to be monitored for when read is possible.
    When read is possible, call FUNC with argument DATA.  */
@@ -481,6 +515,7 @@ add_non_keyboard_read_fd (int fd)
 
   fd_callback_info[fd].flags &= ~KEYBOARD_FD;
   fd_callback_info[fd].flags |= FOR_READ;
+  update_epoll_watch (fd);
   if (fd > max_desc)
     max_desc = fd;
 }
@@ -505,6 +540,11 @@ delete_read_fd (int fd)
     {
       fd_callback_info[fd].func = 0;
       fd_callback_info[fd].data = 0;
+      /* A thread may still be in select on FD.  Forget that now: if
+	 FD is above max_desc by the time that thread returns, it will
+	 not clear the entry itself, and a later user of the same
+	 descriptor would never be waited for.  */
+      fd_callback_info[fd].waiting_thread = NULL;
     }
 }
 
@@ -519,6 +559,7 @@ add_write_fd (int fd, fd_callback func, void *data)
   fd_callback_info[fd].func = func;
   fd_callback_info[fd].data = data;
   fd_callback_info[fd].flags |= FOR_WRITE;
+  update_epoll_watch (fd);
   if (fd > max_desc)
     max_desc = fd;
 }
@@ -530,6 +571,7 @@ add_non_blocking_write_fd (int fd)
   eassert (fd_callback_info[fd].func == NULL);
 
   fd_callback_info[fd].flags |= FOR_WRITE | NON_BLOCKING_CONNECT_FD;
+  update_epoll_watch (fd);
   if (fd > max_desc)
     max_desc = fd;
   ++num_pending_connects;
@@ -564,10 +606,13 @@ delete_write_fd (int fd)
 	emacs_abort ();
     }
   fd_callback_info[fd].flags &= ~(FOR_WRITE | NON_BLOCKING_CONNECT_FD);
+  update_epoll_watch (fd);
   if (fd_callback_info[fd].flags == 0)
     {
       fd_callback_info[fd].func = 0;
       fd_callback_info[fd].data = 0;
+      /* See delete_read_fd.  */
+      fd_callback_info[fd].waiting_thread = NULL;
 
       if (fd == max_desc)
 	recompute_max_desc ();
@@ -957,9 +1002,23 @@ update_processes_for_thread_death (Lisp_Object dying_thread)
 	    fd_callback_info[proc->outfd].thread = NULL;
 	}
     }
+
+#ifdef HAVE_EPOLL
+  epoll_select_thread_exit ();
+#endif
 }
 
 #ifdef HAVE_GETADDRINFO_A
+/* Wake up `wait_reading_process_output' so that it notices that an
+   asynchronous DNS request has completed.  This is called in a thread
+   of the resolver's own, so it must not touch any Lisp data.  */
+
+static void
+dns_request_notify (union sigval ignored)
+{
+  child_signal_notify ();
+}
+
 static void
 free_dns_request (Lisp_Object proc)
 {
@@ -1671,6 +1730,25 @@ DEFUN ("process-list", Fprocess_list, Sprocess_list, 0, 0, 0,
 
 /* Starting asynchronous inferior processes.  */
 
+/* Return the `:framing' argument in CONTACT, after checking it.  */
+
+static Lisp_Object
+process_framing (Lisp_Object contact)
+{
+  Lisp_Object framing = Fplist_get (contact, QCframing);
+
+  if (NILP (framing) || EQ (framing, Qcontent_length))
+    return framing;
+  if (EQ (framing, Qjsonrpc)
+      || (CONSP (framing) && EQ (XCAR (framing), Qjsonrpc)))
+    {
+      if (CONSP (framing))
+	json_check_parse_args (XCDR (framing));
+      return framing;
+    }
+  signal_error ("Unknown process framing", framing);
+}
+
 DEFUN ("make-process", Fmake_process, Smake_process, 0, MANY, 0,
        doc: /* Start a program in a subprocess.  Return the process object for it.
 
@@ -1724,6 +1802,17 @@ DEFUN ("make-process", Fmake_process, Smake_process, 0, MANY, 0,
 and invoke that file name handler to make the process.  If there is no
 such handler, proceed as if FILE-HANDLER were nil.
 
+:framing FRAMING -- If FRAMING is non-nil, the process output is a
+sequence of messages, each consisting of headers that include
+`Content-Length', an empty line, and that many bytes of content, as in
+JSON-RPC and the Language Server Protocol.  Emacs splits the output
+into messages and calls the filter once per message, with the content
+in place of the output string.  If FRAMING is `content-length', the
+content is passed as a string decoded as UTF-8.  If FRAMING is
+`jsonrpc' or (jsonrpc . ARGS), the content is parsed as JSON and the
+result is passed; ARGS are keyword arguments as for
+`json-parse-string'.
+
 usage: (make-process &rest ARGS)  */)
   (ptrdiff_t nargs, Lisp_Object *args)
 {
@@ -1746,6 +1835,8 @@ DEFUN ("make-process", Fmake_process, Smake_process, 0, MANY, 0,
         return CALLN (Fapply, file_handler, Qmake_process, contact);
     }
 
+  Lisp_Object framing = process_framing (contact);
+
   buffer = Fplist_get (contact, QCbuffer);
   if (!NILP (buffer))
     buffer = Fget_buffer_create (buffer, Qnil);
@@ -1799,6 +1890,7 @@ DEFUN ("make-process", Fmake_process, Smake_process, 0, MANY, 0,
   pset_buffer (XPROCESS (proc), buffer);
   pset_sentinel (XPROCESS (proc), Fplist_get (contact, QCsentinel));
   pset_filter (XPROCESS (proc), Fplist_get (contact, QCfilter));
+  pset_framing (XPROCESS (proc), framing);
   pset_command (XPROCESS (proc), Fcopy_sequence (command));
 
   if (!query_on_exit)
@@ -3764,6 +3856,10 @@ DEFUN ("make-network-process", Fmake_network_process, Smake_network_process,
 
 :sentinel SENTINEL -- Install SENTINEL as the process sentinel.
 
+:framing FRAMING -- Split the output into messages before passing it
+to the filter; see `make-process'.  Connections accepted by a server
+inherit its framing.
+
 :log LOG -- Install LOG as the server process log function.  This
 function is called when the server accepts a network connection from a
 client.  The arguments are SERVER, CLIENT, and MESSAGE, where SERVER
@@ -3884,6 +3980,7 @@ DEFUN ("make-network-process", Fmake_network_process, Smake_network_process,
   buffer = Fplist_get (contact, QCbuffer);
   filter = Fplist_get (contact, QCfilter);
   sentinel = Fplist_get (contact, QCsentinel);
+  Lisp_Object framing = process_framing (contact);
   use_external_socket_p = Fplist_get (contact, QCuse_external_socket);
   Lisp_Object server = Fplist_get (contact, QCserver);
   bool nowait = !NILP (Fplist_get (contact, QCnowait));
@@ -4043,7 +4140,14 @@ DEFUN ("make-network-process", Fmake_network_process, Smake_network_process,
 	  strcpy (req->str, SSDATA (host));
 	  strcpy (req->str + hostlen + 1, portstring);
 
-	  int ret = getaddrinfo_a (GAI_NOWAIT, &dns_request, 1, NULL);
+	  /* Have the resolver wake us up when it is done.  */
+	  child_signal_init ();
+	  struct sigevent sev;
+	  memset (&sev, 0, sizeof sev);
+	  sev.sigev_notify = SIGEV_THREAD;
+	  sev.sigev_notify_function = dns_request_notify;
+
+	  int ret = getaddrinfo_a (GAI_NOWAIT, &dns_request, 1, &sev);
 	  if (ret)
 	    error ("%s/%s getaddrinfo_a error %d",
 		   SSDATA (host), portstring, ret);
@@ -4136,6 +4240,7 @@ DEFUN ("make-network-process", Fmake_network_process, Smake_network_process,
   pset_buffer (p, buffer);
   pset_sentinel (p, sentinel);
   pset_filter (p, filter);
+  pset_framing (p, framing);
   pset_log (p, Fplist_get (contact, QClog));
   if (tem = Fplist_get (contact, QCnoquery), !NILP (tem))
     p->kill_without_query = 1;
@@ -4576,11 +4681,23 @@ network_lookup_address_info_1 (Lisp_Object host, const char *service,
   init_winsock (TRUE);
 #endif
 
-  ret = getaddrinfo (SSDATA (host), service, hints, res);
+  /* Let other threads run while the lookup blocks.  The strings are
+     copied first, since their data can move while we don't hold the
+     global lock.  */
+  USE_SAFE_ALLOCA;
+  char *node = SAFE_ALLOCA (SBYTES (host) + 1);
+  memcpy (node, SSDATA (host), SBYTES (host) + 1);
+  char *serv = NULL;
+  if (service)
+    {
+      ptrdiff_t servlen = strlen (service);
+      serv = SAFE_ALLOCA (servlen + 1);
+      memcpy (serv, service, servlen + 1);
+    }
+  ret = thread_getaddrinfo (getaddrinfo, node, serv, hints, res);
   if (ret)
     {
-      if (service == NULL)
-        service = "0";
+      Lisp_Object servname = build_string (serv ? serv : "0");
 #ifdef HAVE_GAI_STRERROR
       synchronize_system_messages_locale ();
       char const *str = gai_strerror (ret);
@@ -4588,14 +4705,13 @@ network_lookup_address_info_1 (Lisp_Object host, const char *service,
         str = SSDATA (code_convert_string_norecord
                       (build_string (str), Vlocale_coding_system, 0));
       AUTO_STRING (format, "%s/%s %s");
-      msg = CALLN (Fformat, format, host, build_string (service),
-		   build_string (str));
+      msg = CALLN (Fformat, format, host, servname, build_string (str));
 #else
       AUTO_STRING (format, "%s/%s getaddrinfo error %d");
-      msg = CALLN (Fformat, format, host, build_string (service),
-		   make_int (ret));
+      msg = CALLN (Fformat, format, host, servname, make_int (ret));
 #endif
     }
+  SAFE_FREE ();
    return msg;
 }
 
@@ -4949,6 +5065,7 @@ server_accept_connection (Lisp_Object server, int channel)
   pset_buffer (p, buffer);
   pset_sentinel (p, ps->sentinel);
   pset_filter (p, ps->filter);
+  pset_framing (p, ps->framing);
   eassert (NILP (p->command));
   eassert (p->pid == 0);
 
@@ -5135,6 +5252,10 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 {
   int channel, nfds;
   fd_set Available;
+  /* The descriptors the last wait reported ready, and their number,
+     or -1 if every descriptor up to max_desc must be checked.  */
+  int ready_fds[64];
+  int nready = -1;
   fd_set Writeok;
   bool check_write;
   int check_delay;
@@ -5335,7 +5456,7 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	    FD_CLR (fd, &Atemp);
 
 	  timeout = make_timespec (0, 0);
-	  if ((thread_select (pselect, max_desc + 1,
+	  if ((thread_select (process_select, max_desc + 1,
 			      &Atemp,
 			      (num_pending_connects > 0 ? &Ctemp : NULL),
 			      NULL, &timeout, NULL)
@@ -5557,6 +5678,18 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 	    timeout = make_timespec (0, 0);
 #endif
 
+#ifdef HAVE_EPOLL
+	  /* epoll_select reports only watched descriptors, and the
+	     descriptor of a stopped process is not watched.  */
+	  int unwatched_fd = -1;
+	  if (wait_proc && just_wait_proc && 0 <= wait_proc->infd
+	      && (fd_callback_info[wait_proc->infd].flags & FOR_READ) == 0)
+	    {
+	      unwatched_fd = wait_proc->infd;
+	      epoll_select_watch (unwatched_fd, EPOLL_SELECT_READ);
+	    }
+#endif
+
 	  /* Non-macOS HAVE_GLIB builds call thread_select in xgselect.c.  */
 #if defined HAVE_GLIB && !defined HAVE_NS
 	  nfds = xg_select (max_desc + 1,
@@ -5568,12 +5701,28 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 			    &Available, (check_write ? &Writeok : 0),
 			    NULL, &timeout, NULL);
 #else  /* !HAVE_GLIB */
-	  nfds = thread_select (pselect, max_desc + 1,
+	  nfds = thread_select (process_select, max_desc + 1,
 				&Available,
 				(check_write ? &Writeok : 0),
 				NULL, &timeout, NULL);
 #endif	/* !HAVE_GLIB */
 
+	  nready = -1;
+#ifdef HAVE_EPOLL
+	  if (0 <= unwatched_fd)
+	    update_epoll_watch (unwatched_fd);
+# ifndef HAVE_NS
+	  /* ns_select waits in a thread of its own, so only the others
+	     leave the ready descriptors with this thread.  If too many
+	     are ready to fit in ready_fds, scanning up to max_desc costs
+	     little more per ready descriptor.  */
+	  if (0 < nfds)
+	    nready = epoll_select_ready_fds (ready_fds, ARRAYELTS (ready_fds));
+	  if (ARRAYELTS (ready_fds) < nready)
+	    nready = -1;
+# endif
+#endif
+
 #ifdef HAVE_GNUTLS
 	  /* Merge tls_available into Available. */
 	  if (tls_nfds > 0)
@@ -5585,11 +5734,14 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 		  Available = tls_available;
 		}
 	      else if (nfds > 0)
-		/* Slow path, merge one by one.  Note: nfds does not need
-		   to be accurate, just positive is enough. */
-		for (channel = 0; channel < FD_SETSIZE; ++channel)
-		  if (FD_ISSET(channel, &tls_available))
-		    FD_SET(channel, &Available);
+		{
+		  /* Slow path, merge one by one.  Note: nfds does not
+		     need to be accurate, just positive is enough. */
+		  for (channel = 0; channel < FD_SETSIZE; ++channel)
+		    if (FD_ISSET(channel, &tls_available))
+		      FD_SET(channel, &Available);
+		  nready = -1;
+		}
 	    }
 #endif
 	}
@@ -5710,8 +5862,9 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
       if (no_avail || nfds == 0)
 	continue;
 
-      for (channel = 0; channel <= max_desc; ++channel)
+      for (int i = 0; nready < 0 ? i <= max_desc : i < nready; i++)
         {
+	  channel = nready < 0 ? i : ready_fds[i];
           struct fd_callback_data *d = &fd_callback_info[channel];
           if (d->func
 	      && ((d->flags & FOR_READ
@@ -5721,8 +5874,9 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
             d->func (channel, d->data);
 	}
 
-      for (channel = 0; channel <= max_desc; channel++)
+      for (int i = 0; nready < 0 ? i <= max_desc : i < nready; i++)
 	{
+	  channel = nready < 0 ? i : ready_fds[i];
 	  if (FD_ISSET (channel, &Available)
 	      && ((fd_callback_info[channel].flags & (KEYBOARD_FD | PROCESS_FD))
 		  == PROCESS_FD))
@@ -5877,10 +6031,12 @@ wait_reading_process_output (intmax_t time_limit, int nsecs, int read_kbd,
 		{
 #ifdef HAVE_GNUTLS
 		  /* If we have an incompletely set up TLS connection,
-		     then defer the sentinel signaling until
-		     later. */
-		  if (NILP (p->gnutls_boot_parameters)
-		      && !p->gnutls_p)
+		     then defer the sentinel signaling until later.  If
+		     the TLS negotiation already finished, it left the
+		     signaling to us.  */
+		  if ((NILP (p->gnutls_boot_parameters)
+		       && !p->gnutls_p)
+		      || p->gnutls_initstage == GNUTLS_STAGE_READY)
 #endif
 		    {
 		      pset_status (p, Qrun);
@@ -5940,19 +6096,60 @@ read_process_output_error_handler (Lisp_Object error_val)
   return Qt;
 }
 
+static void insert_process_output (struct Lisp_Process *, Lisp_Object,
+				   struct coding_system *,
+				   const char *, ptrdiff_t);
+static bool plain_default_filter_p (Lisp_Object);
+
+/* Decode process output into the process buffer, on behalf of the
+   default filter.  ARGS are the process, the coding system and the
+   output as mint pointers, and the output's length in bytes.  */
+
+static Lisp_Object
+read_process_output_insert (ptrdiff_t nargs, Lisp_Object *args)
+{
+  insert_process_output (XPROCESS (args[0]), Qnil, xmint_pointer (args[1]),
+			 xmint_pointer (args[2]), XFIXNUM (args[3]));
+  return Qnil;
+}
+
+static Lisp_Object
+read_process_output_insert_error_handler (Lisp_Object error_val,
+					  ptrdiff_t nargs, Lisp_Object *args)
+{
+  return read_process_output_error_handler (error_val);
+}
+
 static void
 read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 				    ssize_t nbytes,
 				    struct coding_system *coding);
 
+/* Read at most NBYTE bytes of output of P from CHANNEL into BUF,
+   decrypting it if P is a TLS connection.  Return the number of bytes
+   read, or -1 (setting errno) on error.  */
+
+static ptrdiff_t
+read_process_channel (struct Lisp_Process *p, int channel,
+		      char *buf, ptrdiff_t nbyte)
+{
+#ifdef HAVE_GNUTLS
+  if (p->gnutls_p && p->gnutls_state)
+    return emacs_gnutls_read (p, buf, nbyte);
+#endif
+  return emacs_read (channel, buf, nbyte);
+}
+
 /* Read pending output from the process channel,
    starting with our buffered-ahead character if we have one.
    Yield number of decoded characters read,
    or -1 (setting errno) if there is a read error.
 
-   This function reads at most read_process_output_max bytes.
-   If you want to read all available subprocess output,
-   you must call it repeatedly until it returns zero.
+   This function reads at most P->read_output_size bytes, which adapts
+   to the output rate between read_process_output_max and
+   read_process_output_adaptive_max.  If you want to read all
+   available subprocess output, you must call it repeatedly until it
+   returns zero.
 
    The characters read are decoded according to PROC's coding-system
    for decoding.  */
@@ -5965,7 +6162,13 @@ read_process_output (Lisp_Object proc, int channel)
   eassert (0 <= channel && channel < FD_SETSIZE);
   struct coding_system *coding = proc_decode_coding_system[channel];
   int carryover = p->decoding_carryover;
-  ptrdiff_t readmax = clip_to_bounds (1, read_process_output_max, PTRDIFF_MAX);
+  ptrdiff_t readmin = clip_to_bounds (1, read_process_output_max,
+				     PTRDIFF_MAX / 2);
+  ptrdiff_t readlimit = clip_to_bounds (readmin,
+				       read_process_output_adaptive_max,
+				       PTRDIFF_MAX / 2);
+  ptrdiff_t readmax = clip_to_bounds (readmin, p->read_output_size,
+				      readlimit);
   ptrdiff_t count = SPECPDL_INDEX ();
   Lisp_Object odeactivate;
   char *chars;
@@ -5996,14 +6199,25 @@ read_process_output (Lisp_Object proc, int channel)
 	  chars[carryover] = proc_buffered_char[channel];
 	  proc_buffered_char[channel] = -1;
 	}
-#ifdef HAVE_GNUTLS
-      if (p->gnutls_p && p->gnutls_state)
-	nbytes = emacs_gnutls_read (p, chars + carryover + buffered,
-				    readmax - buffered);
-      else
-#endif
-	nbytes = emacs_read (channel, chars + carryover + buffered,
-			     readmax - buffered);
+      nbytes = read_process_channel (p, channel, chars + carryover + buffered,
+				     readmax - buffered);
+
+      /* If the process is producing output quickly, drain what is
+	 already readable so that the filter gets it in one call.
+	 Stop after a short read, so that a trickle of output does
+	 not cost an extra read that fails with EAGAIN.  A TLS read
+	 returns at most one record, so this also collects the
+	 records that arrived together.  */
+      ptrdiff_t last = nbytes;
+      while (read_process_output_coalesce
+	     && readmin <= last && nbytes < readmax - buffered)
+	{
+	  last = read_process_channel (p, channel,
+				       chars + carryover + buffered + nbytes,
+				       readmax - buffered - nbytes);
+	  if (last > 0)
+	    nbytes += last;
+	}
       if (nbytes > 0 && p->adaptive_read_buffering)
 	{
 	  int delay = p->read_output_delay;
@@ -6029,6 +6243,13 @@ read_process_output (Lisp_Object proc, int channel)
 	      process_output_skip = 1;
 	    }
 	}
+
+      /* Double the buffer while reads fill it, and halve it again
+	 once they use less than a quarter of it.  */
+      if (nbytes == readmax - buffered)
+	p->read_output_size = min (2 * readmax, readlimit);
+      else if (0 <= nbytes && nbytes < readmax / 4)
+	p->read_output_size = max (readmax / 2, readmin);
       nbytes += buffered;
       nbytes += buffered && nbytes <= 0;
     }
@@ -6069,47 +6290,47 @@ read_process_output (Lisp_Object proc, int channel)
   return nbytes;
 }
 
+/* Decode NBYTES bytes of output of process P at CHARS using CODING,
+   and pass the result to P's filter.  */
+
 static void
-read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
-				    ssize_t nbytes,
-				    struct coding_system *coding)
+decode_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
+				      ssize_t nbytes,
+				      struct coding_system *coding)
 {
   Lisp_Object outstream = p->filter;
   Lisp_Object text;
-  bool outer_running_asynch_code = running_asynch_code;
-  int waiting = waiting_for_user_input_p;
-
-#if 0
-  Lisp_Object obuffer, okeymap;
-  XSETBUFFER (obuffer, current_buffer);
-  okeymap = BVAR (current_buffer, keymap);
-#endif
 
-  /* We inhibit quit here instead of just catching it so that
-     hitting ^G when a filter happens to be running won't screw
-     it up.  */
-  specbind (Qinhibit_quit, Qt);
-  specbind (Qlast_nonmenu_event, Qt);
-
-  /* In case we get recursively called,
-     and we already saved the match data nonrecursively,
-     save the same match data in safely recursive fashion.  */
-  if (outer_running_asynch_code)
+  /* If the output would just be inserted into the process buffer by
+     the default filter, decode it straight into that buffer rather
+     than into a string that is then copied.  */
+  struct buffer *b = BUFFERP (p->buffer) ? XBUFFER (p->buffer) : NULL;
+  bool direct = (nbytes > 0
+		 && plain_default_filter_p (outstream)
+		 && b && BUFFER_LIVE_P (b)
+		 && !NILP (BVAR (b, enable_multibyte_characters))
+		 && !CODING_REQUIRE_DETECTION (coding)
+		 && NILP (CODING_ATTR_POST_READ (CODING_ID_ATTRS (coding->id))));
+  if (direct)
+    {
+      Lisp_Object args[4];
+      args[0] = make_lisp_proc (p);
+      args[1] = make_mint_ptr (coding);
+      args[2] = make_mint_ptr (chars);
+      args[3] = make_fixnum (nbytes);
+      /* If a change hook signals before anything is decoded, do not
+	 keep the carryover of the previous call.  */
+      coding->carryover_bytes = 0;
+      internal_condition_case_n (read_process_output_insert, 4, args,
+				 !NILP (Vdebug_on_error) ? Qnil : Qerror,
+				 read_process_output_insert_error_handler);
+      text = Qnil;
+    }
+  else
     {
-      Lisp_Object tem;
-      /* Don't clobber the CURRENT match data, either!  */
-      tem = Fmatch_data (Qnil, Qnil, Qnil);
-      restore_search_regs ();
-      record_unwind_save_match_data ();
-      Fset_match_data (tem, Qt);
+      decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
+      text = coding->dst_object;
     }
-
-  /* For speed, if a search happens within this code,
-     save the match data in a special nonrecursive fashion.  */
-  running_asynch_code = 1;
-
-  decode_coding_c_string (coding, (unsigned char *) chars, nbytes, Qt);
-  text = coding->dst_object;
   Vlast_coding_system_used = CODING_ID_NAME (coding->id);
   /* A new coding system might be found.  */
   if (!EQ (p->decode_coding_system, Vlast_coding_system_used))
@@ -6146,7 +6367,7 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 	      coding->carryover_bytes);
       p->decoding_carryover = coding->carryover_bytes;
     }
-  if (SBYTES (text) > 0)
+  if (!direct && SBYTES (text) > 0)
     /* FIXME: It's wrong to wrap or not based on debug-on-error, and
        sometimes it's simply wrong to wrap (e.g. when called from
        accept-process-output).  */
@@ -6154,6 +6375,200 @@ read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
 			       list3 (outstream, make_lisp_proc (p), text),
 			       !NILP (Vdebug_on_error) ? Qnil : Qerror,
 			       read_process_output_error_handler);
+}
+
+/* The longest header block accepted from a process with framing, in
+   bytes.  A process that sends more than this without the blank line
+   that ends the headers is not speaking the protocol.  */
+enum { FRAMING_HEADER_MAX = 64 * 1024 };
+
+/* Parse the message headers at the start of the N bytes at BUF.
+   Return the length of the headers including the blank line after
+   them, and store the value of their Content-Length in *LENGTH.
+   Return 0 if the headers are not complete yet, and -1 if they are
+   invalid.  */
+
+static ptrdiff_t
+framing_header_length (const char *buf, ptrdiff_t n, ptrdiff_t *length)
+{
+  static char const terminator[] = "\r\n\r\n";
+  static char const field[] = "content-length:";
+  ptrdiff_t fieldlen = sizeof field - 1;
+  const char *end = memmem (buf, n, terminator, sizeof terminator - 1);
+  if (!end)
+    return n < FRAMING_HEADER_MAX ? 0 : -1;
+
+  bool found = false;
+  const char *line = buf;
+  end += 2;
+  while (line < end)
+    {
+      const char *eol = memchr (line, '\n', end - line);
+      if (fieldlen < eol - line
+	  && c_strncasecmp (line, field, fieldlen) == 0)
+	{
+	  const char *q = line + fieldlen;
+	  ptrdiff_t value = 0;
+	  while (*q == ' ' || *q == '\t')
+	    q++;
+	  if (! ('0' <= *q && *q <= '9'))
+	    return -1;
+	  for (; '0' <= *q && *q <= '9'; q++)
+	    if (INT_MULTIPLY_WRAPV (value, 10, &value)
+		|| INT_ADD_WRAPV (value, *q - '0', &value))
+	      return -1;
+	  while (*q == ' ' || *q == '\t')
+	    q++;
+	  if (*q != '\r' || value > STRING_BYTES_BOUND)
+	    return -1;
+	  *length = value;
+	  found = true;
+	}
+      line = eol + 1;
+    }
+
+  return found ? end + 2 - buf : -1;
+}
+
+/* Pass one message of a process with framing to its filter.  ARGS
+   are the process, the message content as a mint pointer, and the
+   length of the content in bytes, or -1 if the message headers were
+   invalid.  */
+
+static Lisp_Object
+read_process_output_call_framed (ptrdiff_t nargs, Lisp_Object *args)
+{
+  struct Lisp_Process *p = XPROCESS (args[0]);
+  const char *body = xmint_pointer (args[1]);
+  ptrdiff_t len = XFIXNUM (args[2]);
+  Lisp_Object message;
+
+  if (len < 0)
+    error ("Invalid message header from process %s", SDATA (p->name));
+  if (EQ (p->framing, Qcontent_length))
+    message = make_string_from_utf8 (body, len);
+  else
+    message = json_parse_rpc_message (body, len,
+				      CONSP (p->framing)
+				      ? XCDR (p->framing) : Qnil);
+  return call2 (p->filter, args[0], message);
+}
+
+static Lisp_Object
+read_process_output_framed_error_handler (Lisp_Object error_val,
+					  ptrdiff_t nargs, Lisp_Object *args)
+{
+  return read_process_output_error_handler (error_val);
+}
+
+/* Add NBYTES bytes of output of process P at CHARS to the output
+   that is waiting to form a complete message, and pass each message
+   that is now complete to P's filter.  The output is not decoded; the
+   message content is always UTF-8.  */
+
+static void
+dispose_of_framed_process_output (struct Lisp_Process *p, char *chars,
+				  ssize_t nbytes)
+{
+  ptrdiff_t size = STRINGP (p->framing_buf) ? SBYTES (p->framing_buf) : 0;
+  if (size - p->framing_end < nbytes)
+    {
+      ptrdiff_t pending = p->framing_end - p->framing_start;
+      if (size < pending + nbytes)
+	{
+	  Lisp_Object buf
+	    = make_uninit_string (max (pending + nbytes,
+				       min (2 * size, STRING_BYTES_BOUND)));
+	  if (pending)
+	    memcpy (SDATA (buf), SDATA (p->framing_buf) + p->framing_start,
+		    pending);
+	  pset_framing_buf (p, buf);
+	}
+      else
+	memmove (SDATA (p->framing_buf),
+		 SDATA (p->framing_buf) + p->framing_start, pending);
+      p->framing_start = 0;
+      p->framing_end = pending;
+    }
+  if (nbytes > 0)
+    {
+      memcpy (SDATA (p->framing_buf) + p->framing_end, chars, nbytes);
+      p->framing_end += nbytes;
+    }
+
+  /* The filter may read more output from P, so look at P's buffer
+     afresh after each message.  The message is consumed before the
+     filter is called.  */
+  while (p->framing_start < p->framing_end)
+    {
+      char *data = SSDATA (p->framing_buf) + p->framing_start;
+      ptrdiff_t avail = p->framing_end - p->framing_start;
+      ptrdiff_t len;
+      ptrdiff_t hlen = framing_header_length (data, avail, &len);
+
+      if (hlen == 0 || (hlen > 0 && avail - hlen < len))
+	break;
+      if (hlen < 0)
+	{
+	  p->framing_start = p->framing_end = 0;
+	  len = -1;
+	}
+      else
+	p->framing_start += hlen + len;
+
+      Lisp_Object args[3];
+      args[0] = make_lisp_proc (p);
+      args[1] = make_mint_ptr (data + max (hlen, 0));
+      args[2] = make_fixnum (len);
+      internal_condition_case_n (read_process_output_call_framed, 3, args,
+				 !NILP (Vdebug_on_error) ? Qnil : Qerror,
+				 read_process_output_framed_error_handler);
+    }
+  if (p->framing_start == p->framing_end)
+    p->framing_start = p->framing_end = 0;
+}
+
+static void
+read_and_dispose_of_process_output (struct Lisp_Process *p, char *chars,
+				    ssize_t nbytes,
+				    struct coding_system *coding)
+{
+  bool outer_running_asynch_code = running_asynch_code;
+  int waiting = waiting_for_user_input_p;
+
+#if 0
+  Lisp_Object obuffer, okeymap;
+  XSETBUFFER (obuffer, current_buffer);
+  okeymap = BVAR (current_buffer, keymap);
+#endif
+
+  /* We inhibit quit here instead of just catching it so that
+     hitting ^G when a filter happens to be running won't screw
+     it up.  */
+  specbind (Qinhibit_quit, Qt);
+  specbind (Qlast_nonmenu_event, Qt);
+
+  /* In case we get recursively called,
+     and we already saved the match data nonrecursively,
+     save the same match data in safely recursive fashion.  */
+  if (outer_running_asynch_code)
+    {
+      Lisp_Object tem;
+      /* Don't clobber the CURRENT match data, either!  */
+      tem = Fmatch_data (Qnil, Qnil, Qnil);
+      restore_search_regs ();
+      record_unwind_save_match_data ();
+      Fset_match_data (tem, Qt);
+    }
+
+  /* For speed, if a search happens within this code,
+     save the match data in a special nonrecursive fashion.  */
+  running_asynch_code = 1;
+
+  if (NILP (p->framing))
+    decode_and_dispose_of_process_output (p, chars, nbytes, coding);
+  else
+    dispose_of_framed_process_output (p, chars, nbytes);
 
   /* If we saved the match data nonrecursively, restore it now.  */
   restore_search_regs ();
@@ -6172,94 +6587,125 @@ DEFUN ("internal-default-process-filter", Finternal_default_process_filter,
   (Lisp_Object proc, Lisp_Object text)
 {
   struct Lisp_Process *p;
-  ptrdiff_t opoint;
 
   CHECK_PROCESS (proc);
   p = XPROCESS (proc);
   CHECK_STRING (text);
 
   if (!NILP (p->buffer) && BUFFER_LIVE_P (XBUFFER (p->buffer)))
-    {
-      Lisp_Object old_read_only;
-      ptrdiff_t old_begv, old_zv;
-      ptrdiff_t old_begv_byte, old_zv_byte;
-      ptrdiff_t before, before_byte;
-      ptrdiff_t opoint_byte;
-      struct buffer *b;
+    insert_process_output (p, text, NULL, NULL, 0);
+  return Qnil;
+}
 
-      Fset_buffer (p->buffer);
-      opoint = PT;
-      opoint_byte = PT_BYTE;
-      old_read_only = BVAR (current_buffer, read_only);
-      old_begv = BEGV;
-      old_zv = ZV;
-      old_begv_byte = BEGV_BYTE;
-      old_zv_byte = ZV_BYTE;
+/* Return true if FILTER is `internal-default-process-filter' and its
+   definition is still the original one, so that output can be
+   inserted without calling it.  Advice, for instance, replaces the
+   definition.  */
 
-      bset_read_only (current_buffer, Qnil);
+static bool
+plain_default_filter_p (Lisp_Object filter)
+{
+  if (!EQ (filter, Qinternal_default_process_filter))
+    return false;
+  Lisp_Object fn = XSYMBOL (filter)->u.s.function;
+  return SUBRP (fn) && XSUBR (fn) == &Sinternal_default_process_filter.s;
+}
 
-      /* Insert new output into buffer at the current end-of-output
-	 marker, thus preserving logical ordering of input and output.  */
-      if (XMARKER (p->mark)->buffer)
-	set_point_from_marker (p->mark);
-      else
-	SET_PT_BOTH (ZV, ZV_BYTE);
-      before = PT;
-      before_byte = PT_BYTE;
+/* Insert output from process P at its mark in its buffer, which must
+   be live, as the default process filter does.  If TEXT is a string,
+   insert it.  Otherwise decode the NBYTES bytes at CHARS by CODING
+   directly into the buffer, which must be multibyte.  */
+
+static void
+insert_process_output (struct Lisp_Process *p, Lisp_Object text,
+		       struct coding_system *coding,
+		       const char *chars, ptrdiff_t nbytes)
+{
+  Lisp_Object old_read_only;
+  ptrdiff_t old_begv, old_zv;
+  ptrdiff_t old_begv_byte, old_zv_byte;
+  ptrdiff_t before, before_byte;
+  ptrdiff_t opoint, opoint_byte;
+  struct buffer *b;
+
+  Fset_buffer (p->buffer);
+  opoint = PT;
+  opoint_byte = PT_BYTE;
+  old_read_only = BVAR (current_buffer, read_only);
+  old_begv = BEGV;
+  old_zv = ZV;
+  old_begv_byte = BEGV_BYTE;
+  old_zv_byte = ZV_BYTE;
+
+  bset_read_only (current_buffer, Qnil);
+
+  /* Insert new output into buffer at the current end-of-output
+     marker, thus preserving logical ordering of input and output.  */
+  if (XMARKER (p->mark)->buffer)
+    set_point_from_marker (p->mark);
+  else
+    SET_PT_BOTH (ZV, ZV_BYTE);
+  before = PT;
+  before_byte = PT_BYTE;
 
-      /* If the output marker is outside of the visible region, save
-	 the restriction and widen.  */
-      if (! (BEGV <= PT && PT <= ZV))
-	Fwiden ();
+  /* If the output marker is outside of the visible region, save
+     the restriction and widen.  */
+  if (! (BEGV <= PT && PT <= ZV))
+    Fwiden ();
 
+  /* Insert before markers in case we are inserting where
+     the buffer's mark is, and the user's next command is Meta-y.  */
+  if (STRINGP (text))
+    {
       /* Adjust the multibyteness of TEXT to that of the buffer.  */
       if (NILP (BVAR (current_buffer, enable_multibyte_characters))
 	  != ! STRING_MULTIBYTE (text))
 	text = (STRING_MULTIBYTE (text)
 		? Fstring_as_unibyte (text)
 		: Fstring_to_multibyte (text));
-      /* Insert before markers in case we are inserting where
-	 the buffer's mark is, and the user's next command is Meta-y.  */
       insert_from_string_before_markers (text, 0, 0,
 					 SCHARS (text), SBYTES (text), 0);
+    }
+  else
+    decode_coding_insert_before_markers (coding,
+					 (const unsigned char *) chars,
+					 nbytes);
+
+  /* Make sure the process marker's position is valid when the
+     process buffer is changed in the signal_after_change above.
+     W3 is known to do that.  */
+  if (BUFFERP (p->buffer)
+      && (b = XBUFFER (p->buffer), b != current_buffer))
+    set_marker_both (p->mark, p->buffer, BUF_PT (b), BUF_PT_BYTE (b));
+  else
+    set_marker_both (p->mark, p->buffer, PT, PT_BYTE);
 
-      /* Make sure the process marker's position is valid when the
-	 process buffer is changed in the signal_after_change above.
-	 W3 is known to do that.  */
-      if (BUFFERP (p->buffer)
-	  && (b = XBUFFER (p->buffer), b != current_buffer))
-	set_marker_both (p->mark, p->buffer, BUF_PT (b), BUF_PT_BYTE (b));
-      else
-	set_marker_both (p->mark, p->buffer, PT, PT_BYTE);
-
-      update_mode_lines = 23;
+  update_mode_lines = 23;
 
-      /* Make sure opoint and the old restrictions
-	 float ahead of any new text just as point would.  */
-      if (opoint >= before)
-	{
-	  opoint += PT - before;
-	  opoint_byte += PT_BYTE - before_byte;
-	}
-      if (old_begv > before)
-	{
-	  old_begv += PT - before;
-	  old_begv_byte += PT_BYTE - before_byte;
-	}
-      if (old_zv >= before)
-	{
-	  old_zv += PT - before;
-	  old_zv_byte += PT_BYTE - before_byte;
-	}
+  /* Make sure opoint and the old restrictions
+     float ahead of any new text just as point would.  */
+  if (opoint >= before)
+    {
+      opoint += PT - before;
+      opoint_byte += PT_BYTE - before_byte;
+    }
+  if (old_begv > before)
+    {
+      old_begv += PT - before;
+      old_begv_byte += PT_BYTE - before_byte;
+    }
+  if (old_zv >= before)
+    {
+      old_zv += PT - before;
+      old_zv_byte += PT_BYTE - before_byte;
+    }
 
-      /* If the restriction isn't what it should be, set it.  */
-      if (old_begv != BEGV || old_zv != ZV)
-	Fnarrow_to_region (make_fixnum (old_begv), make_fixnum (old_zv));
+  /* If the restriction isn't what it should be, set it.  */
+  if (old_begv != BEGV || old_zv != ZV)
+    Fnarrow_to_region (make_fixnum (old_begv), make_fixnum (old_zv));
 
-      bset_read_only (current_buffer, old_read_only);
-      SET_PT_BOTH (opoint, opoint_byte);
-    }
-  return Qnil;
+  bset_read_only (current_buffer, old_read_only);
+  SET_PT_BOTH (opoint, opoint_byte);
 }
 
 /* Sending data to subprocess.  */
@@ -6336,6 +6782,103 @@ write_queue_pop (struct Lisp_Process *p, Lisp_Object *obj,
   return 1;
 }
 
+#ifdef HAVE_WRITEV
+
+/* The most pieces of input that send_process_writev passes to one
+   writev call, which POSIX guarantees that IOV_MAX is at least, and
+   the most bytes, which is MAX_RW_COUNT in sysdep.c.  */
+enum
+  {
+    SEND_PROCESS_IOV_MAX = 16,
+    SEND_PROCESS_WRITEV_MAX = INT_MAX >> 18 << 18
+  };
+
+/* Write LEN bytes at BUF to the descriptor OUTFD of process P, and
+   the input queued in P's write_queue after them, with one writev
+   call.  Remove what was written from the queue, and add it to the
+   byte count of P.  Return the number of bytes written from BUF,
+   setting errno if this is zero.  */
+
+static ptrdiff_t
+send_process_writev (struct Lisp_Process *p, int outfd,
+		     const char *buf, ptrdiff_t len)
+{
+  struct iovec iov[SEND_PROCESS_IOV_MAX];
+  int iovcnt = 1;
+  ptrdiff_t first = min (len, SEND_PROCESS_WRITEV_MAX), total = first;
+  iov[0].iov_base = (char *) buf;
+  iov[0].iov_len = first;
+  for (Lisp_Object tail = p->write_queue;
+       CONSP (tail) && iovcnt < SEND_PROCESS_IOV_MAX
+	 && total <= SEND_PROCESS_WRITEV_MAX - XFIXNUM (XCDR (XCDR (XCAR (tail))));
+       tail = XCDR (tail), iovcnt++)
+    {
+      Lisp_Object entry = XCAR (tail);
+      iov[iovcnt].iov_base
+	= SSDATA (XCAR (entry)) + XFIXNUM (XCAR (XCDR (entry)));
+      iov[iovcnt].iov_len = XFIXNUM (XCDR (XCDR (entry)));
+      total += iov[iovcnt].iov_len;
+    }
+
+  ssize_t written;
+  while ((written = writev (outfd, iov, iovcnt)) < 0 && errno == EINTR)
+    if (pending_signals)
+      process_pending_signals ();
+  if (written <= first)
+    return max (written, 0);
+
+  ptrdiff_t extra = written - first;
+  p->nbytes_written += extra;
+  while (0 < extra)
+    {
+      Lisp_Object offset_length = XCDR (XCAR (p->write_queue));
+      ptrdiff_t offset = XFIXNUM (XCAR (offset_length));
+      ptrdiff_t queued = XFIXNUM (XCDR (offset_length));
+      if (queued <= extra)
+	pset_write_queue (p, XCDR (p->write_queue));
+      else
+	{
+	  XSETCAR (offset_length, make_fixnum (offset + extra));
+	  XSETCDR (offset_length, make_fixnum (queued - extra));
+	}
+      extra -= queued;
+    }
+  return first;
+}
+
+#endif	/* HAVE_WRITEV */
+
+/* Wait until process P can accept more input, P has output to be
+   read, or 20 milliseconds pass, whichever comes first.  Then read
+   whatever output is available from P and other processes, as
+   waiting for process output would.  */
+
+static void
+wait_for_process_input_space (struct Lisp_Process *p)
+{
+  fd_set rfds, wfds;
+  int outfd = p->outfd, infd = p->infd;
+  struct timespec timeout = make_timespec (0, 20 * 1000 * 1000);
+
+  p->nwrite_waits++;
+  FD_ZERO (&rfds);
+  FD_ZERO (&wfds);
+  FD_SET (outfd, &wfds);
+  /* Do not wake up for output that will not be read now, such as the
+     output of a stopped process, lest we spin.  */
+  if (0 <= infd
+      && (fd_callback_info[infd].flags & FOR_READ) != 0
+      && (fd_callback_info[infd].waiting_thread == NULL
+	  || fd_callback_info[infd].waiting_thread == current_thread))
+    FD_SET (infd, &rfds);
+  else
+    infd = -1;
+  thread_select (pselect, max (outfd, infd) + 1, &rfds, &wfds, NULL,
+		 &timeout, NULL);
+
+  wait_reading_process_output (-1, 0, 0, 0, Qnil, NULL, 0);
+}
+
 /* Send some data to process PROC.
    BUF is the beginning of the data; LEN is the number of characters.
    OBJECT is the Lisp object that the data comes from.  If OBJECT is
@@ -6353,6 +6896,7 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
   struct Lisp_Process *p = XPROCESS (proc);
   ssize_t rv;
   struct coding_system *coding;
+  ptrdiff_t count = SPECPDL_INDEX ();
 
   if (NETCONN_P (proc))
     {
@@ -6419,6 +6963,9 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
   if (CODING_REQUIRE_ENCODING (coding))
     {
       coding->dst_object = Qt;
+      /* Encode into a C buffer rather than a Lisp string; whatever
+	 cannot be written at once is copied to the write queue.  */
+      coding->raw_destination = 1;
       if (BUFFERP (object))
 	{
 	  ptrdiff_t from_byte, from, to;
@@ -6443,14 +6990,16 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
 				SBYTES (object), Qt);
 	}
       else
+	coding->raw_destination = 0;
+
+      if (coding->raw_destination)
 	{
-	  coding->dst_object = make_unibyte_string (buf, len);
-	  coding->produced = len;
+	  coding->raw_destination = 0;
+	  record_unwind_protect_ptr (xfree, coding->destination);
+	  len = coding->produced;
+	  object = Qnil;
+	  buf = (char *) coding->destination;
 	}
-
-      len = coding->produced;
-      object = coding->dst_object;
-      buf = SSDATA (object);
     }
 
   /* If there is already data in the write_queue, put the new data
@@ -6504,9 +7053,16 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
 	      if (p->gnutls_p && p->gnutls_state)
 		written = emacs_gnutls_write (p, cur_buf, cur_len);
 	      else
+#endif
+#ifdef HAVE_WRITEV
+	      if (CONSP (p->write_queue))
+		written = send_process_writev (p, outfd, cur_buf, cur_len);
+	      else
 #endif
 		written = emacs_write_sig (outfd, cur_buf, cur_len);
 	      rv = (written ? 0 : -1);
+	      p->nwrites++;
+	      p->nbytes_written += written;
 	      if (p->read_output_delay > 0
 		  && p->adaptive_read_buffering == 1)
 		{
@@ -6550,8 +7106,7 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
 
 		  /* Put what we should have written in write_queue.  */
 		  write_queue_push (p, cur_object, cur_buf, cur_len, 1);
-		  wait_reading_process_output (0, 20 * 1000 * 1000,
-					       0, 0, Qnil, NULL, 0);
+		  wait_for_process_input_space (p);
 		  /* Reread queue, to see what is left.  */
 		  break;
 		}
@@ -6573,6 +7128,8 @@ send_process (Lisp_Object proc, const char *buf, ptrdiff_t len,
 	}
     }
   while (!NILP (p->write_queue));
+
+  unbind_to (count, Qnil);
 }
 
 DEFUN ("process-send-region", Fprocess_send_region, Sprocess_send_region,
@@ -6632,6 +7189,35 @@ DEFUN ("process-send-string", Fprocess_send_string, Sprocess_send_string,
   return Qnil;
 }
 
+DEFUN ("process-send-statistics", Fprocess_send_statistics,
+       Sprocess_send_statistics, 0, 1, 0,
+       doc: /* Return statistics about the input sent to PROCESS.
+PROCESS may be a process, a buffer, the name of a process or buffer, or
+nil, indicating the current buffer's process.
+The value is an alist with these elements:
+
+  (bytes . N)   -- N bytes of input have been written to the process.
+  (writes . N)  -- They were written by N calls to the operating system.
+  (waits . N)   -- Writing had to wait N times for the process to read
+                   its input, because the input buffer was full.
+  (queued . N)  -- N bytes of input are waiting to be written.
+
+The byte counts are modulo the largest unsigned integer of the system.
+A large number of waits for a process means that it reads its input
+more slowly than Emacs sends it.  */)
+  (Lisp_Object process)
+{
+  struct Lisp_Process *p = XPROCESS (get_process (process));
+  ptrdiff_t queued = 0;
+
+  for (Lisp_Object tail = p->write_queue; CONSP (tail); tail = XCDR (tail))
+    queued += XFIXNUM (XCDR (XCDR (XCAR (tail))));
+  return list4 (Fcons (Qbytes, make_uint (p->nbytes_written)),
+		Fcons (Qwrites, make_uint (p->nwrites)),
+		Fcons (Qwaits, make_uint (p->nwrite_waits)),
+		Fcons (Qqueued, make_int (queued)));
+}
+
 /* Return the foreground process group for the tty/pty that
    the process P uses.  */
 static pid_t
@@ -7223,7 +7809,8 @@ child_signal_read (int fd, void *data)
 #endif	/* !WINDOWSNT */
 
 /* Notify `wait_reading_process_output' of a process status
-   change.  */
+   change.  This is also called when an asynchronous DNS request
+   completes, from the thread that ran it.  */
 
 static void
 child_signal_notify (void)
@@ -7244,6 +7831,101 @@ child_signal_notify (void)
 static void dummy_handler (int sig) {}
 static signal_handler_t volatile lib_child_handler;
 
+/* Return the process id in HEAD, an element of deleted_pid_list, or
+   0 if HEAD has none.  */
+
+static pid_t
+deleted_pid_list_pid (Lisp_Object head)
+{
+  bool all_pids_are_fixnums
+    = (MOST_NEGATIVE_FIXNUM <= TYPE_MINIMUM (pid_t)
+       && TYPE_MAXIMUM (pid_t) <= MOST_POSITIVE_FIXNUM);
+  Lisp_Object xpid;
+  if (! CONSP (head))
+    return 0;
+  xpid = XCAR (head);
+  if (all_pids_are_fixnums ? FIXNUMP (xpid) : INTEGERP (xpid))
+    {
+      intmax_t deleted_pid;
+      bool ok = integer_to_intmax (xpid, &deleted_pid);
+      eassert (ok);
+      return deleted_pid;
+    }
+  return 0;
+}
+
+/* Reap the child process of the element of deleted_pid_list at TAIL
+   if it has exited, and forget about it.  Return true if it had.  */
+
+static bool
+reap_deleted_pid (Lisp_Object tail)
+{
+  Lisp_Object head = XCAR (tail);
+  pid_t deleted_pid = deleted_pid_list_pid (head);
+  if (deleted_pid && child_status_changed (deleted_pid, 0, 0))
+    {
+      if (STRINGP (XCDR (head)))
+	unlink (SSDATA (XCDR (head)));
+      XSETCAR (tail, Qnil);
+      return true;
+    }
+  return false;
+}
+
+/* Record the new status of the subprocess P if it has changed.
+   Return true if it had.  */
+
+static bool
+record_child_status_change (struct Lisp_Process *p)
+{
+  int status;
+
+  if (! (p->alive
+	 && child_status_changed (p->pid, &status, WUNTRACED | WCONTINUED)))
+    return false;
+
+  /* Change the status of the process that was found.  */
+  p->tick = ++process_tick;
+  p->raw_status = status;
+  p->raw_status_new = 1;
+
+  /* If process has terminated, stop waiting for its output.  */
+  if (WIFSIGNALED (status) || WIFEXITED (status))
+    {
+      bool clear_desc_flag = 0;
+      p->alive = 0;
+      if (p->infd >= 0)
+	clear_desc_flag = 1;
+
+      /* clear_desc_flag avoids a compiler bug in Microsoft C.  */
+      if (clear_desc_flag)
+	delete_read_fd (p->infd);
+    }
+  return true;
+}
+
+/* Record the status change of the child process PID, if it is a
+   child process that Emacs knows about.  Return true if it was.  */
+
+static bool
+record_child_pid_status_change (pid_t pid)
+{
+  Lisp_Object tail, proc;
+
+  for (tail = deleted_pid_list; CONSP (tail); tail = XCDR (tail))
+    if (deleted_pid_list_pid (XCAR (tail)) == pid)
+      return reap_deleted_pid (tail);
+
+  FOR_EACH_PROCESS (tail, proc)
+    {
+      struct Lisp_Process *p = XPROCESS (proc);
+      if (p->alive && p->pid == pid)
+	return record_child_status_change (p);
+    }
+
+  return false;
+}
+
 /* Handle a SIGCHLD signal by looking for known child processes of
    Emacs whose status have changed.  For each one found, record its
    new status.
@@ -7274,64 +7956,30 @@ handle_child_signal (int sig)
 {
   Lisp_Object tail, proc;
   bool changed = false;
+  pid_t pid;
 
-  /* Find the process that signaled us, and record its status.  */
+  /* Find the processes that signaled us, and record their status.
+     Ask the system which child process has changed status, so that
+     only that process need be looked at.  This stops at a child that
+     Emacs does not know about, such as a synchronous subprocess or
+     one created by a library, since such a child stays reported until
+     its owner reaps it.  */
+  while (0 < (pid = changed_child_pid ())
+	 && record_child_pid_status_change (pid))
+    changed = true;
 
-  /* The process can have been deleted by Fdelete_process, or have
-     been started asynchronously by Fcall_process.  */
-  for (tail = deleted_pid_list; CONSP (tail); tail = XCDR (tail))
+  /* If that did not account for every change, poll all the child
+     processes.  */
+  if (pid != 0)
     {
-      bool all_pids_are_fixnums
-	= (MOST_NEGATIVE_FIXNUM <= TYPE_MINIMUM (pid_t)
-	   && TYPE_MAXIMUM (pid_t) <= MOST_POSITIVE_FIXNUM);
-      Lisp_Object head = XCAR (tail);
-      Lisp_Object xpid;
-      if (! CONSP (head))
-	continue;
-      xpid = XCAR (head);
-      if (all_pids_are_fixnums ? FIXNUMP (xpid) : INTEGERP (xpid))
-	{
-	  intmax_t deleted_pid;
-	  bool ok = integer_to_intmax (xpid, &deleted_pid);
-	  eassert (ok);
-	  if (child_status_changed (deleted_pid, 0, 0))
-	    {
-	      changed = true;
-	      if (STRINGP (XCDR (head)))
-		unlink (SSDATA (XCDR (head)));
-	      XSETCAR (tail, Qnil);
-	    }
-	}
-    }
+      /* The process can have been deleted by Fdelete_process, or have
+	 been started asynchronously by Fcall_process.  */
+      for (tail = deleted_pid_list; CONSP (tail); tail = XCDR (tail))
+	changed |= reap_deleted_pid (tail);
 
-  /* Otherwise, if it is asynchronous, it is in Vprocess_alist.  */
-  FOR_EACH_PROCESS (tail, proc)
-    {
-      struct Lisp_Process *p = XPROCESS (proc);
-      int status;
-
-      if (p->alive
-	  && child_status_changed (p->pid, &status, WUNTRACED | WCONTINUED))
-	{
-	  /* Change the status of the process that was found.  */
-	  changed = true;
-	  p->tick = ++process_tick;
-	  p->raw_status = status;
-	  p->raw_status_new = 1;
-
-	  /* If process has terminated, stop waiting for its output.  */
-	  if (WIFSIGNALED (status) || WIFEXITED (status))
-	    {
-	      bool clear_desc_flag = 0;
-	      p->alive = 0;
-	      if (p->infd >= 0)
-		clear_desc_flag = 1;
-
-	      /* clear_desc_flag avoids a compiler bug in Microsoft C.  */
-	      if (clear_desc_flag)
-		delete_read_fd (p->infd);
-	    }
-	}
+      /* Otherwise, if it is asynchronous, it is in Vprocess_alist.  */
+      FOR_EACH_PROCESS (tail, proc)
+	changed |= record_child_status_change (XPROCESS (proc));
     }
 
   if (changed)
@@ -7965,6 +8613,7 @@ add_keyboard_wait_descriptor (int desc)
   eassert (desc >= 0 && desc < FD_SETSIZE);
   fd_callback_info[desc].flags &= ~PROCESS_FD;
   fd_callback_info[desc].flags |= (FOR_READ | KEYBOARD_FD);
+  update_epoll_watch (desc);
   if (desc > max_desc)
     max_desc = desc;
 #endif
@@ -7979,6 +8628,7 @@ delete_keyboard_wait_descriptor (int desc)
   eassert (desc >= 0 && desc < FD_SETSIZE);
 
   fd_callback_info[desc].flags &= ~(FOR_READ | KEYBOARD_FD | PROCESS_FD);
+  update_epoll_watch (desc);
 
   if (desc == max_desc)
     recompute_max_desc ();
@@ -8225,6 +8875,18 @@ restore_nofile_limit (void)
 #endif
 }
 
+/* Return true if restore_nofile_limit has anything to restore.  */
+
+bool
+nofile_limit_lowered_p (void)
+{
+#ifdef HAVE_SETRLIMIT
+  return FD_SETSIZE < nofile_limit.rlim_cur;
+#else
+  return false;
+#endif
+}
+
 int
 open_channel_for_module (Lisp_Object process)
 {
@@ -8275,6 +8937,10 @@ init_process_emacs (int sockfd)
 #endif
     }
 
+#ifdef HAVE_EPOLL
+  init_epoll_select ();
+#endif
+
 #ifdef HAVE_SETRLIMIT
   /* Don't allocate more than FD_SETSIZE file descriptors for Emacs itself.  */
   if (getrlimit (RLIMIT_NOFILE, &nofile_limit) != 0)
@@ -8398,6 +9064,13 @@ syms_of_process (void)
   DEFSYM (QCcommand, ":command");
   DEFSYM (QCconnection_type, ":connection-type");
   DEFSYM (QCstderr, ":stderr");
+  DEFSYM (QCframing, ":framing");
+  DEFSYM (Qcontent_length, "content-length");
+  DEFSYM (Qjsonrpc, "jsonrpc");
+  DEFSYM (Qbytes, "bytes");
+  DEFSYM (Qwrites, "writes");
+  DEFSYM (Qwaits, "waits");
+  DEFSYM (Qqueued, "queued");
   DEFSYM (Qpty, "pty");
   DEFSYM (Qpipe, "pipe");
 
@@ -8493,6 +9166,24 @@ syms_of_process (void)
 amounts of data in one go.  */);
   read_process_output_max = 4096;
 
+  DEFVAR_INT ("read-process-output-adaptive-max",
+	      read_process_output_adaptive_max,
+	      doc: /* Largest chunk of subprocess output to read at once.
+While a subprocess keeps filling the read buffer, Emacs doubles the
+buffer for that process, starting from `read-process-output-max', up
+to this many bytes.  It shrinks the buffer again when the output slows
+down.  A value not larger than `read-process-output-max' disables this.  */);
+  read_process_output_adaptive_max = 256 * 1024;
+
+  DEFVAR_BOOL ("read-process-output-coalesce", read_process_output_coalesce,
+	       doc: /* Non-nil means deliver quickly arriving process output in fewer chunks.
+When a read from a subprocess returns at least `read-process-output-max'
+bytes, Emacs keeps reading whatever is already available, up to the
+current read buffer size, before passing the output to the process
+filter.  This reduces the number of filter calls for processes that
+produce a lot of output.  */);
+  read_process_output_coalesce = true;
+
   DEFSYM (Qinternal_default_interrupt_process,
 	  "internal-default-interrupt-process");
   DEFSYM (Qinterrupt_process_functions, "interrupt-process-functions");
@@ -8543,6 +9234,7 @@ syms_of_process (void)
   defsubr (&Saccept_process_output);
   defsubr (&Sprocess_send_region);
   defsubr (&Sprocess_send_string);
+  defsubr (&Sprocess_send_statistics);
   defsubr (&Sinternal_default_interrupt_process);
   defsubr (&Sinterrupt_process);
   defsubr (&Skill_process);
@@ -110,8 +110,19 @@ #define EMACS_PROCESS_H
 #ifdef HAVE_GNUTLS
     Lisp_Object gnutls_cred_type;
     Lisp_Object gnutls_boot_parameters;
+    /* Key under which the TLS session is saved for resumption, or nil
+       if it is not saved.  */
+    Lisp_Object gnutls_session_key;
 #endif
 
+    /* How output is split into messages for the filter, or nil to
+       pass it on as it arrives.  See `make-process'.  */
+    Lisp_Object framing;
+
+    /* Unibyte string holding output that does not yet make up a
+       whole message, when FRAMING is non-nil.  */
+    Lisp_Object framing_buf;
+
     /* Pipe process attached to the standard error of this process.  */
     Lisp_Object stderrproc;
 
@@ -131,6 +142,10 @@ #define EMACS_PROCESS_H
     uintmax_t nbytes_read;
     /* Descriptor by which we write to this process.  */
     int outfd;
+    /* Byte-count modulo (UINTMAX_MAX + 1) for input written to `outfd',
+       the number of write calls that wrote it, and the number of times
+       a write had to wait for the process to read its input.  */
+    uintmax_t nbytes_written, nwrites, nwrite_waits;
     /* Descriptors that were created for this process and that need
        closing.  Unused entries are negative.  */
     int open_fd[PROCESS_OPEN_FDS];
@@ -140,6 +155,9 @@ #define EMACS_PROCESS_H
     EMACS_INT update_tick;
     /* Size of carryover in decoding.  */
     int decoding_carryover;
+    /* Byte positions in framing_buf of the output that has not yet
+       been passed to the filter.  */
+    ptrdiff_t framing_start, framing_end;
     /* Hysteresis to try to read process output in larger blocks.
        On some systems, e.g. GNU/Linux, Emacs is seen as
        an interactive app also when reading process output, meaning
@@ -147,6 +165,10 @@ #define EMACS_PROCESS_H
        time.  Value is nanoseconds to delay reading output from
        this process.  Range is 0 .. 50 * 1000 * 1000.  */
     int read_output_delay;
+    /* Size of the buffer for the next read from `infd'.  It grows
+       while reads keep filling it and shrinks when output slows down.
+       Zero means `read-process-output-max'.  */
+    ptrdiff_t read_output_size;
     /* Should we delay reading output from this process.
        Initialized from `Vprocess_adaptive_read_buffering'.
        0 = nil, 1 = t, 2 = other.  */
@@ -248,6 +270,11 @@ pset_gnutls_cred_type (struct Lisp_Process *p, Lisp_Object val)
 {
   p->gnutls_cred_type = val;
 }
+INLINE void
+pset_gnutls_session_key (struct Lisp_Process *p, Lisp_Object val)
+{
+  p->gnutls_session_key = val;
+}
 #endif
 
 /* True means don't run process sentinels.  This is used
@@ -289,6 +316,7 @@ pset_gnutls_cred_type (struct Lisp_Process *p, Lisp_Object val)
 extern void delete_write_fd (int fd);
 extern void catch_child_signal (void);
 extern void restore_nofile_limit (void);
+extern bool nofile_limit_lowered_p (void);
 
 #ifdef WINDOWSNT
 extern Lisp_Object network_interface_list (bool full, unsigned short match);
@@ -215,6 +215,18 @@ emacs_exec_file (char const *file, char *const *argv, char *const *envp)
   return errno;
 }
 
+/* Return true if emacs_exec_file does more than execve, so that
+   programs cannot be executed in any other way.  */
+bool
+emacs_exec_file_special_p (void)
+{
+#ifdef HAVE_PERSONALITY_ADDR_NO_RANDOMIZE
+  return exec_personality != -1;
+#else
+  return false;
+#endif
+}
+
 #endif	/* !WINDOWSNT */
 
 /* If FD is not already open, arrange for it to be open with FLAGS.  */
@@ -518,6 +530,32 @@ child_status_changed (pid_t child, int *status, int options)
   return get_child_status (child, status, WNOHANG | options, 0);
 }
 
+/* Return the process id of a child process whose status has changed
+   and that has not been reaped yet, without reaping it.  Return 0 if
+   there is no such child, and -1 if this cannot be determined.  Any
+   child process of Emacs can be returned, including ones that Emacs
+   did not create itself, so the caller must not reap the child
+   unless it knows it.  */
+pid_t
+changed_child_pid (void)
+{
+#if defined HAVE_WAITID && defined WNOWAIT
+  siginfo_t info;
+
+  /* Zero si_pid, since waitid need not set it if no child has
+     changed status.  */
+  info.si_pid = 0;
+  while (waitid (P_ALL, 0, &info,
+		 WEXITED | WSTOPPED | WCONTINUED | WNOHANG | WNOWAIT)
+	 < 0)
+    if (errno != EINTR)
+      return errno == ECHILD ? 0 : -1;
+  return info.si_pid;
+#else
+  return -1;
+#endif
+}
+
 
 /*  Set up the terminal at the other end of a pseudo-terminal that
     we will be controlling an inferior through.
@@ -1785,7 +1823,7 @@ handle_arith_signal (int sig)
 
 /* Alternate stack used by SIGSEGV handler below.  */
 
-static unsigned char sigsegv_stack[SIGSTKSZ];
+static max_align_t sigsegv_stack[(64 * 1024 + sizeof (max_align_t) - 1) / sizeof (max_align_t)];
 
 
 /* Return true if SIGINFO indicates a stack overflow.  */
@@ -2439,17 +2477,6 @@ emacs_close (int fd)
     }
 }
 
-/* Maximum number of bytes to read or write in a single system call.
-   This works around a serious bug in Linux kernels before 2.6.16; see
-   <https://bugzilla.redhat.com/show_bug.cgi?format=multiple&id=612839>.
-   It's likely to work around similar bugs in other operating systems, so do it
-   on all platforms.  Round INT_MAX down to a page size, with the conservative
-   assumption that page sizes are at most 2**18 bytes (any kernel with a
-   page size larger than that shouldn't have the bug).  */
-#ifndef MAX_RW_COUNT
-#define MAX_RW_COUNT (INT_MAX >> 18 << 18)
-#endif
-
 /* Verify that MAX_RW_COUNT fits in the relevant standard types.  */
 #ifndef SSIZE_MAX
 # define SSIZE_MAX TYPE_MAXIMUM (ssize_t)
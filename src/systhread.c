@@ -48,6 +48,11 @@ sys_mutex_unlock (sys_mutex_t *m)
 {
 }
 
+void
+sys_mutex_destroy (sys_mutex_t *m)
+{
+}
+
 void
 sys_cond_init (sys_cond_t *c)
 {
@@ -148,6 +153,13 @@ sys_mutex_unlock (sys_mutex_t *mutex)
   eassert (error == 0);
 }
 
+void
+sys_mutex_destroy (sys_mutex_t *mutex)
+{
+  int error = pthread_mutex_destroy (mutex);
+  eassert (error == 0);
+}
+
 void
 sys_cond_init (sys_cond_t *cond)
 {
@@ -301,6 +313,12 @@ sys_mutex_unlock (sys_mutex_t *mutex)
   LeaveCriticalSection ((LPCRITICAL_SECTION)mutex);
 }
 
+void
+sys_mutex_destroy (sys_mutex_t *mutex)
+{
+  DeleteCriticalSection ((LPCRITICAL_SECTION)mutex);
+}
+
 void
 sys_cond_init (sys_cond_t *cond)
 {
@@ -542,3 +560,99 @@ sys_thread_yield (void)
 #error port me
 
 #endif
+
+/* Calls of a function on several items, shared out among threads.  */
+
+struct parallel_job
+{
+  void (*func) (void *);
+  char *items;
+  ptrdiff_t item_size;
+  int n;
+
+  /* The next item to call FUNC on, and the number of threads other
+     than the caller's that have not finished yet.  */
+  int next;
+  int running;
+
+  sys_mutex_t mutex;
+  sys_cond_t done;
+};
+
+/* Call JOB's function on its items until none are left.  */
+
+static void
+run_parallel_job (struct parallel_job *job)
+{
+  sys_mutex_lock (&job->mutex);
+  while (job->next < job->n)
+    {
+      int i = job->next++;
+      sys_mutex_unlock (&job->mutex);
+      job->func (job->items + i * job->item_size);
+      sys_mutex_lock (&job->mutex);
+    }
+  sys_mutex_unlock (&job->mutex);
+}
+
+static void *
+parallel_job_thread (void *arg)
+{
+  struct parallel_job *job = arg;
+
+  run_parallel_job (job);
+  sys_mutex_lock (&job->mutex);
+  if (--job->running == 0)
+    sys_cond_signal (&job->done);
+  sys_mutex_unlock (&job->mutex);
+  return NULL;
+}
+
+/* Call FUNC on each of the N items of ITEM_SIZE bytes each that start
+   at ITEMS, using up to N threads including the caller's, and return
+   when all the calls have finished.  Items are handed out one at a
+   time, in order, to whichever thread is free.  If threads cannot be
+   created, the caller makes the calls itself.  FUNC runs outside the
+   main thread, so it must not use any Lisp data, or quit.  */
+
+void
+sys_run_parallel (void (*func) (void *), void *items, ptrdiff_t item_size,
+		  int n)
+{
+  if (n <= 1)
+    {
+      if (n == 1)
+	func (items);
+      return;
+    }
+
+  struct parallel_job job = { .func = func, .items = items,
+			      .item_size = item_size, .n = n };
+  sys_mutex_init (&job.mutex);
+  sys_cond_init (&job.done);
+
+  for (int i = 1; i < n; i++)
+    {
+      sys_thread_t thread;
+
+      sys_mutex_lock (&job.mutex);
+      job.running++;
+      sys_mutex_unlock (&job.mutex);
+      if (! sys_thread_create (&thread, parallel_job_thread, &job))
+	{
+	  sys_mutex_lock (&job.mutex);
+	  job.running--;
+	  sys_mutex_unlock (&job.mutex);
+	  break;
+	}
+    }
+
+  run_parallel_job (&job);
+  sys_mutex_lock (&job.mutex);
+  while (job.running > 0)
+    sys_cond_wait (&job.done, &job.mutex);
+  sys_mutex_unlock (&job.mutex);
+
+  sys_cond_destroy (&job.done);
+  sys_mutex_destroy (&job.mutex);
+}
@@ -20,6 +20,7 @@ Copyright (C) 2012-2021 Free Software Foundation, Inc.
 #define SYSTHREAD_H
 
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef THREADS_ENABLED
 
@@ -94,6 +95,7 @@ #define SYSTHREAD_H
 extern void sys_mutex_init (sys_mutex_t *);
 extern void sys_mutex_lock (sys_mutex_t *);
 extern void sys_mutex_unlock (sys_mutex_t *);
+extern void sys_mutex_destroy (sys_mutex_t *);
 
 extern void sys_cond_init (sys_cond_t *);
 extern void sys_cond_wait (sys_cond_t *, sys_mutex_t *);
@@ -113,4 +115,6 @@ #define SYSTHREAD_H
 extern void sys_thread_yield (void);
 extern void sys_thread_set_name (const char *);
 
+extern void sys_run_parallel (void (*) (void *), void *, ptrdiff_t, int);
+
 #endif /* SYSTHREAD_H */
@@ -58,5 +58,6 @@ #define WTERMSIG(status) ((status) & 0x7f)
 /* Defined in sysdep.c.  */
 extern bool wait_for_termination (pid_t, int *, bool);
 extern pid_t child_status_changed (pid_t, int *, int);
+extern pid_t changed_child_pid (void);
 
 #endif /* EMACS_SYSWAIT_H */
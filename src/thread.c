@@ -625,6 +625,61 @@ thread_select (select_func *func, int max_fds, fd_set *rfds,
   return sa.result;
 }
 
+struct getaddrinfo_args
+{
+  getaddrinfo_func *func;
+  char const *node;
+  char const *service;
+  struct addrinfo const *hints;
+  struct addrinfo **res;
+  int result;
+};
+
+static void
+really_call_getaddrinfo (void *arg)
+{
+  struct getaddrinfo_args *ga = arg;
+  struct thread_state *self = current_thread;
+  sigset_t oldset;
+
+  block_interrupt_signal (&oldset);
+  self->not_holding_lock = 1;
+  release_global_lock ();
+  restore_signal_mask (&oldset);
+
+  ga->result = (ga->func) (ga->node, ga->service, ga->hints, ga->res);
+
+  block_interrupt_signal (&oldset);
+  /* See really_call_select.  */
+  if (self->not_holding_lock)
+    {
+      acquire_global_lock (self);
+      self->not_holding_lock = 0;
+    }
+  restore_signal_mask (&oldset);
+}
+
+/* Call FUNC, which is getaddrinfo or a replacement for it, without
+   holding the global lock, so that other Lisp threads can run while
+   the lookup blocks.  NODE and SERVICE must not point into Lisp
+   strings, as those can be relocated by a GC in another thread.  */
+
+int
+thread_getaddrinfo (getaddrinfo_func *func, char const *node,
+		    char const *service, struct addrinfo const *hints,
+		    struct addrinfo **res)
+{
+  struct getaddrinfo_args ga;
+
+  ga.func = func;
+  ga.node = node;
+  ga.service = service;
+  ga.hints = hints;
+  ga.res = res;
+  flush_stack_call_func (really_call_getaddrinfo, &ga);
+  return ga.result;
+}
+
 
 
 static void
@@ -301,6 +301,14 @@ XCONDVAR (Lisp_Object a)
 		    fd_set *wfds, fd_set *efds, struct timespec *timeout,
 		    sigset_t *sigmask);
 
+struct addrinfo;
+typedef int getaddrinfo_func (char const *, char const *,
+			      struct addrinfo const *, struct addrinfo **);
+
+int thread_getaddrinfo (getaddrinfo_func *func, char const *node,
+			char const *service, struct addrinfo const *hints,
+			struct addrinfo **res);
+
 bool thread_check_current_buffer (struct buffer *);
 
 #endif /* THREAD_H */
@@ -29,6 +29,10 @@ Copyright (C) 2009-2021 Free Software Foundation, Inc.
 #include "blockinput.h"
 #include "systime.h"
 
+#ifdef HAVE_EPOLL
+# include "epollselect.h"
+#endif
+
 static ptrdiff_t threads_holding_glib_lock;
 static GMainContext *glib_main_context;
 
@@ -50,6 +54,61 @@ Copyright (C) 2009-2021 Free Software Foundation, Inc.
     }
 }
 
+#ifdef HAVE_EPOLL
+
+/* The descriptors that GLib asked to poll last time, which are
+   watched with epoll_select_watch_aux, and their number.  */
+static GPollFD *watched_gfds;
+static ptrdiff_t n_watched_gfds, watched_gfds_size;
+
+/* Return what the N descriptors in GFDS ask FD to be watched for.  */
+
+static int
+gfds_want (GPollFD const *gfds, ptrdiff_t n, int fd)
+{
+  int want = 0;
+  for (ptrdiff_t i = 0; i < n; i++)
+    if (gfds[i].fd == fd)
+      want |= ((gfds[i].events & G_IO_IN ? EPOLL_SELECT_READ : 0)
+	       | (gfds[i].events & G_IO_OUT ? EPOLL_SELECT_WRITE : 0));
+  return want;
+}
+
+/* Watch the N_GFDS descriptors in GFDS with epoll_select, and stop
+   watching the ones that GLib no longer polls.  GLib polls only a
+   handful of descriptors, so comparing the lists pairwise is
+   cheap.  */
+
+static void
+watch_gfds (GPollFD const *gfds, int n_gfds)
+{
+  for (ptrdiff_t i = 0; i < n_watched_gfds; i++)
+    {
+      int fd = watched_gfds[i].fd;
+      if (0 <= fd && !gfds_want (gfds, n_gfds, fd))
+	epoll_select_watch_aux (fd, 0);
+    }
+  for (int i = 0; i < n_gfds; i++)
+    {
+      int fd = gfds[i].fd;
+      int want = gfds_want (gfds, n_gfds, fd);
+      if (0 <= fd && want != gfds_want (watched_gfds, n_watched_gfds, fd))
+	epoll_select_watch_aux (fd, want);
+    }
+
+  if (watched_gfds_size < n_gfds)
+    watched_gfds = xpalloc (watched_gfds, &watched_gfds_size,
+			    n_gfds - watched_gfds_size, -1,
+			    sizeof *watched_gfds);
+  memcpy (watched_gfds, gfds, n_gfds * sizeof *gfds);
+  n_watched_gfds = n_gfds;
+}
+
+# define xg_select_func epoll_select
+#else
+# define xg_select_func pselect
+#endif
+
 /* `xg_select' is a `pselect' replacement.  Why do we need a separate function?
    1. Timeouts.  Glib and Gtk rely on timer events.  If we did pselect
       with a greater timeout then the one scheduled by Glib, we would
@@ -116,6 +175,10 @@ xg_select (int fds_lim, fd_set *rfds, fd_set *wfds, fd_set *efds,
         }
     }
 
+#ifdef HAVE_EPOLL
+  watch_gfds (gfds, n_gfds);
+#endif
+
   if (must_free)
     xfree (gfds);
 
@@ -128,34 +191,79 @@ xg_select (int fds_lim, fd_set *rfds, fd_set *wfds, fd_set *efds,
     }
 
   fds_lim = max_fds + 1;
-  nfds = thread_select (pselect, fds_lim,
+  nfds = thread_select (xg_select_func, fds_lim,
 			&all_rfds, have_wfds ? &all_wfds : NULL, efds,
 			tmop, sigmask);
   if (nfds < 0)
     retval = nfds;
   else if (nfds > 0)
     {
-      for (i = 0; i < fds_lim; ++i)
-        {
-          if (FD_ISSET (i, &all_rfds))
-            {
-              if (rfds && FD_ISSET (i, rfds)) ++retval;
-              else ++our_fds;
-            }
-          else if (rfds)
-            FD_CLR (i, rfds);
-
-          if (have_wfds && FD_ISSET (i, &all_wfds))
-            {
-              if (wfds && FD_ISSET (i, wfds)) ++retval;
-              else ++our_fds;
-            }
-          else if (wfds)
-            FD_CLR (i, wfds);
-
-          if (efds && FD_ISSET (i, efds))
-            ++retval;
-        }
+      /* epoll_select left a list of the ready descriptors, which is
+	 cheaper to go through than the sets if it fits.  */
+      int ready[64];
+      int nready = -1;
+#ifdef HAVE_EPOLL
+      nready = epoll_select_ready_fds (ready, ARRAYELTS (ready));
+      if (ARRAYELTS (ready) < nready)
+	nready = -1;
+#endif
+
+      if (0 <= nready)
+	{
+	  fd_set ready_rfds, ready_wfds;
+	  FD_ZERO (&ready_rfds);
+	  FD_ZERO (&ready_wfds);
+	  for (i = 0; i < nready; i++)
+	    {
+	      int fd = ready[i];
+	      if (FD_ISSET (fd, &all_rfds))
+		{
+		  if (rfds && FD_ISSET (fd, rfds))
+		    {
+		      FD_SET (fd, &ready_rfds);
+		      ++retval;
+		    }
+		  else
+		    ++our_fds;
+		}
+	      if (have_wfds && FD_ISSET (fd, &all_wfds))
+		{
+		  if (wfds && FD_ISSET (fd, wfds))
+		    {
+		      FD_SET (fd, &ready_wfds);
+		      ++retval;
+		    }
+		  else
+		    ++our_fds;
+		}
+	    }
+	  if (rfds)
+	    *rfds = ready_rfds;
+	  if (wfds)
+	    *wfds = ready_wfds;
+	}
+      else
+	for (i = 0; i < fds_lim; ++i)
+	  {
+	    if (FD_ISSET (i, &all_rfds))
+	      {
+		if (rfds && FD_ISSET (i, rfds)) ++retval;
+		else ++our_fds;
+	      }
+	    else if (rfds)
+	      FD_CLR (i, rfds);
+
+	    if (have_wfds && FD_ISSET (i, &all_wfds))
+	      {
+		if (wfds && FD_ISSET (i, wfds)) ++retval;
+		else ++our_fds;
+	      }
+	    else if (wfds)
+	      FD_CLR (i, wfds);
+
+	    if (efds && FD_ISSET (i, efds))
+	      ++retval;
+	  }
     }
 
   /* If Gtk+ is in use eventually gtk_main_iteration will be called,
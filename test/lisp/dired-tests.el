@@ -517,5 +517,33 @@ dired-test-directory-files-and-attributes
       (when (file-directory-p testdir)
         (delete-directory testdir t)))))
 
+(ert-deftest dired-test-directory-files-and-attributes-parallel ()
+  "Check that `directory-files-parallel-threshold' changes no result."
+  (let ((testdir (make-temp-file "directory-files-test" t)))
+    (unwind-protect
+        (progn
+          (dotimes (i 50)
+            (make-empty-file (expand-file-name (format "f%d" i) testdir)))
+          (make-directory (expand-file-name "dir" testdir))
+          (ignore-errors
+            (make-symbolic-link "f1" (expand-file-name "link" testdir))
+            (make-symbolic-link "missing" (expand-file-name "dangling"
+                                                            testdir)))
+          (dolist (args `((,testdir nil ,directory-files-no-dot-files-regexp)
+                          (,testdir t "f[0-4]" nil string)
+                          (,testdir nil "[^.]" t integer 10)))
+            (let* ((list-files
+                    (lambda ()
+                      ;; Ignore access times, which listing changes.
+                      (mapcar (lambda (file) (setf (nth 5 file) nil) file)
+                              (apply #'directory-files-and-attributes args))))
+                   (expected (let ((directory-files-parallel-threshold nil))
+                               (funcall list-files))))
+              (should expected)
+              (dolist (threshold '(0 5 10 1000))
+                (let ((directory-files-parallel-threshold threshold))
+                  (should (equal (funcall list-files) expected)))))))
+      (delete-directory testdir t))))
+
 (provide 'dired-tests)
 ;; dired-tests.el ends here
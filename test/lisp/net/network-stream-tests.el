@@ -719,6 +719,55 @@ open-gnutls-stream-old-api-nowait
       (setq issuer (split-string issuer ","))
       (should (equal (nth 3 issuer) "O=Emacs Test Servicess LLC")))))
 
+(ert-deftest connect-to-tls-resume-session ()
+  (skip-unless (executable-find "gnutls-serv"))
+  (skip-unless (gnutls-available-p))
+  (let ((server (make-tls-server 44670))
+        (times 0)
+        (network-security-level 'low)
+        (gnutls-resume-sessions t)
+        buffers statuses)
+    (unwind-protect
+        (progn
+          (sleep-for 1)
+          (with-current-buffer (process-buffer server)
+            (message "gnutls-serv: %s" (buffer-string)))
+
+          (dotimes (_ 2)
+            (let ((buffer (generate-new-buffer "*foo*"))
+                  proc)
+              (push buffer buffers)
+              ;; It takes a while for gnutls-serv to start.
+              (while (and (null (ignore-errors
+                                  (setq proc (make-network-process
+                                              :name "bar"
+                                              :buffer buffer
+                                              :host "localhost"
+                                              :service 44670))))
+                          (< (setq times (1+ times)) 10))
+                (sit-for 0.1))
+              (should proc)
+              (gnutls-negotiate :process proc
+                                :type 'gnutls-x509pki
+                                :hostname "localhost")
+              (push (gnutls-peer-status proc) statuses)
+              ;; A TLS 1.3 session ticket only arrives after the
+              ;; handshake, so read the response before closing.
+              (process-send-string proc "GET / HTTP/1.0\r\n\r\n")
+              (while (accept-process-output proc 1))
+              (delete-process proc))))
+      (if (process-live-p server) (delete-process server))
+      ;; Killing a buffer also deletes a process left in it by a
+      ;; failed check.
+      (let ((kill-buffer-query-functions nil))
+        (mapc #'kill-buffer (cons (process-buffer server) buffers))))
+    (setq statuses (nreverse statuses))
+    (should-not (plist-get (nth 0 statuses) :resumed))
+    (should (plist-get (nth 1 statuses) :resumed))
+    ;; The certificate of a resumed session is still checked.
+    (should (equal (plist-get (nth 0 statuses) :certificate)
+                   (plist-get (nth 1 statuses) :certificate)))))
+
 (ert-deftest open-gnutls-stream-new-api-errors ()
   (skip-unless (gnutls-available-p))
   (should-error
@@ -0,0 +1,59 @@
+;;; decode-benchmark.el --- benchmark for decoding large files  -*- lexical-binding: t; -*-
+
+;; Copyright (C) 2021 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Time visiting a large UTF-8 file with and without decoding it in
+;; parallel.  This is not run by the test suite, because it needs
+;; files of 100 MB to 2 GB to be meaningful; run it like this:
+;;
+;;   emacs -Q -batch -l test/manual/decode-benchmark.el \
+;;     --eval '(print (decode-benchmark-parallel 500000000))'
+
+;;; Code:
+
+(require 'benchmark)
+
+(defun decode-benchmark-parallel (bytes &optional coding)
+  "Time visiting a file of about BYTES bytes of UTF-8 text.
+Read the file with CODING, `utf-8-dos' by default, first with all
+the decoding done by the main thread and then with
+`parallel-decoding-threshold' set.  Return the two elapsed times in
+seconds."
+  (let ((file (make-temp-file "decode-benchmark")))
+    (unwind-protect
+        (progn
+          (with-temp-buffer
+            (insert "Lorem ipsum dolor sit amet, föö bär あい\n")
+            (while (< (buffer-size) bytes)
+              (insert (buffer-string)))
+            (let ((coding-system-for-write 'utf-8-dos))
+              (write-region nil nil file nil 'silent)))
+          (mapcar (lambda (threshold)
+                    (garbage-collect)
+                    (car (benchmark-run 1
+                           (with-temp-buffer
+                             (let ((coding-system-for-read
+                                    (or coding 'utf-8-dos))
+                                   (parallel-decoding-threshold threshold))
+                               (insert-file-contents file))))))
+                  (list nil (* 1024 1024))))
+      (delete-file file))))
+
+;;; decode-benchmark.el ends here
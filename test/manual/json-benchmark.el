@@ -0,0 +1,54 @@
+;;; json-benchmark.el --- benchmark for parsing JSON  -*- lexical-binding: t; -*-
+
+;; Copyright (C) 2021 Free Software Foundation, Inc.
+
+;; This file is part of GNU Emacs.
+
+;; GNU Emacs is free software: you can redistribute it and/or modify
+;; it under the terms of the GNU General Public License as published by
+;; the Free Software Foundation, either version 3 of the License, or
+;; (at your option) any later version.
+
+;; GNU Emacs is distributed in the hope that it will be useful,
+;; but WITHOUT ANY WARRANTY; without even the implied warranty of
+;; MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+;; GNU General Public License for more details.
+
+;; You should have received a copy of the GNU General Public License
+;; along with GNU Emacs.  If not, see <https://www.gnu.org/licenses/>.
+
+;;; Commentary:
+
+;; Time how long Emacs takes to parse JSON that uses the same object
+;; keys over and over, as language server responses do.  This is not
+;; run by the test suite; run it like this:
+;;
+;;   emacs -Q -batch -l test/manual/json-benchmark.el \
+;;     --eval '(print (json-benchmark-keys 1000))'
+
+;;; Code:
+
+(require 'benchmark)
+
+(defun json-benchmark-keys (count &optional object-type)
+  "Time parsing COUNT copies of a typical language server response.
+Objects are parsed as OBJECT-TYPE, `hash-table' by default.  The
+response is a list of diagnostics, whose objects use the same few
+keys over and over.  Return the elapsed time in seconds, not
+counting garbage collection."
+  (let* ((item "{\"range\":{\"start\":{\"line\":41,\"character\":8},\
+\"end\":{\"line\":41,\"character\":19}},\"severity\":2,\"code\":\"unused\",\
+\"source\":\"clangd\",\"message\":\"Unused variable\",\"relatedInformation\":[],\
+\"tags\":[1],\"codeDescription\":{\"href\":\"https://example.org\"}}")
+         (json (concat "{\"jsonrpc\":\"2.0\",\"method\":\
+\"textDocument/publishDiagnostics\",\"params\":{\"uri\":\"file:///a.c\",\
+\"version\":7,\"diagnostics\":["
+                       (mapconcat #'identity (make-list 500 item) ",")
+                       "]}}"))
+         (object-type (or object-type 'hash-table))
+         (gc-cons-threshold most-positive-fixnum))
+    (garbage-collect)
+    (car (benchmark-run count
+           (json-parse-string json :object-type object-type)))))
+
+;;; json-benchmark.el ends here
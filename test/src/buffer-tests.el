@@ -1361,4 +1361,53 @@ buffer-tests-inhibit-buffer-hooks
           (should run-kbqf))
       (remove-hook 'buffer-list-update-hook bluh))))
 
+(ert-deftest buffer-tests-edit-near-end ()
+  "Check edits near the end of a buffer whose gap is far away."
+  (let ((line "Lorem ipsum dolor sit amet, f\303\266\303\266 b\303\244r\n")
+        (other (generate-new-buffer " *other*" t)))
+    (unwind-protect
+        (with-temp-buffer
+          (dotimes (_ 50000) (insert line))
+          (let ((expected (buffer-string))
+                (end (point-marker)))
+            (goto-char (point-min))
+            (insert "head")
+            (setq expected (concat "head" expected))
+            (should (= (gap-position) 5))
+            ;; Insert with each of the insertion primitives.
+            (goto-char (- (point-max) 10))
+            (insert "x\u00e9")
+            (insert (propertize "yz" 'face 'bold))
+            (with-current-buffer other (insert "<other>"))
+            (insert-buffer-substring other)
+            (let ((pos (- (length expected) 10)))
+              (setq expected (concat (substring expected 0 pos)
+                                     "x\u00e9yz<other>"
+                                     (substring expected pos))))
+            (should (= (gap-position) 5))
+            (should (equal (buffer-string) expected))
+            (should (eq (get-text-property (- (point) 9) 'face) 'bold))
+            (should (= end (point-max)))
+            ;; Delete, and insert text copied from this very buffer.
+            (delete-region (- (point-max) 3) (point-max))
+            (setq expected (substring expected 0 -3))
+            (goto-char (- (point-max) 20))
+            (insert-buffer-substring (current-buffer) 1 5)
+            (let ((pos (- (length expected) 20)))
+              (setq expected (concat (substring expected 0 pos) "head"
+                                     (substring expected pos))))
+            (should (equal (buffer-string) expected))
+            (should (= end (point-max)))
+            ;; The free space at the end survives compaction and growing
+            ;; the gap.
+            (garbage-collect)
+            (goto-char (point-max))
+            (insert "tail")
+            (goto-char (point-min))
+            (insert (make-string 100000 ?a))
+            (setq expected (concat (make-string 100000 ?a) expected "tail"))
+            (should (equal (buffer-string) expected))
+            (should (= end (- (point-max) 4)))))
+      (kill-buffer other))))
+
 ;;; buffer-tests.el ends here
@@ -76,4 +76,75 @@ call-process-region-entire-buffer-with-delete
        (eq (call-process-region nil nil emacs :delete nil nil "--version") 0))
       (should (eq (buffer-size) 0)))))
 
+(ert-deftest call-process-environment-block ()
+  "Check that the first setting of each variable wins."
+  (skip-unless (executable-find "env"))
+  (let ((process-environment
+         (append '("CALLPROC_A=1" "CALLPROC_B" "CALLPROC_A=2"
+                   "CALLPROC_B=3" "CALLPROC_AB=4")
+                 (mapcar (lambda (i) (format "CALLPROC_%d=%d" i i))
+                         (number-sequence 1 1000))
+                 '("CALLPROC_7=8")
+                 process-environment)))
+    (with-temp-buffer
+      (should (eq (call-process "env" nil t) 0))
+      (let ((env (split-string (buffer-string) "\n" t)))
+        (should (member "CALLPROC_A=1" env))
+        (should-not (member "CALLPROC_A=2" env))
+        (should-not (cl-find-if (lambda (s) (string-prefix-p "CALLPROC_B=" s))
+                                env))
+        (should (member "CALLPROC_AB=4" env))
+        (should (member "CALLPROC_7=7" env))
+        (should-not (member "CALLPROC_7=8" env))
+        (should (member "CALLPROC_1000=1000" env))))))
+
+(ert-deftest call-process-unibyte-output ()
+  "Check that raw output lands at point with balanced change hooks."
+  (skip-unless (executable-find "cat"))
+  (let ((data (apply #'unibyte-string
+                     (mapcar (lambda (i) (% (* i 7) 256))
+                             (number-sequence 1 300000))))
+        (file (make-temp-file "callproc-tests"))
+        (changes nil))
+    (unwind-protect
+        (progn
+          (let ((coding-system-for-write 'no-conversion))
+            (write-region data nil file nil 'silent))
+          (with-temp-buffer
+            (set-buffer-multibyte nil)
+            (insert "ab")
+            (goto-char 2)
+            (add-hook 'before-change-functions
+                      (lambda (beg end) (push (list 'before beg end) changes))
+                      nil t)
+            (add-hook 'after-change-functions
+                      (lambda (beg end len)
+                        (push (list 'after beg end len) changes))
+                      nil t)
+            (let ((coding-system-for-read 'no-conversion))
+              (should (eq (call-process "cat" file t nil) 0)))
+            (should (equal (buffer-string) (concat "a" data "b")))
+            (should (= (point) (+ 2 (length data))))
+            (setq changes (nreverse changes))
+            (should (cl-evenp (length changes)))
+            (let ((pos 2))
+              (while changes
+                (pcase-let ((`(before ,b1 ,e1) (pop changes))
+                            (`(after ,b2 ,e2 ,len) (pop changes)))
+                  (should (= b1 e1 b2 pos))
+                  (should (= len 0))
+                  (setq pos e2)))
+              (should (= pos (point))))))
+      (delete-file file))))
+
+(ert-deftest call-process-no-output-read-only ()
+  "Check that a read-only buffer is fine if there is no output."
+  (skip-unless (executable-find "true"))
+  (with-temp-buffer
+    (set-buffer-multibyte nil)
+    (setq buffer-read-only t)
+    (let ((coding-system-for-read 'no-conversion))
+      (should (eq (call-process "true" nil t) 0)))
+    (should (equal (buffer-string) ""))))
+
 ;;; callproc-tests.el ends here
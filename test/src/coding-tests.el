@@ -429,6 +429,87 @@ coding-check-coding-systems-region
                  '((iso-latin-1 3) (us-ascii 1 3))))
   (should-error (check-coding-systems-region "å" nil '(bad-coding-system))))
 
+(ert-deftest coding-utf-8-decode-in-place ()
+  "Check decoding of UTF-8 text that is copied rather than decoded."
+  (let* ((raw (lambda (byte) (string (unibyte-char-to-multibyte byte))))
+         (valid "ascii, \303\251, \342\202\254, \360\237\230\200, \364\220\200\200")
+         (valid-decoded (concat "ascii, é, €, \U0001F600, "
+                                (string #x110000)))
+         (long (apply #'concat (make-list 5000 valid)))
+         (long-decoded (apply #'concat (make-list 5000 valid-decoded))))
+    (dolist (case `((,valid . ,valid-decoded)
+                    (,long . ,long-decoded)
+                    ;; Invalid, overlong and surrogate sequences after
+                    ;; a valid prefix are decoded as raw bytes.
+                    (,(concat long "\300\200x\355\240\200y\303")
+                     . ,(concat long-decoded (funcall raw #xc0)
+                                (funcall raw #x80) "x" (funcall raw #xed)
+                                (funcall raw #xa0) (funcall raw #x80) "y"
+                                (funcall raw #xc3)))
+                    (,(concat long "\r\nz\r") . ,(concat long-decoded "\nz\r"))))
+      (let ((input (car case))
+            (expected (cdr case))
+            (file (make-temp-file "coding-tests")))
+        (unwind-protect
+            (progn
+              (should (equal (decode-coding-string input 'utf-8-dos)
+                             expected))
+              (let ((coding-system-for-write 'no-conversion))
+                (write-region input nil file nil 'silent))
+              (dolist (coding '(utf-8-dos utf-8))
+                (with-temp-buffer
+                  (let ((coding-system-for-read coding))
+                    (insert-file-contents file))
+                  (should (equal (buffer-string)
+                                 (decode-coding-string input coding)))))
+              (with-temp-buffer
+                (insert "ab")
+                (goto-char 2)
+                (decode-coding-string input 'utf-8-dos nil (current-buffer))
+                (should (equal (buffer-string) (concat "a" expected "b")))))
+          (delete-file file))))))
+
+(ert-deftest coding-utf-8-decode-parallel ()
+  "Check that decoding in parallel gives the same result as serially."
+  (let* ((unit "a\303\251\r\n\342\202\254x\n\360\237\230\200\r")
+         (file (make-temp-file "coding-tests")))
+    (unwind-protect
+        (dolist (input (list (apply #'concat (make-list 3001 unit))
+                             (concat (apply #'concat (make-list 2000 unit))
+                                     "\377"
+                                     (apply #'concat (make-list 2000 unit)))
+                             (concat (make-string 50000 ?a) "\r\n\303\251")))
+          (let ((coding-system-for-write 'no-conversion))
+            (write-region input nil file nil 'silent))
+          (dolist (coding '(utf-8 utf-8-unix utf-8-dos))
+            (let ((results
+                   (mapcar (lambda (threshold)
+                             (with-temp-buffer
+                               (let ((coding-system-for-read coding)
+                                     (parallel-decoding-threshold threshold))
+                                 (insert-file-contents file)
+                                 (list (buffer-string)
+                                       last-coding-system-used))))
+                           '(nil 1))))
+              (should (equal (car results) (cadr results))))))
+      (delete-file file))))
+
+(ert-deftest coding-detect-after-ascii ()
+  "Check detection of text that follows a run of ASCII."
+  (pcase-dolist (`(,tail ,detected ,decoded)
+                 '(("\r\n" undecided-dos undecided-dos)
+                   ("x\ny\n" undecided-unix undecided)
+                   ("\e$B$\"\e(B" iso-2022-7bit undecided)
+                   ("\0" no-conversion undecided)
+                   ("\303\251" utf-8 utf-8)
+                   ("\351t\351" iso-latin-1 iso-latin-1)))
+    (dotimes (n 20)
+      (let ((input (concat (make-string (+ 1000 n) ?a) tail))
+            (last-coding-system-used nil))
+        (should (eq (detect-coding-string input t) detected))
+        (decode-coding-string input 'undecided)
+        (should (eq last-coding-system-used decoded))))))
+
 ;; Local Variables:
 ;; byte-compile-warnings: (not obsolete)
 ;; End:
@@ -364,6 +364,29 @@ data-tests--let-buffer-local
           (should (equal (default-value var) (symbol-value var))))
         (should (equal (default-value var) def))))))
 
+;; `deactivate-mark' is forwarded to a C variable and automatically
+;; buffer-local, so `let' binds it through the loaded binding.
+(ert-deftest data-tests--let-localized-forwarded ()
+  (let ((def (default-value 'deactivate-mark)))
+    (with-temp-buffer
+      (let ((a (current-buffer)))
+        (let ((deactivate-mark 'outer))
+          (should (eq (default-value 'deactivate-mark) 'outer))
+          (with-temp-buffer
+            (setq-local deactivate-mark 'local)
+            (let ((deactivate-mark 'inner))
+              (should (eq deactivate-mark 'inner))
+              (should (eq (buffer-local-value 'deactivate-mark a) 'outer)))
+            (should (eq deactivate-mark 'local))
+            ;; Unbinding in a buffer other than the current one.
+            (let ((b (current-buffer)))
+              (let ((deactivate-mark 'again))
+                (set-buffer a))
+              (should (eq (buffer-local-value 'deactivate-mark b) 'local))))
+          (should (eq deactivate-mark 'outer)))
+        (should (eq deactivate-mark def))))
+    (should (eq (default-value 'deactivate-mark) def))))
+
 (ert-deftest binding-test-makunbound ()
   "Tests of makunbound, from the manual."
   (with-current-buffer binding-test-buffer-B
@@ -726,6 +749,45 @@ data-tests-ash-lsh
   (should (= (lsh -1 -1) most-positive-fixnum))
   (should-error (lsh (1- most-negative-fixnum) -1)))
 
+;; Integers a little wider than 64 bits are handled without GMP where
+;; possible; check the results on both sides of the 64- and 128-bit
+;; boundaries.
+(ert-deftest data-tests-wide-integer-arith ()
+  (let ((b63 (ash 1 63)) (b64 (ash 1 64))
+        (b127 (ash 1 127)) (b128 (ash 1 128)))
+    (should (= (+ (1- b64) 1) b64))
+    (should (= (- (- b64) 1) (- -1 b64)))
+    (should (= (* b63 b64) b127))
+    (should (= (* b64 b64) b128))
+    (should (= (+ b127 b127) b128))
+    (should (= (- (- b127) 1) (- -1 b127)))
+    (should (= (* 3 b64 b64 b64) (* 3 (ash 1 192))))
+    (should (equal (format "%x" (* #xffffffffffffffff #xffffffffffffffff))
+                   "fffffffffffffffe0000000000000001"))
+    (should (= (/ b128 b64) b64))
+    (should (= (/ (- b127) -1) b127))
+    (should (= (/ (1+ b127) (- b64)) (- b63)))
+    (should-error (/ b127 0) :type 'arith-error)
+    (should (= (logand (1- b128) #xffff) #xffff))
+    (should (= (logand (1- b127) (- b64)) (- b127 b64)))
+    (should (= (logior b64 1) (1+ b64)))
+    (should (= (logxor (1- b127) -1) (- b127)))
+    (should (= (+ b64 1.0) (+ (float b64) 1)))
+    (should (= (+ 1 b64 0.5) (+ (float b64) 1.5)))))
+
+(ert-deftest data-tests-wide-integer-ash ()
+  (let ((b64 (ash 1 64)) (b127 (ash 1 127)))
+    (should (= (ash 1 64) (* 2 (ash 1 63))))
+    (should (= (ash 1 127) (* b64 (ash 1 63))))
+    (should (= (ash -1 127) (- b127)))
+    (should (= (ash 3 126) (* 3 (ash 1 126))))
+    (should (= (ash (1+ b64) 63) (+ b127 (ash 1 63))))
+    (should (= (ash b127 -126) 2))
+    (should (= (ash (- b127) -127) -1))
+    (should (= (ash (- b127) -200) -1))
+    (should (= (ash (1- b64) -200) 0))
+    (should (= (ash (- (1+ b64)) -1) (- (1+ (ash 1 63)))))))
+
 (ert-deftest data-tests-make-local-forwarded-var () ;bug#34318
   ;; Boy, this bug is tricky to trigger.  You need to:
   ;; - call make-local-variable on a forwarded var (i.e. one that
@@ -259,6 +259,20 @@ format-with-field
                  '(error "Invalid format operation %$")))
   (should (equal (format "%1$c %1$s" ?±) "± 177")))
 
+(ert-deftest format-string-width ()
+  ;; Without a field width or precision, "%s" copies its argument
+  ;; without measuring it; with them, the display width still counts.
+  (let ((wide "日本語")
+        (comp (compose-string (string ?a ?\u0301))))
+    (should (equal (format "[%s]" wide) "[日本語]"))
+    (should (equal (format "[%7s]" wide) "[ 日本語]"))
+    (should (equal (format "[%-7s]" wide) "[日本語 ]"))
+    (should (equal (format "[%.4s]" wide) "[日本]"))
+    (should (equal (format "[%s]" comp) (concat "[" comp "]")))
+    (should (equal (format "[%3s]" comp) (concat "[  " comp "]")))
+    (should (equal (format "%s%s" "é" (string-to-unibyte "\351"))
+                   (concat "é" (string-to-multibyte "\351"))))))
+
 (ert-deftest replace-buffer-contents-1 ()
   (with-temp-buffer
     (insert #("source" 2 4 (prop 7)))
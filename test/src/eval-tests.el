@@ -226,4 +226,38 @@ eval-tests/backtrace-in-batch-mode/demoted-errors
       (should (equal (string-trim (buffer-string))
                      "Error: (error \"Boo\")")))))
 
+;; Byte-compiled lexical functions, one per arity class handled by the
+;; argument prologue in exec_byte_code.
+(defalias 'eval-tests--fixed (byte-compile (lambda (a b) (list a b))))
+(defalias 'eval-tests--optional
+  (byte-compile (lambda (a &optional b c) (list a b c))))
+(defalias 'eval-tests--rest (byte-compile (lambda (a &rest r) (cons a r))))
+
+(ert-deftest eval-tests-bytecode-arity-classes ()
+  (should (equal (eval-tests--fixed 1 2) '(1 2)))
+  (should-error (eval-tests--fixed 1) :type 'wrong-number-of-arguments)
+  (should (equal (eval-tests--optional 1) '(1 nil nil)))
+  (should (equal (eval-tests--optional 1 2) '(1 2 nil)))
+  (should (equal (eval-tests--optional 1 2 3) '(1 2 3)))
+  (should-error (eval-tests--optional 1 2 3 4)
+                :type 'wrong-number-of-arguments)
+  (should (equal (eval-tests--rest 1) '(1)))
+  (should (equal (eval-tests--rest 1 2 3) '(1 2 3)))
+  (should (equal (apply #'eval-tests--rest 1 '(2 3)) '(1 2 3))))
+
+(ert-deftest eval-tests-apply-share-rest-args ()
+  (let ((compiled (byte-compile '(lambda (_a &rest r) r)))
+        (interpreted (eval '(lambda (_a &rest r) r) nil))
+        (args (list 2 3 4)))
+    (dolist (fun (list compiled interpreted))
+      (let ((apply-share-rest-args nil))
+        (should (equal (apply fun 1 args) args))
+        (should-not (eq (apply fun 1 args) args)))
+      (let ((apply-share-rest-args t))
+        (should (eq (apply fun 1 args) args))
+        ;; Only the exact tail spread by `apply' is shared.
+        (should (equal (apply fun 1 0 args) (cons 0 args)))
+        (should (equal (apply fun args) (cdr args)))
+        (should (equal (funcall fun 1 2 3 4) args))))))
+
 ;;; eval-tests.el ends here
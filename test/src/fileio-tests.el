@@ -160,4 +160,150 @@ fileio-tests/null-character
   (should-error (file-exists-p "/foo\0bar")
                 :type 'wrong-type-argument))
 
+(ert-deftest fileio-tests-write-region-utf-8 ()
+  "Check that `write-region' writes UTF-8 text as expected."
+  (let ((file (make-temp-file "fileio"))
+        (a (make-string 5000 ?a))
+        (b (make-string 5000 ?b)))
+    (unwind-protect
+        (pcase-dolist (`(,extra . ,encoded)
+                       `(("" . "")
+                         ("x\ny\n" . "x\ny\n")
+                         (,(string #x3fff80 ?\n) . "\200\n")))
+          (pcase-dolist (`(,coding . ,bom)
+                         '((utf-8-unix . "") (utf-8-dos . "")
+                           (utf-8-with-signature-unix . "\357\273\277")))
+            (with-temp-buffer
+              (insert a "f\u00f6\u00f6 \U0001F600\n" b extra)
+              (let ((half (buffer-size)))
+                (insert a "f\u00f6\u00f6 \U0001F600\n" b extra)
+                ;; Leave the gap in the middle of the text.
+                (goto-char half)
+                (insert "z"))
+              (let ((coding-system-for-write coding))
+                (write-region nil nil file nil 'silent))
+              (let* ((half (concat a "f\303\266\303\266 \360\237\230\200\n"
+                                   b encoded))
+                     (expected (concat bom (substring half 0 -1) "z"
+                                       (substring half -1) half)))
+                (when (eq coding 'utf-8-dos)
+                  (setq expected (string-replace "\n" "\r\n" expected)))
+                (should (equal (encode-coding-string (buffer-string) coding)
+                               expected))
+                (should (equal (with-temp-buffer
+                                 (set-buffer-multibyte nil)
+                                 (insert-file-contents-literally file)
+                                 (buffer-string))
+                               expected))))))
+      (delete-file file))))
+
+(ert-deftest fileio-tests-insert-file-contents-mapped ()
+  "Check that mapping a file gives the same buffer as reading it."
+  (let ((file (make-temp-file "fileio"))
+        (a (make-string 5000 ?a))
+        (create-lockfiles nil))
+    (unwind-protect
+        (pcase-dolist (`(,contents . ,coding)
+                       `((,a)
+                         (,(make-string 8192 ?b))
+                         (,(concat a "f\303\266\303\266\n") . utf-8)
+                         (,(concat a "f\303\266\303\266\r\n") . utf-8)
+                         (,(concat a "f\366\366\n") . latin-1)
+                         (,(concat "-*- coding: latin-1 -*-\n" a "\366\n"))
+                         (,(concat a "\366\r\n") . no-conversion)))
+          (let ((coding-system-for-write 'no-conversion))
+            (write-region contents nil file nil 'silent))
+          (let ((visit
+                 (lambda (threshold multibyte)
+                   (with-temp-buffer
+                     (set-buffer-multibyte multibyte)
+                     (let ((large-file-mapping-threshold threshold)
+                           (coding-system-for-read coding))
+                       (insert-file-contents file t))
+                     (let ((result (list (buffer-string)
+                                         enable-multibyte-characters
+                                         last-coding-system-used)))
+                       ;; Editing the text must not touch the file.
+                       (goto-char (point-min))
+                       (insert "x")
+                       (should (equal (buffer-substring 2 (point-max))
+                                      (car result)))
+                       (set-buffer-modified-p nil)
+                       result)))))
+            (dolist (multibyte '(nil t))
+              (should (equal (funcall visit 1 multibyte)
+                             (funcall visit nil multibyte)))))
+          (should (equal (with-temp-buffer
+                           (set-buffer-multibyte nil)
+                           (insert-file-contents-literally file)
+                           (buffer-string))
+                         contents)))
+      (delete-file file))))
+
+(ert-deftest fileio-tests-insert-file-contents-mapped-truncated ()
+  "Check that truncating a mapped file signals an error."
+  (skip-unless (eq system-type 'gnu/linux))
+  (let ((file (make-temp-file "fileio"))
+        (create-lockfiles nil))
+    (unwind-protect
+        ;; The second time checks that the first left SIGBUS handled.
+        (dotimes (_ 2)
+          (with-temp-buffer
+            (set-buffer-multibyte nil)
+            (write-region (make-string 100000 ?a) nil file nil 'silent)
+            (let ((large-file-mapping-threshold 1))
+              (insert-file-contents-literally file))
+            (write-region "b" nil file nil 'silent)
+            (should-error (let ((text (buffer-string)))
+                            (dotimes (_ 2) (eval '(ignore)))
+                            text))
+            (should (equal (buffer-substring 1 3) "b\0"))
+            (should (equal (buffer-substring (- (point-max) 10) (point-max))
+                           (make-string 10 0)))))
+      (delete-file file))))
+
+(ert-deftest fileio-tests-insert-file-contents-mapped-changed ()
+  "Check that changing a mapped file is reported."
+  (skip-unless (eq system-type 'gnu/linux))
+  (let ((file (make-temp-file "fileio"))
+        (create-lockfiles nil))
+    (unwind-protect
+        (with-temp-buffer
+          (set-buffer-multibyte nil)
+          (write-region (make-string 100000 ?a) nil file nil 'silent)
+          ;; Make sure that the change below changes the time.
+          (set-file-times file 0)
+          (let ((large-file-mapping-threshold 1))
+            (insert-file-contents-literally file))
+          (write-region "bc" nil file 10 'silent)
+          (goto-char (point-min))
+          (should-error (insert "x"))
+          (should (equal (buffer-string)
+                         (concat (make-string 10 ?a) "bc"
+                                 (make-string 99988 ?a))))
+          (insert "x")
+          (should (= (buffer-size) 100001)))
+      (delete-file file))))
+
+(ert-deftest fileio-tests-write-region-mapped ()
+  "Check that a mapped buffer can be written to its own file."
+  (let ((file (make-temp-file "fileio"))
+        (contents (make-string 100000 ?a))
+        (create-lockfiles nil))
+    (unwind-protect
+        (with-temp-buffer
+          (set-buffer-multibyte nil)
+          (write-region contents nil file nil 'silent)
+          (let ((large-file-mapping-threshold 1))
+            (insert-file-contents-literally file))
+          (let ((coding-system-for-write 'no-conversion))
+            (write-region nil nil file nil 'silent))
+          (should (equal (buffer-string) contents))
+          (should (equal (with-temp-buffer
+                           (set-buffer-multibyte nil)
+                           (insert-file-contents-literally file)
+                           (buffer-string))
+                         contents)))
+      (delete-file file))))
+
 ;;; fileio-tests.el ends here
@@ -124,4 +124,94 @@ big-round
   (should (= (floor 1.7976931348623157e+308 5e-324)
              (ash (1- (ash 1 53)) 2045))))
 
+;;; Numeric vectors.
+
+(ert-deftest floatfns-tests-numeric-vector-basics ()
+  (let ((f (make-f64vector 3 1))
+        (i (i64vector 1 2 3)))
+    (should (f64vectorp f))
+    (should (i64vectorp i))
+    (should (numeric-vector-p f))
+    (should (arrayp i))
+    (should (eq (type-of f) 'f64vector))
+    (should (eq (type-of i) 'i64vector))
+    (should (= (length f) 3))
+    (should (eql (aref f 0) 1.0))
+    (aset f 1 2.5)
+    (should (equal (append f nil) '(1.0 2.5 1.0)))
+    (should (equal (mapcar #'1+ i) '(2 3 4)))
+    (should (equal (reverse i) (i64vector 3 2 1)))
+    (should-not (equal (f64vector 1) (i64vector 1)))
+    (should (= (sxhash-equal (f64vector 1 2)) (sxhash-equal (f64vector 1 2))))
+    (should-error (aset i 0 1.5) :type 'wrong-type-argument)
+    (should-error (aset i 0 (ash 1 64)) :type 'overflow-error)
+    (should-error (aref f 3) :type 'args-out-of-range)
+    (fillarray i 7)
+    (should (equal i (i64vector 7 7 7)))))
+
+(ert-deftest floatfns-tests-numeric-vector-read-print ()
+  (dolist (v (list (f64vector) (f64vector 1 -0.0 1.0e+INF 0.5)
+                   (i64vector (1- (ash 1 63)) (- (ash 1 63)) 0)))
+    (let ((s (prin1-to-string v)))
+      (should (equal (read s) v))))
+  (should (equal (prin1-to-string (i64vector 1 2)) "#i64[1 2]"))
+  (should (equal (read "#f64[1 2.5]") (f64vector 1.0 2.5)))
+  (should-error (read "#i64[1.5]") :type 'wrong-type-argument)
+  (should-error (read "#f32[1]") :type 'invalid-read-syntax))
+
+(ert-deftest floatfns-tests-numeric-vector-arith ()
+  (let ((a (f64vector 1 2 3 4 5))
+        (b (f64vector 5 4 3 2 1)))
+    (should (equal (numeric-vector-add a b) (make-f64vector 5 6)))
+    (should (equal (numeric-vector-sub a 1) (f64vector 0 1 2 3 4)))
+    (should (equal (numeric-vector-mul a 2) (f64vector 2 4 6 8 10)))
+    (should (equal (numeric-vector-div a b) (f64vector 0.2 0.5 1 2 5)))
+    (should (eq (numeric-vector-add a b a) a))
+    (should (equal a (make-f64vector 5 6)))
+    (should-error (numeric-vector-add a (f64vector 1))
+                  :type 'wrong-length-argument)
+    (should-error (numeric-vector-add a (i64vector 1 2 3 4 5))
+                  :type 'wrong-type-argument))
+  (let ((a (i64vector 7 -7 (1- (ash 1 63)))))
+    (should (equal (numeric-vector-div a 2) (i64vector 3 -3 (1- (ash 1 62)))))
+    (should-error (numeric-vector-add a 1) :type 'overflow-error)
+    (should-error (numeric-vector-div a 0) :type 'arith-error)
+    (should-error (numeric-vector-add a 1 a) :type 'overflow-error)
+    (should (equal a (i64vector 7 -7 (1- (ash 1 63)))))
+    (should-error (numeric-vector-div a (i64vector 1 0 1) a)
+                  :type 'arith-error)
+    (should (equal a (i64vector 7 -7 (1- (ash 1 63)))))
+    (should-error (numeric-vector-div (i64vector (- (ash 1 63))) -1)
+                  :type 'overflow-error)))
+
+(ert-deftest floatfns-tests-numeric-vector-reductions ()
+  (let ((f (f64vector 3 -1 4 1 5 9 2 6))
+        (i (i64vector 3 -1 4 1 5 9 2 6)))
+    (should (= (numeric-vector-sum f) 29.0))
+    (should (eql (numeric-vector-sum i) 29))
+    (should (eql (numeric-vector-min f) -1.0))
+    (should (eql (numeric-vector-max i) 9))
+    (should (= (numeric-vector-dot f f) 173.0))
+    (should (eql (numeric-vector-dot i i) 173))
+    (should (isnan (numeric-vector-max (f64vector 1 0.0e+NaN 2))))
+    (should-error (numeric-vector-min (i64vector)) :type 'args-out-of-range))
+  ;; i64 reductions that overflow 64 bits fall back to bignums.
+  (let ((big (1- (ash 1 63))))
+    (should (= (numeric-vector-sum (i64vector big big)) (* 2 big)))
+    (should (= (numeric-vector-dot (i64vector big) (i64vector big))
+               (* big big)))))
+
+(ert-deftest floatfns-tests-numeric-vector-sort-search ()
+  (let ((f (numeric-vector-sort (f64vector 3 0.0e+NaN -1 2)))
+        (i (numeric-vector-sort (i64vector 5 1 4 1))))
+    (should (equal (append i nil) '(1 1 4 5)))
+    (should (equal (butlast (append f nil)) '(-1.0 2.0 3.0)))
+    (should (isnan (aref f 3)))
+    (should (= (numeric-vector-search i 1) 0))
+    (should (= (numeric-vector-search i 2) 2))
+    (should (= (numeric-vector-search i 4.5) 3))
+    (should (= (numeric-vector-search i (ash 1 70)) 4))
+    (should (= (numeric-vector-search f 2) 1))
+    (should (= (numeric-vector-search f 100) 3))))
+
 (provide 'floatfns-tests)
@@ -308,5 +308,113 @@ json-serialize/wrong-hash-key-type
     (puthash 1 2 table)
     (should-error (json-serialize table) :type 'wrong-type-argument)))
 
+(ert-deftest json-parse-buffer/gap ()
+  (skip-unless (fboundp 'json-parse-buffer))
+  (let ((json "{\"k\\u00e9y\": \"v\u00e4lue\", \"n\": -12.5e1, \"a\": [1, true]} x"))
+    (dotimes (gap (length json))
+      (with-temp-buffer
+        (insert json)
+        (goto-char (1+ gap))
+        (insert "z")
+        (delete-char -1)
+        (goto-char 1)
+        (should (equal (json-parse-buffer :object-type 'alist)
+                       `((,(intern "k\u00e9y") . "v\u00e4lue") (n . -125.0)
+                         (a . [1 t]))))
+        (should (looking-at-p " x"))))))
+
+(ert-deftest json-parse-string/numbers ()
+  (skip-unless (fboundp 'json-parse-string))
+  (should (equal (json-parse-string
+                  "[0, -0, 12, 0.5, -1e3, 1E-2, 123456789012345678901234]")
+                 [0 0 12 0.5 -1000.0 0.01 123456789012345678901234]))
+  (should-error (json-parse-string "[01]") :type 'json-parse-error)
+  (should-error (json-parse-string "[1.]") :type 'json-parse-error)
+  (should-error (json-parse-string "[-]") :type 'json-parse-error)
+  (should-error (json-parse-string "[1e999]") :type 'json-parse-error)
+  (should (equal (json-serialize [0.1 1.0 -2.5e-300]) "[0.1,1.0,-2.5e-300]"))
+  (should-error (json-serialize [1.0e+INF]) :type 'wrong-type-argument))
+
+(ert-deftest json-parse-string/large-object ()
+  "Check duplicate keys in objects with many members."
+  (skip-unless (fboundp 'json-parse-string))
+  (let ((input (concat "{"
+                       (mapconcat (lambda (i) (format "\"k%d\":%d" (% i 25) i))
+                                  (number-sequence 0 39) ",")
+                       "}")))
+    (let ((alist (json-parse-string input :object-type 'alist)))
+      (should (equal (length alist) 25))
+      (should (equal (car alist) '(k0 . 25)))
+      (should (equal (nth 24 alist) '(k24 . 24))))
+    (should (equal (hash-table-count (json-parse-string input)) 25))
+    (should (equal (json-serialize (json-parse-string input :object-type 'plist))
+                   (json-serialize (json-parse-string input
+                                                      :object-type 'alist))))))
+
+(ert-deftest json-parse-string/error-data ()
+  (skip-unless (fboundp 'json-parse-string))
+  (should (equal (should-error (json-parse-string "[1,\n 2 3]"))
+                 '(json-parse-error "',' or ']' expected" "<string>" 2 4 8))))
+
+(ert-deftest json-parse-string/shared-keys ()
+  (skip-unless (fboundp 'json-parse-string))
+  (let* ((input "[{\"k\\u00e9y\":1,\"b\":2},{\"kéy\":3,\"b\":4}]")
+         (tables (json-parse-string input))
+         (keys (mapcar (lambda (table)
+                         (let (keys)
+                           (maphash (lambda (k _) (push k keys)) table)
+                           (nreverse keys)))
+                       tables)))
+    (should (equal (car keys) '("kéy" "b")))
+    (should (eq (car (nth 0 keys)) (car (nth 1 keys))))
+    (should (equal (gethash "kéy" (aref tables 1)) 3))
+    (should (equal (json-parse-string input :object-type 'plist)
+                   [(:kéy 1 :b 2) (:kéy 3 :b 4)])))
+  ;; Keys beyond the cache limits are still made correctly.
+  (dolist (prefix (list "k" (make-string 100 ?x)))
+    (let* ((input (concat "["
+                          (mapconcat (lambda (i)
+                                       (format "{\"%s%d\":%d}" prefix i i))
+                                     (number-sequence 0 5000) ",")
+                          "]"))
+           (alists (json-parse-string input :object-type 'alist))
+           (tables (json-parse-string input)))
+      (should (eq (caar (aref alists 4999)) (intern (format "%s4999" prefix))))
+      (should (equal (gethash (format "%s5000" prefix) (aref tables 5000))
+                     5000)))))
+
+(ert-deftest json-parser-feed/chunks ()
+  (skip-unless (fboundp 'json-make-parser))
+  (let ((input (encode-coding-string
+                "{\"a\":[1,\"x]}\\\"\\\\\"]}\n[\"föö\",{}]  {\"b\":null}\n"
+                'utf-8))
+        (expected '(((a . [1 "x]}\"\\"])) ["föö" nil] ((b)))))
+    (dotimes (split (1+ (length input)))
+      (let ((parser (json-make-parser :object-type 'alist :null-object nil)))
+        (should (equal (append (json-parser-feed parser (substring input 0 split))
+                               (json-parser-feed parser (substring input split)))
+                       expected))))
+    (let ((parser (json-make-parser :object-type 'alist :null-object nil))
+          (values nil))
+      (dotimes (i (length input))
+        (setq values (append values (json-parser-feed
+                                     parser (substring input i (1+ i))))))
+      (should (equal values expected)))))
+
+(ert-deftest json-parser-feed/errors ()
+  (skip-unless (fboundp 'json-make-parser))
+  (let ((parser (json-make-parser :object-type 'plist)))
+    (should (json-parser-p parser))
+    (should (eq (type-of parser) 'json-parser))
+    (should-not (json-parser-p [1]))
+    (should (equal (json-parser-feed parser "{\"a\":1}\n{\"b\"") '((:a 1))))
+    (should (equal (should-error (json-parser-feed parser " 2}\n{\"c\":3}"))
+                   '(json-parse-error "':' expected" "<stream>" 1 6 6)))
+    (should (equal (json-parser-feed parser "\n") '((:c 3))))
+    (should-error (json-parser-feed parser "oops [1] {\"d\":")
+                  :type 'json-parse-error)
+    (should (equal (json-parser-feed parser "[2]\n{\"e\":4}") '((:e 4))))
+    (should-error (json-parser-feed 'parser "[]") :type 'wrong-type-argument)))
+
 (provide 'json-tests)
 ;;; json-tests.el ends here
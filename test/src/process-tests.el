@@ -819,6 +819,277 @@ process-tests/multiple-threads-waiting
                  (should (eq (process-status process) 'exit))
                  (should (eql (process-exit-status process) 0)))))))
 
+(ert-deftest process-tests/many-fds ()
+  "Check that output from many subprocesses at once all arrives."
+  (skip-unless (not (eq system-type 'windows-nt)))
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (process-tests--with-processes processes
+      (let ((cat (executable-find "cat"))
+            (outputs (make-hash-table :test #'eq))
+            (finished 0))
+        (skip-unless cat)
+        (process-tests--ignore-EMFILE
+          (dotimes (i 200)
+            (push (make-process :name (format "cat %d" i)
+                                :command (list cat)
+                                :coding 'no-conversion
+                                :noquery t
+                                :connection-type 'pipe
+                                :filter (lambda (process output)
+                                          (puthash process
+                                                   (concat (gethash process
+                                                                    outputs)
+                                                           output)
+                                                   outputs))
+                                ;; The sentinel runs only once all the
+                                ;; output has been read.
+                                :sentinel (lambda (_process _event)
+                                            (cl-incf finished)))
+                  processes)))
+        (should (< 100 (length processes)))
+        (dolist (process processes)
+          (process-send-string process (concat (process-name process) "\n"))
+          (process-send-eof process))
+        (while (< finished (length processes))
+          (accept-process-output nil 0.05))
+        (dolist (process processes)
+          (should (equal (gethash process outputs)
+                         (concat (process-name process) "\n"))))))))
+
+(defun process-tests--read-all-output (bytes)
+  "Read BYTES of output from a subprocess through a process filter.
+Return a list (CHUNKS LARGEST TOTAL): the number of times the filter
+was called, the largest chunk it saw, and the number of bytes it got."
+  (let ((chunks 0) (largest 0) (total 0))
+    (process-tests--with-processes processes
+      (let ((process
+             (make-process
+              :name "output"
+              :command (list shell-file-name shell-command-switch
+                             (format "dd if=/dev/zero bs=65536 count=%d \
+2>/dev/null"
+                                     (/ bytes 65536)))
+              :coding 'binary
+              :noquery t
+              :connection-type 'pipe
+              :filter (lambda (_process output)
+                        (setq chunks (1+ chunks))
+                        (setq largest (max largest (length output)))
+                        (setq total (+ total (length output)))))))
+        (push process processes)
+        (while (accept-process-output process))))
+    (list chunks largest total)))
+
+(ert-deftest process-tests/read-output-adaptive-size ()
+  "Check that process output is read in growing chunks when allowed."
+  (skip-unless (executable-find "dd"))
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (let ((read-process-output-max 4096)
+          (bytes (* 4 1024 1024)))
+      (let ((read-process-output-adaptive-max 4096))
+        (pcase-let ((`(,_ ,largest ,total)
+                     (process-tests--read-all-output bytes)))
+          (should (= total bytes))
+          (should (<= largest 4096))))
+      (let ((read-process-output-adaptive-max (* 256 1024)))
+        (pcase-let ((`(,_ ,largest ,total)
+                     (process-tests--read-all-output bytes)))
+          (should (= total bytes))
+          (should (< 4096 largest))
+          (should (<= largest (* 256 1024))))))))
+
+(ert-deftest process-tests/default-filter-insert ()
+  "Check output that the default filter decodes into the process buffer."
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (with-temp-buffer
+      (buffer-enable-undo)
+      (insert "start")
+      (undo-boundary)
+      (let* ((marker (point-marker))
+             (changes nil)
+             ;; Split a UTF-8 sequence across two writes.
+             (process (make-process
+                       :name "insert"
+                       :buffer (current-buffer)
+                       :command (list shell-file-name shell-command-switch
+                                      "printf 'h\\303'; sleep 0.1; \
+printf '\\251llo\\n'")
+                       :coding 'utf-8-unix
+                       :noquery t
+                       :connection-type 'pipe
+                       :sentinel #'ignore)))
+        (add-hook 'after-change-functions
+                  (lambda (beg end len) (push (list beg end len) changes))
+                  nil t)
+        (goto-char (point-min))
+        (while (accept-process-output process))
+        (should (equal (buffer-string) "starth\u00e9llo\n"))
+        (should (= (point) (point-min)))
+        (should (= (marker-position marker) (point-max)))
+        (should (= (marker-position (process-mark process)) (point-max)))
+        (should (= (apply #'+ (mapcar (lambda (change)
+                                        (- (nth 1 change) (nth 0 change)))
+                                      changes))
+                   6))
+        (should (equal (car buffer-undo-list) '(6 . 12)))))))
+
+(ert-deftest process-tests/default-filter-advised ()
+  "Check that advice on the default filter is called for output."
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (with-temp-buffer
+      (let* ((seen nil)
+             (process nil)
+             ;; Ignore output from processes that other tests left
+             ;; behind.
+             (advice (lambda (args)
+                       (when (eq (car args) process)
+                         (push (nth 1 args) seen))
+                       args)))
+        (advice-add 'internal-default-process-filter :filter-args advice)
+        (unwind-protect
+            (progn
+              (setq process (make-process
+                             :name "advised"
+                             :buffer (current-buffer)
+                             :command (list shell-file-name
+                                            shell-command-switch
+                                            "printf 'h\\303\\251llo\\n'")
+                             :coding 'utf-8-unix
+                             :noquery t
+                             :connection-type 'pipe
+                             :sentinel #'ignore))
+              (while (accept-process-output process))
+              (should (equal (buffer-string) "h\u00e9llo\n"))
+              (should (equal (apply #'concat (nreverse seen))
+                             "h\u00e9llo\n")))
+          (advice-remove 'internal-default-process-filter advice))))))
+
+;; Two messages in the Content-Length framing of JSON-RPC, split so
+;; that the first read ends inside the headers of the second message
+;; and the second read inside its multibyte content.
+(defconst process-tests--framed-output
+  "printf 'Content-Length: 2\\r\\n\\r\\n[]content-length:'; sleep 0.1; \
+printf ' 10\\r\\nContent-Type: x\\r\\n\\r\\n{\"a\":\"\\303'; sleep 0.1; \
+printf '\\251\"}'")
+
+(ert-deftest process-tests/framing-content-length ()
+  "Check that `content-length' framing passes whole messages to the filter."
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (let* ((messages nil)
+           (process (make-process
+                     :name "framing"
+                     :command (list shell-file-name shell-command-switch
+                                    process-tests--framed-output)
+                     :framing 'content-length
+                     :filter (lambda (_proc message)
+                               (push message messages))
+                     :noquery t
+                     :connection-type 'pipe
+                     :sentinel #'ignore)))
+      (while (accept-process-output process))
+      (should (equal (nreverse messages) '("[]" "{\"a\":\"\u00e9\"}"))))))
+
+(ert-deftest process-tests/framing-jsonrpc ()
+  "Check that `jsonrpc' framing passes parsed messages to the filter."
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (let* ((messages nil)
+           (process (make-process
+                     :name "framing"
+                     :command (list shell-file-name shell-command-switch
+                                    (concat "printf 'Content-Length: 2\\r\\n\\r\\n"
+                                            "{}'; "
+                                            process-tests--framed-output))
+                     :framing '(jsonrpc :object-type alist :null-object nil)
+                     :filter (lambda (_proc message)
+                               (push message messages))
+                     :noquery t
+                     :connection-type 'pipe
+                     :sentinel #'ignore)))
+      (while (accept-process-output process))
+      (should (equal (nreverse messages) '(nil [] ((a . "\u00e9"))))))))
+
+(ert-deftest process-tests/framing-errors ()
+  "Check invalid framings and invalid message headers."
+  (should-error (make-process :name "framing" :command '("true")
+                              :framing 'no-such-framing))
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (let* ((debug-on-error t)
+           (process (make-process
+                     :name "framing"
+                     :command (list shell-file-name shell-command-switch
+                                    "printf 'Content-Length: x\\r\\n\\r\\n'")
+                     :framing 'content-length
+                     :filter #'ignore
+                     :noquery t
+                     :connection-type 'pipe
+                     :sentinel #'ignore)))
+      (should-error (while (accept-process-output process)))
+      (delete-process process))))
+
+(ert-deftest process-tests/send-while-blocked ()
+  "Check input sent while an earlier send waits for the process."
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (let* ((big (make-string (* 1024 1024) ?a))
+           (output nil)
+           (process (make-process
+                     :name "send"
+                     :command '("cat")
+                     :filter (lambda (_proc string) (push string output))
+                     :coding 'utf-8-unix
+                     :noquery t
+                     :connection-type 'pipe
+                     :sentinel #'ignore)))
+      ;; The timer runs while the first send waits for `cat' to read
+      ;; its input, so its input is queued behind the rest of BIG.
+      (run-at-time 0 nil (lambda () (process-send-string process "é")))
+      (process-send-string process big)
+      (process-send-string process "c")
+      (let ((stats (process-send-statistics process)))
+        (should (= (alist-get 'bytes stats) (+ (length big) 3)))
+        (should (< 0 (alist-get 'waits stats)))
+        (should (< (alist-get 'waits stats) (alist-get 'writes stats)))
+        (should (= (alist-get 'queued stats) 0)))
+      (process-send-eof process)
+      (while (accept-process-output process))
+      (should (equal (apply #'concat (nreverse output))
+                     (concat big "éc"))))))
+
+(ert-deftest process-tests/stop-continue-status ()
+  "Check that stopping and continuing a subprocess is noticed."
+  (skip-unless (not (eq system-type 'windows-nt)))
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (process-tests--with-processes processes
+      (let ((process (make-process :name "sleep" :command '("sleep" "60")
+                                   :noquery t :connection-type 'pipe
+                                   :sentinel #'ignore)))
+        (push process processes)
+        (dolist (step '((SIGSTOP . stop) (SIGCONT . run) (SIGTERM . signal)))
+          (signal-process process (car step))
+          (while (not (eq (process-status process) (cdr step)))
+            (accept-process-output nil 0.05)))
+        (should (eq (process-exit-status process) 15))))))
+
+(ert-deftest process-tests/nowait-connect-localhost ()
+  "Check that a :nowait connection by host name is opened."
+  (with-timeout (60 (ert-fail "Test timed out"))
+    (process-tests--with-processes processes
+      (let* ((server (make-network-process :name "server" :server t
+                                           :host 'local :family 'ipv4
+                                           :service t :noquery t))
+             (events nil)
+             (client (progn
+                       (push server processes)
+                       (make-network-process
+                        :name "client" :host "localhost" :family 'ipv4
+                        :service (process-contact server :service)
+                        :nowait t :noquery t
+                        :sentinel (lambda (_ event) (push event events))))))
+        (push client processes)
+        (while (not events)
+          (accept-process-output nil 0.05))
+        (should (equal events '("open\n")))
+        (should (eq (process-status client) 'open))))))
+
 (defun process-tests--eval (command form)
   "Return a command that evaluates FORM in an Emacs subprocess.
 COMMAND must be a list returned by